@@ -1,9 +1,12 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
-#include <math.h>
+#include <unistd.h>
+#include <time.h>
 
-#include "../data/ppg_data.h"
+#include "avr_ppg_engine.h"
+#include "avr_ppg_mod.h"
+#include "../ppg_ref.h"
 
 /**
 	\file avr_ppg_aplay.c
@@ -12,180 +15,308 @@
 	\brief A proof-of-concept implementation of wavetable synthesis (based on PPG Wave) meant to be
 	easily ported for AVR devices.
 
-	All calculations are performed using variables no bigger than 16 bits. The file could still probably
-	use some optimisations, but I'll leave that for later, when I actually get to work with the real hardware.
+	The audio path uses variables no bigger than 16 bits, apart from the 24-bit DDS phase. Only the control
+	rate pitch calculations use 32-bit math. The engine itself lives in
+	avr_ppg_engine.c, which compiles both for AVR and for the host, so the exact same fixed-point code
+	can be benchmarked here. It could still probably use some optimisations, but I'll leave that for later,
+	when I actually get to work with the real hardware.
 
-	For now, this program outputs 8-bit data meant for aplay on stdout. The sampling frequency is configured
-	using SAMPLING_FREQ macro.
+	This program outputs 8-bit data meant for aplay on stdout. The sampling frequency is configured
+	using SAMPLING_FREQ macro. The firmware for the actual chip, with interrupt-driven PWM output,
+	is in avr_ppg_synth.c.
 
-	I've also implemented two 1-pole filters chained together. They work pretty nicely and surely make the sound
-	more sophisticated. For that, see the file avr_ppg_filter_aplay.c.
+	There's also a resonant 12 dB/oct state-variable filter (LP, BP or HP output) swept by an envelope and an LFO.
+	For that, see the file avr_ppg_filter_aplay.c.
 
-	There's still a lot of work to do - for example LFO and EGs.
+	The wavetable slot is swept by an integer LFO (see avr_ppg_mod.c), which is updated only once every
+	CONTROL_PERIOD samples, so there's no float math left in the audio path.
+
+	Up to MAX_VOICES voices (-v option) can be played at once. Each one has its own 24-bit DDS phase and
+	slot, and they're summed in 16 bits and saturated to 8 bits (see render_voices_sample()).
+
+	Pitch is given as a MIDI note with a fraction of a semitone (used for vibrato and pitch bend, -p). Phase steps
+	come from a table of 24-bit increments for all MIDI notes and the fraction is interpolated between them,
+	so there's no float math even for pitch changes.
 */
 
 //! I think we can manage that...
 #define SAMPLING_FREQ 20000
 
-//! This would be 64, but we don't need the additional 3 waveforms that PPG provides
-#define DEFAULT_WAVETABLE_SIZE 61
+//! Modulation is updated once every CONTROL_PERIOD samples
+#define CONTROL_PERIOD 32
+#define CONTROL_RATE ( SAMPLING_FREQ / CONTROL_PERIOD )
 
-//! Contains currently used wavetable
-static struct wavetable_entry
-{
-	const uint8_t *ptr_l;
-	const uint8_t *ptr_r;
-	uint8_t factor;
-	uint8_t is_key;
-} current_wavetable[DEFAULT_WAVETABLE_SIZE];
-
-//! Returns a pointer to the wave with certain index (that can later be passed to get_waveform_sample())
-static inline const uint8_t *get_waveform_pointer( uint8_t index )
-{
-	return ppg_waveforms + ( index << 6 );
-}
+#if SAMPLING_FREQ != NOTE_TABLE_SAMPLING_FREQ
+#error note_phase_steps is computed for a different sampling frequency
+#endif
+
+//! MIDI note of the lowest voice (B1, about 62 Hz)
+#define DEFAULT_BASE_NOTE 35
+
+//! Pitch bend range in semitones (see -p)
+#define PITCH_BEND_RANGE 2
+
+//! Vibrato frequency and depth (in 1/256 of a semitone)
+#define VIBRATO_LFO_FREQ 5
+#define VIBRATO_DEPTH 32
+
+//! Frequency of the LFO sweeping through the wavetable
+#define SLOT_LFO_FREQ 0.16
 
-//! This shall act as pgm_read_byte()
-static inline uint8_t get_waveform_sample( const uint8_t *ptr, uint8_t sample )
+//! Maximum number of voices
+#define MAX_VOICES 4
+
+//! Intervals of the voices in semitones (a major chord with an octave on top)
+static const uint8_t voice_intervals[MAX_VOICES] = { 0, 4, 7, 12 };
+
+//! Contains currently used wavetable (shared by all voices)
+static struct compact_wavetable current_wavetable;
+
+//! The voices and LFOs sweeping through their wavetables
+static struct voice voices[MAX_VOICES];
+static struct lfo slot_lfo[MAX_VOICES];
+static uint8_t voice_count = 1;
+static uint8_t base_note = DEFAULT_BASE_NOTE;
+
+//! Pitch bend applied to all voices (see pitch_bend_offset())
+static int16_t pitch_bend = 0;
+
+//! Vibrato is applied to all voices
+static struct lfo vibrato_lfo;
+
+//! Initializes voices and modulation sources
+static void voices_init( void )
 {
-	return ptr[sample];
+	for ( uint8_t i = 0; i < voice_count; i++ )
+	{
+		uint16_t pitch = pitch_add( PITCH( base_note + voice_intervals[i] ), pitch_bend );
+		voice_init( &voices[i], &current_wavetable, pitch, VOICE_LEVEL_UNITY * 2 / ( voice_count + 1 ) );
+
+		// The sweeps are spread evenly in phase
+		lfo_init( &slot_lfo[i], LFO_SINE, LFO_PHASE_STEP( SLOT_LFO_FREQ, CONTROL_RATE ) );
+		slot_lfo[i].phase = i * ( 65536 / MAX_VOICES );
+	}
+
+	lfo_init( &vibrato_lfo, LFO_TRIANGLE, LFO_PHASE_STEP( VIBRATO_LFO_FREQ, CONTROL_RATE ) );
 }
 
-//! Reads sample from a 64-byte waveform buffer based on 16-bit phase value
-static inline uint8_t get_waveform_sample_by_phase( const uint8_t *ptr, uint16_t phase2b )
+//! Updates modulation - called once every CONTROL_PERIOD samples
+static void modulation_update( void )
 {
-	// This phase ranges 0-127
-	uint8_t phase = ((uint8_t*) &phase2b)[1] >> 1;
-	uint8_t half_select = phase & 64;
-	phase &= 63; // Poor man's modulo 64
-
-	// Waveform mirroring
-	if ( half_select )
-		return get_waveform_sample( ptr, phase );
-	else
-		return 255u - get_waveform_sample( ptr, 63u - phase );
+	int16_t offset = pitch_bend + mod_scale( lfo_update( &vibrato_lfo ), VIBRATO_DEPTH );
+
+	for ( uint8_t i = 0; i < voice_count; i++ )
+	{
+		voice_set_slot( &voices[i], 30 + mod_scale( lfo_update( &slot_lfo[i] ), 30 ) );
+		voice_set_pitch( &voices[i], pitch_add( PITCH( base_note + voice_intervals[i] ), offset ) );
+	}
 }
 
-//! Reads a single sample based on a wavetable entry
-static inline uint8_t get_wavetable_sample( const struct wavetable_entry *e, uint16_t phase2b )
+//! Renders a single sample
+static inline uint8_t render_sample( void )
 {
-	uint8_t sample_l = get_waveform_sample_by_phase( e->ptr_l, phase2b );
-	uint8_t sample_r = get_waveform_sample_by_phase( e->ptr_r, phase2b );
-	uint8_t factor = e->factor;
-	uint16_t mix_l = ( 256 - factor ) * sample_l;
-	uint16_t mix_r = factor * sample_r;
-	uint16_t mix = mix_l + mix_r;
-	return mix >> 8;
+	// Control rate modulation
+	static uint8_t control_countdown = 0;
+	if ( control_countdown-- == 0 )
+	{
+		control_countdown = CONTROL_PERIOD - 1;
+		modulation_update();
+	}
+
+	return render_voices_sample( voices, voice_count );
 }
 
-//! Reads a single sample from the global wavetable
-static inline uint8_t get_current_wavetable_sample( uint8_t slot, uint16_t phase2b )
+//! Returns monotonic time in seconds
+static double get_time( void )
 {
-	return get_wavetable_sample( current_wavetable + slot, phase2b );
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
 }
 
+//! Rendered samples are summed here, so the compiler can't skip rendering in benchmark()
+volatile uint8_t benchmark_sink;
+
 /**
-	Load a wavetable stored in PPG Wave 2.2 format into an array of wavetable_entry structs of size wavetable_size
-	Returns a pointer to the next wavetable
+	Renders given number of seconds of audio as fast as possible and reports the speed.
+	The CSV format is: engine,wavetable,voices,samples,seconds,ns_per_sample,samples_per_sec,x_realtime
 */
-const uint8_t *load_wavetable( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data )
+void benchmark( unsigned int wavetable, float seconds, int csv )
 {
-	// Wipe the wavetable
-	memset( entries, 0, wavetable_size * sizeof( struct wavetable_entry ) );
+	unsigned long samples = seconds * SAMPLING_FREQ;
+	uint8_t acc = 0;
+
+	double start = get_time();
+	for ( unsigned long i = 0; i < samples; i++ )
+		acc += render_sample();
+	double elapsed = get_time() - start;
+	benchmark_sink = acc;
+
+	double rate = samples / elapsed;
+	if ( csv )
+		printf( "avr,%u,%u,%lu,%.6f,%.3f,%.0f,%.2f\n", wavetable, voice_count, samples, elapsed, 1e9 / rate, rate, rate / SAMPLING_FREQ );
+	else
+		printf( "samples: %lu, time: %.3f s, %.2f ns/sample, %.0f samples/s, %.2fx realtime\n", samples, elapsed, 1e9 / rate, rate, rate / SAMPLING_FREQ );
+}
 
-	// The fist byte is ignored
-	data++;
+//! Number of times the sweep is rendered when measuring speed in quality()
+#define QUALITY_RUNS 64
 
-	// Read wavetable entries up to size - 1
-	uint8_t waveform, pos;
-	do
+/**
+	Renders the reference sweep (see ref_sweep() in ppg_ref.c) through get_wavetable_sample() and
+	reports its error against the double precision reference along with rendering speed.
+	The CSV format is: engine,wavetable,samples,snr_db,max_error,ns_per_sample
+*/
+void quality( unsigned int wavetable, int csv )
+{
+	static uint32_t phase[REF_SWEEP_LENGTH];
+	static uint8_t slot[REF_SWEEP_LENGTH];
+	static uint8_t out8[REF_SWEEP_LENGTH];
+	static float out[REF_SWEEP_LENGTH];
+	static struct ref_wavetable ref;
+	struct wavetable_entry entries[DEFAULT_WAVETABLE_SIZE];
+	struct ref_error err;
+
+	ref_sweep( phase, slot, REF_SWEEP_LENGTH );
+	if ( ref_load_wavetable( &ref, ref_find_wavetable( ppg_wavetable, wavetable ), ppg_waveforms ) )
 	{
-		waveform = *data++;
-		pos = *data++;
-
-		entries[pos].ptr_l = get_waveform_pointer( waveform );
-		entries[pos].ptr_r = NULL;
-		entries[pos].factor = 0;
-		entries[pos].is_key = 1;
+		fprintf( stderr, "the reference can't load this wavetable (no key-wave in slot 0)\n" );
+		return;
 	}
-	while ( pos < wavetable_size - 1 );
+	for ( uint8_t i = 0; i < DEFAULT_WAVETABLE_SIZE; i++ )
+		get_compact_wavetable_entry( &current_wavetable, i, &entries[i] );
+
+	// This engine starts the cycle with the mirrored half, so it's half a cycle ahead of the reference
+	double start = get_time();
+	for ( unsigned int r = 0; r < QUALITY_RUNS; r++ )
+		for ( unsigned int i = 0; i < REF_SWEEP_LENGTH; i++ )
+			out8[i] = get_wavetable_sample( &entries[slot[i]], ( phase[i] >> 16 ) + 0x8000 );
+	double elapsed = get_time() - start;
+	double ns = elapsed * 1e9 / ( (double) QUALITY_RUNS * REF_SWEEP_LENGTH );
+
+	for ( unsigned int i = 0; i < REF_SWEEP_LENGTH; i++ )
+		out[i] = ( out8[i] - 128 ) / 128.f;
+	ref_measure( &ref, phase, slot, out, REF_SWEEP_LENGTH, &err );
+
+	if ( csv )
+		printf( "avr,%u,%u,%.2f,%.6f,%.3f\n", wavetable, REF_SWEEP_LENGTH, err.snr_db, err.max_error, ns );
+	else
+		printf( "SNR: %.2f dB, max error: %.6f, %.3f ns per sample\n", err.snr_db, err.max_error, ns );
+}
 
-	// Now, generate interpolation coefficients
-	const struct wavetable_entry *el = NULL, *er = NULL;
-	for ( uint8_t i = 0; i < wavetable_size; i++ )
+int main( int argc, char **argv )
+{
+	unsigned int wavetable = 18;
+	float bench_seconds = 0;
+	int csv = 0;
+	int measure_quality = 0;
+
+	// Command line options
+	int opt;
+	while ( ( opt = getopt( argc, argv, "b:mn:p:qv:w:" ) ) != -1 )
 	{
-		// If the current entry contains a key-wave
-		if ( entries[i].is_key )
+		switch ( opt )
 		{
-			// Write both pointers in case the right key waveform is not found
-			el = er = &entries[i];
+			// Benchmark
+			case 'b':
+				if ( sscanf( optarg, "%f", &bench_seconds ) != 1 || bench_seconds <= 0 )
+				{
+					fprintf( stderr, "invalid benchmark length\n" );
+					return 1;
+				}
+				break;
+
+			// Machine-readable benchmark output
+			case 'm':
+				csv = 1;
+				break;
 
-			// Look for the next key-wave
-			for ( uint8_t j = i + 1; j < wavetable_size; j++ )
+			// Base note
+			case 'n':
 			{
-				if ( entries[j].is_key )
+				unsigned int n;
+				if ( sscanf( optarg, "%u", &n ) != 1 || n + voice_intervals[MAX_VOICES - 1] > 127 )
 				{
-					er = &entries[j];
-					break;
+					fprintf( stderr, "invalid base note\n" );
+					return 1;
 				}
+				base_note = n;
+				break;
 			}
-		}
 
-		// Total distance between known key-waves and distance from the left one
-		uint8_t distance_total = er - el;
-		uint8_t distance_l = &entries[i] - el;
+			// Pitch bend
+			case 'p':
+			{
+				unsigned int bend;
+				if ( sscanf( optarg, "%u", &bend ) != 1 || bend > 16383 )
+				{
+					fprintf( stderr, "invalid pitch bend\n" );
+					return 1;
+				}
+				pitch_bend = pitch_bend_offset( bend, PITCH_BEND_RANGE );
+				break;
+			}
+
+			// Accuracy against the double precision reference
+			case 'q':
+				measure_quality = 1;
+				break;
 
-		entries[i].ptr_l = el->ptr_l;
-		entries[i].ptr_r = er->ptr_l;
+			// Number of voices
+			case 'v':
+			{
+				unsigned int n;
+				if ( sscanf( optarg, "%u", &n ) != 1 || n == 0 || n > MAX_VOICES )
+				{
+					fprintf( stderr, "invalid number of voices\n" );
+					return 1;
+				}
+				voice_count = n;
+				break;
+			}
 
-		// We have to avoid division by 0 for the last slot
-		if ( distance_total != 0 )
-			entries[i].factor = ( 65535 / distance_total * distance_l ) >> 8;
-		else
-			entries[i].factor = 0;
+			// Wavetable index
+			case 'w':
+				if ( sscanf( optarg, "%u", &wavetable ) != 1 || wavetable >= WAVETABLE_COUNT )
+				{
+					fprintf( stderr, "invalid wavetable index\n" );
+					return 1;
+				}
+				break;
+
+			default:
+				fprintf( stderr, "Usage: %s [-b SECONDS] [-m] [-n NOTE] [-p BEND] [-q] [-v VOICES] [-w WAVETABLE]\n", argv[0] );
+				fprintf( stderr, "\t-b - benchmark - render given number of seconds of audio and report speed\n" );
+				fprintf( stderr, "\t-m - machine-readable (CSV) benchmark output\n" );
+				fprintf( stderr, "\t-n - MIDI note of the lowest voice (default %d)\n", DEFAULT_BASE_NOTE );
+				fprintf( stderr, "\t-p - 14-bit MIDI pitch bend (0 - 16383, 8192 is center, range +/- %d semitones)\n", PITCH_BEND_RANGE );
+				fprintf( stderr, "\t-q - measure accuracy against the double precision reference and exit\n" );
+				fprintf( stderr, "\t-v - number of voices (1 - %d)\n", MAX_VOICES );
+				fprintf( stderr, "\t-w - wavetable index (0 - %d)\n", WAVETABLE_COUNT - 1 );
+				return 1;
+		}
 	}
 
-	// Return pointer to the next wavetable
-	return data;
-}
+	// Load wavetable
+	load_compact_wavetable_n( &current_wavetable, ppg_wavetable, wavetable );
 
-//! Loads n-th requested wavetable from binary format
-//! Not very efficient, but it doesn't need to be.
-//! \see load_wavetable()
-const uint8_t *load_wavetable_n( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data, uint8_t index )
-{
-	for ( uint8_t i = 0; i < index + 1; i++ )
-		data = load_wavetable( entries, wavetable_size, data );
-	return data;
-}
+	if ( measure_quality )
+	{
+		quality( wavetable, csv );
+		return 0;
+	}
 
+	voices_init();
 
-int main( int argc, char **argv )
-{
-	// Load wavetable
-	load_wavetable_n( current_wavetable, DEFAULT_WAVETABLE_SIZE, ppg_wavetable, 18 );
+	if ( bench_seconds > 0 )
+	{
+		benchmark( wavetable, bench_seconds, csv );
+		return 0;
+	}
 
 	// The main loop
 	while ( 1 )
-	{
-		// DDS
-		static uint16_t phase = 0;
-		static float f = 62;
-		uint16_t phase_step = 65536 * f / SAMPLING_FREQ;
-
-		// Time counter
-		static uint32_t cnt = 0;
-		static float t = 0;
-		cnt++;
-		t = (float)cnt / SAMPLING_FREQ;
-
-		// Waveform generation
-		uint8_t sample = get_current_wavetable_sample( 30 + 30 * sin( t ), phase  );
-
-		// Audio output and phase stepping
-		putchar( sample );
-		phase += phase_step;
-	}
+		putchar( render_sample() );
 
 	return 0;
 }
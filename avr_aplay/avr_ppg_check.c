@@ -0,0 +1,96 @@
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "avr_ppg_engine.h"
+
+/**
+	\file avr_ppg_check.c
+	\author Jacek Wieczorek
+
+	\brief Checks the optimized parts of the engine against their reference versions.
+
+	get_wavetable_sample() (the branchless version, which follows the AVR assembly step by step)
+	is compared against get_wavetable_sample_ref() for every left waveform, every morph factor and every
+	phase. The right waveform is cycled through all 256 of them as well.
+
+	Entries derived from compact wavetables (get_compact_wavetable_entry()) are compared against
+	load_wavetable() for every slot of every wavetable.
+
+	Returns non-zero on mismatch.
+*/
+
+//! Compares get_wavetable_sample() against get_wavetable_sample_ref(), returns number of mismatches
+static unsigned long check_sample_lookup( void )
+{
+	unsigned long checked = 0, mismatches = 0;
+	struct wavetable_entry e = { 0 };
+
+	for ( unsigned int l = 0; l < 256; l++ )
+	{
+		e.ptr_l = get_waveform_pointer( l );
+		for ( unsigned int factor = 0; factor < 256; factor++ )
+		{
+			e.ptr_r = get_waveform_pointer( l * 131 + factor );
+			e.factor = factor;
+
+			// Low byte of the phase is not used, but it shouldn't matter either
+			for ( unsigned int phase = 0; phase < 65536; phase += 255 )
+			{
+				uint8_t ref = get_wavetable_sample_ref( &e, phase );
+				uint8_t opt = get_wavetable_sample( &e, phase );
+				checked++;
+
+				if ( ref != opt && mismatches++ < 10 )
+					fprintf( stderr, "mismatch: waveforms %u/%u, factor %u, phase %u: %u != %u\n",
+						l, ( l * 131 + factor ) & 255, factor, phase, opt, ref );
+			}
+		}
+	}
+
+	printf( "%lu samples checked, %lu mismatches\n", checked, mismatches );
+	return mismatches;
+}
+
+//! Compares compact wavetable entries against load_wavetable(), returns number of mismatches
+static unsigned long check_compact_wavetables( void )
+{
+	unsigned long checked = 0, mismatches = 0;
+	struct wavetable_entry entries[DEFAULT_WAVETABLE_SIZE];
+	struct compact_wavetable wt;
+	const uint8_t *data = ppg_wavetable, *compact_data = ppg_wavetable;
+
+	for ( unsigned int n = 0; n < WAVETABLE_COUNT; n++ )
+	{
+		data = load_wavetable( entries, DEFAULT_WAVETABLE_SIZE, data );
+		compact_data = load_compact_wavetable( &wt, compact_data );
+
+		for ( unsigned int i = 0; i < DEFAULT_WAVETABLE_SIZE; i++ )
+		{
+			struct wavetable_entry e;
+			get_compact_wavetable_entry( &wt, i, &e );
+			checked++;
+
+			const struct wavetable_entry *ref = &entries[i];
+			int same = e.ptr_l == ref->ptr_l && e.ptr_r == ref->ptr_r && e.factor == ref->factor && e.is_key == ref->is_key;
+			if ( !same && mismatches++ < 10 )
+				fprintf( stderr, "mismatch: wavetable %u, slot %u\n", n, i );
+		}
+	}
+
+	if ( data != compact_data )
+	{
+		fprintf( stderr, "mismatch: compact wavetables end at a different position\n" );
+		mismatches++;
+	}
+
+	printf( "%lu wavetable entries checked, %lu mismatches\n", checked, mismatches );
+	return mismatches;
+}
+
+int main( void )
+{
+	unsigned long mismatches = 0;
+	mismatches += check_sample_lookup();
+	mismatches += check_compact_wavetables();
+	return mismatches != 0;
+}
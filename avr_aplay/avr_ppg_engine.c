@@ -0,0 +1,260 @@
+#include <inttypes.h>
+#include <string.h>
+#include "avr_ppg_engine.h"
+
+/**
+	SVF cutoff coefficients - 2 * sin( pi * fc / fs ) * 256 for fc spaced exponentially from 40 Hz to 2.5 kHz
+	(at fs = 20 kHz). The upper limit keeps the filter stable with any damping.
+*/
+const uint8_t svf_cutoff_table[256] PROGMEM =
+{
+	  3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+	  4,   4,   4,   4,   4,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+	  5,   5,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   7,   7,   7,   7,
+	  7,   7,   7,   7,   7,   8,   8,   8,   8,   8,   8,   8,   9,   9,   9,   9,
+	  9,   9,   9,  10,  10,  10,  10,  10,  10,  11,  11,  11,  11,  11,  11,  12,
+	 12,  12,  12,  12,  13,  13,  13,  13,  13,  14,  14,  14,  14,  15,  15,  15,
+	 15,  16,  16,  16,  16,  17,  17,  17,  17,  18,  18,  18,  19,  19,  19,  19,
+	 20,  20,  20,  21,  21,  21,  22,  22,  23,  23,  23,  24,  24,  24,  25,  25,
+	 26,  26,  26,  27,  27,  28,  28,  29,  29,  30,  30,  31,  31,  32,  32,  33,
+	 33,  34,  34,  35,  35,  36,  37,  37,  38,  38,  39,  40,  40,  41,  42,  42,
+	 43,  44,  44,  45,  46,  47,  47,  48,  49,  50,  51,  51,  52,  53,  54,  55,
+	 56,  57,  58,  58,  59,  60,  61,  62,  63,  64,  65,  67,  68,  69,  70,  71,
+	 72,  73,  75,  76,  77,  78,  79,  81,  82,  83,  85,  86,  88,  89,  90,  92,
+	 93,  95,  96,  98,  99, 101, 103, 104, 106, 108, 109, 111, 113, 115, 117, 119,
+	120, 122, 124, 126, 128, 130, 133, 135, 137, 139, 141, 143, 146, 148, 150, 153,
+	155, 158, 160, 163, 165, 168, 170, 173, 176, 179, 181, 184, 187, 190, 193, 196
+};
+
+/**
+	24-bit phase steps for MIDI notes 0-127 - 2^24 * 440 * 2^( ( n - 69 ) / 12 ) / fs (at fs = 20 kHz),
+	which gives tuning resolution of about 0.001 Hz
+*/
+const uint32_t note_phase_steps[128] PROGMEM =
+{
+	    6858,     7266,     7698,     8156,     8641,     9155,     9699,    10276,
+	   10887,    11534,    12220,    12947,    13717,    14532,    15396,    16312,
+	   17282,    18310,    19398,    20552,    21774,    23069,    24440,    25894,
+	   27433,    29065,    30793,    32624,    34564,    36619,    38797,    41104,
+	   43548,    46137,    48881,    51787,    54867,    58129,    61586,    65248,
+	   69128,    73238,    77593,    82207,    87096,    92275,    97762,   103575,
+	  109734,   116259,   123172,   130496,   138256,   146477,   155187,   164415,
+	  174191,   184549,   195523,   207150,   219467,   232518,   246344,   260992,
+	  276512,   292954,   310374,   328830,   348383,   369099,   391047,   414299,
+	  438935,   465035,   492688,   521984,   553023,   585908,   620748,   657659,
+	  696766,   738198,   782093,   828599,   877870,   930071,   985375,  1043969,
+	 1106047,  1171815,  1241495,  1315318,  1393531,  1476395,  1564186,  1657197,
+	 1755739,  1860141,  1970751,  2087938,  2212093,  2343631,  2482991,  2630637,
+	 2787063,  2952790,  3128372,  3314395,  3511479,  3720282,  3941502,  4175876,
+	 4424186,  4687262,  4965981,  5261274,  5574125,  5905580,  6256744,  6628789,
+	 7022958,  7440565,  7883004,  8351751,  8848372,  9374524,  9931962, 10522547
+};
+
+/**
+	Load a wavetable stored in PPG Wave 2.2 format (in program memory) into an array of wavetable_entry
+	structs of size wavetable_size. Returns a pointer to the next wavetable
+*/
+const uint8_t *load_wavetable( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data )
+{
+	// Wipe the wavetable
+	memset( entries, 0, wavetable_size * sizeof( struct wavetable_entry ) );
+
+	// The fist byte is ignored
+	data++;
+
+	// Read wavetable entries up to size - 1
+	uint8_t waveform, pos;
+	do
+	{
+		waveform = pgm_read_byte( data++ );
+		pos = pgm_read_byte( data++ );
+
+		entries[pos].ptr_l = get_waveform_pointer( waveform );
+		entries[pos].ptr_r = NULL;
+		entries[pos].factor = 0;
+		entries[pos].is_key = 1;
+	}
+	while ( pos < wavetable_size - 1 );
+
+	// Now, generate interpolation coefficients
+	const struct wavetable_entry *el = NULL, *er = NULL;
+	for ( uint8_t i = 0; i < wavetable_size; i++ )
+	{
+		// If the current entry contains a key-wave
+		if ( entries[i].is_key )
+		{
+			// Write both pointers in case the right key waveform is not found
+			el = er = &entries[i];
+
+			// Look for the next key-wave
+			for ( uint8_t j = i + 1; j < wavetable_size; j++ )
+			{
+				if ( entries[j].is_key )
+				{
+					er = &entries[j];
+					break;
+				}
+			}
+		}
+
+		// Total distance between known key-waves and distance from the left one
+		uint8_t distance_total = er - el;
+		uint8_t distance_l = &entries[i] - el;
+
+		entries[i].ptr_l = el->ptr_l;
+		entries[i].ptr_r = er->ptr_l;
+
+		// We have to avoid division by 0 for the last slot
+		if ( distance_total != 0 )
+			entries[i].factor = ( 65535 / distance_total * distance_l ) >> 8;
+		else
+			entries[i].factor = 0;
+	}
+
+	// Return pointer to the next wavetable
+	return data;
+}
+
+//! Loads n-th requested wavetable from binary format
+//! Not very efficient, but it doesn't need to be.
+//! \see load_wavetable()
+const uint8_t *load_wavetable_n( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data, uint8_t index )
+{
+	for ( uint8_t i = 0; i < index + 1; i++ )
+		data = load_wavetable( entries, wavetable_size, data );
+	return data;
+}
+
+
+/**
+	Loads a wavetable stored in PPG Wave 2.2 format (in program memory) into a compact wavetable.
+	Returns a pointer to the next wavetable
+*/
+const uint8_t *load_compact_wavetable( struct compact_wavetable *wt, const uint8_t *data )
+{
+	memset( wt, 0, sizeof( struct compact_wavetable ) );
+
+	// The fist byte is ignored
+	data++;
+
+	// Read key-waves up to the last slot
+	uint8_t waveform, pos;
+	do
+	{
+		waveform = pgm_read_byte( data++ );
+		pos = pgm_read_byte( data++ );
+
+		if ( pos < DEFAULT_WAVETABLE_SIZE )
+		{
+			wt->wave[pos] = waveform;
+			wt->key_mask[pos >> 3] |= 1 << ( pos & 7 );
+		}
+	}
+	while ( pos < DEFAULT_WAVETABLE_SIZE - 1 );
+
+	return data;
+}
+
+//! Loads n-th requested wavetable into a compact wavetable
+//! \see load_compact_wavetable()
+const uint8_t *load_compact_wavetable_n( struct compact_wavetable *wt, const uint8_t *data, uint8_t index )
+{
+	for ( uint8_t i = 0; i < index + 1; i++ )
+		data = load_compact_wavetable( wt, data );
+	return data;
+}
+
+/**
+	Derives a wavetable entry for given slot of a compact wavetable. The result is the same as
+	what load_wavetable() would produce for that slot. This walks the key-wave bitmap, so it's meant
+	to be called only when the slot changes (at control rate), not for every sample.
+*/
+void get_compact_wavetable_entry( const struct compact_wavetable *wt, uint8_t slot, struct wavetable_entry *e )
+{
+	// The closest key-wave on the left (or the slot itself)
+	uint8_t l = slot;
+	while ( l > 0 && !compact_wavetable_is_key( wt, l ) )
+		l--;
+
+	// And the next one on the right
+	uint8_t r = slot + 1;
+	while ( r < DEFAULT_WAVETABLE_SIZE && !compact_wavetable_is_key( wt, r ) )
+		r++;
+	if ( r == DEFAULT_WAVETABLE_SIZE )
+		r = l;
+
+	// Total distance between key-waves and distance from the left one
+	uint8_t distance_total = r - l;
+	uint8_t distance_l = slot - l;
+
+	e->ptr_l = get_waveform_pointer( wt->wave[l] );
+	e->ptr_r = get_waveform_pointer( wt->wave[r] );
+	e->is_key = distance_l == 0;
+
+	// We have to avoid division by 0 past the last key-wave
+	if ( distance_total != 0 )
+		e->factor = ( 65535 / distance_total * distance_l ) >> 8;
+	else
+		e->factor = 0;
+}
+
+/**
+	Returns phase step for given pitch (see PITCH()). The fraction of a semitone is linearly interpolated
+	between the neighbouring notes, so there's no need for floats or exponentiation.
+*/
+phase24 note_phase_step( uint16_t pitch )
+{
+	uint8_t note = pitch >> 8;
+	uint8_t frac = pitch;
+
+	// Nothing to interpolate towards above the last note
+	if ( note >= 127 )
+		return pgm_read_dword( note_phase_steps + 127 );
+
+	uint32_t step_l = pgm_read_dword( note_phase_steps + note );
+	uint32_t step_r = pgm_read_dword( note_phase_steps + note + 1 );
+	return step_l + ( ( ( step_r - step_l ) * frac ) >> 8 );
+}
+
+//! Converts a 14-bit MIDI pitch bend value (8192 is center) into pitch offset for bend range in semitones
+int16_t pitch_bend_offset( uint16_t bend, uint8_t range )
+{
+	return ( (int32_t)( (int16_t) bend - 8192 ) * range ) >> 5;
+}
+
+/**
+	Adds an offset (e.g. vibrato or pitch bend, in 1/256 of a semitone) to a pitch. The result is clamped
+	to the range of the note table, so pitches below note 0 don't wrap around to the top.
+*/
+uint16_t pitch_add( uint16_t pitch, int16_t offset )
+{
+	int32_t p = (int32_t) pitch + offset;
+	if ( p < 0 ) return 0;
+	if ( p > PITCH( 127 ) ) return PITCH( 127 );
+	return p;
+}
+
+//! Initializes a voice playing given wavetable (starting at slot 0) at given pitch
+void voice_init( struct voice *v, const struct compact_wavetable *wt, uint16_t pitch, uint8_t level )
+{
+	v->wavetable = wt;
+	v->phase = 0;
+	v->phase_step = note_phase_step( pitch );
+	v->level = level;
+	v->slot = 0;
+	get_compact_wavetable_entry( wt, 0, &v->entry );
+}
+
+//! Changes wavetable slot of a voice - the entry is only derived if the slot actually changes
+void voice_set_slot( struct voice *v, uint8_t slot )
+{
+	if ( slot == v->slot ) return;
+	v->slot = slot;
+	get_compact_wavetable_entry( v->wavetable, slot, &v->entry );
+}
+
+//! Changes pitch of a voice (see PITCH())
+void voice_set_pitch( struct voice *v, uint16_t pitch )
+{
+	v->phase_step = note_phase_step( pitch );
+}
@@ -0,0 +1,328 @@
+#ifndef AVR_PPG_ENGINE_H
+#define AVR_PPG_ENGINE_H
+
+#include <inttypes.h>
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#include "../data/avr/ppg_data_avr.h"
+#else
+#include "pgmspace_shim.h"
+#include "../data/ppg_data.h"
+#endif
+
+/**
+	\file avr_ppg_engine.h
+	\author Jacek Wieczorek
+
+	\brief The fixed-point wavetable engine shared by the AVR programs.
+
+	The audio path uses variables no bigger than 16 bits, apart from the 24-bit DDS phase (phase24).
+	32-bit math is only used at control rate, for pitch (note_phase_step(), pitch_add() and pitch_bend_offset()).
+
+	The same code is compiled for AVR, where the waveform data is read from PROGMEM (data/avr/ppg_data_avr.c),
+	and for the host, where pgm_read_byte() is just a plain memory read (see pgmspace_shim.h).
+*/
+
+//! Number of wavetables in the PPG ROM
+#define WAVETABLE_COUNT 29
+
+//! This would be 64, but we don't need the additional 3 waveforms that PPG provides
+#define DEFAULT_WAVETABLE_SIZE 61
+
+//! A wavetable entry/slot
+struct wavetable_entry
+{
+	const uint8_t *ptr_l;
+	const uint8_t *ptr_r;
+	uint8_t factor;
+	uint8_t is_key;
+};
+
+//! Size of the key-wave bitmap in a compact wavetable
+#define WAVETABLE_KEY_MASK_SIZE ( ( DEFAULT_WAVETABLE_SIZE + 7 ) / 8 )
+
+/**
+	A compact wavetable - only key-wave indices are stored (at their positions) along with a bitmap
+	telling which slots hold key-waves. The wavetable_entry for a slot is derived on demand with
+	get_compact_wavetable_entry(). This takes 69 bytes instead of 61 wavetable_entry structs (366 bytes on AVR),
+	so each voice can afford its own wavetable.
+*/
+struct compact_wavetable
+{
+	uint8_t wave[DEFAULT_WAVETABLE_SIZE];
+	uint8_t key_mask[WAVETABLE_KEY_MASK_SIZE];
+};
+
+//! Returns non-zero if the slot of a compact wavetable holds a key-wave
+static inline uint8_t compact_wavetable_is_key( const struct compact_wavetable *wt, uint8_t slot )
+{
+	return wt->key_mask[slot >> 3] & ( 1 << ( slot & 7 ) );
+}
+
+//! Returns a pointer to the wave with certain index (that can later be passed to get_waveform_sample())
+static inline const uint8_t *get_waveform_pointer( uint8_t index )
+{
+	return ppg_waveforms + ( index << 6 );
+}
+
+//! Reads a waveform sample from program memory
+static inline uint8_t get_waveform_sample( const uint8_t *ptr, uint8_t sample )
+{
+	return pgm_read_byte( ptr + sample );
+}
+
+//! Reads sample from a 64-byte waveform buffer based on 16-bit phase value
+static inline uint8_t get_waveform_sample_by_phase( const uint8_t *ptr, uint16_t phase2b )
+{
+	// This phase ranges 0-127
+	uint8_t phase = ((uint8_t*) &phase2b)[1] >> 1;
+	uint8_t half_select = phase & 64;
+	phase &= 63; // Poor man's modulo 64
+
+	// Waveform mirroring
+	if ( half_select )
+		return get_waveform_sample( ptr, phase );
+	else
+		return 255u - get_waveform_sample( ptr, 63u - phase );
+}
+
+/**
+	Reads a single sample based on a wavetable entry - the reference implementation.
+	\see get_wavetable_sample()
+*/
+static inline uint8_t get_wavetable_sample_ref( const struct wavetable_entry *e, uint16_t phase2b )
+{
+	uint8_t sample_l = get_waveform_sample_by_phase( e->ptr_l, phase2b );
+	uint8_t sample_r = get_waveform_sample_by_phase( e->ptr_r, phase2b );
+	uint8_t factor = e->factor;
+	uint16_t mix_l = ( 256 - factor ) * sample_l;
+	uint16_t mix_r = factor * sample_r;
+	uint16_t mix = mix_l + mix_r;
+	return mix >> 8;
+}
+
+/**
+	Reads a single sample based on a wavetable entry. The result is the same as get_wavetable_sample_ref()
+	gives, but the mirroring is branchless: the mask is 0xff in the first half of the cycle and 0 in the second
+	one, so XOR-ing both the index and the sample with it gives 63 - index and 255 - sample where needed.
+	The morph is computed as ( sample_l << 8 ) - factor * sample_l + factor * sample_r, which takes two 8x8
+	multiplications.
+
+	On AVR this is hand-written assembly (MUL and LPM). Elsewhere, it's the same sequence of operations in C,
+	which is what avr_ppg_check.c tests against the reference.
+*/
+#ifdef __AVR__
+static inline uint8_t get_wavetable_sample( const struct wavetable_entry *e, uint16_t phase2b )
+{
+	uint8_t index, mask, sample_l, sample_r;
+	uint16_t acc;
+
+	asm(
+		// Mirror mask from the top bit of the phase
+		"mov %[index], %B[phase]\n\t"
+		"lsl %[index]\n\t"
+		"sbc %[mask], %[mask]\n\t"
+		"com %[mask]\n\t"
+
+		// Index in the 64-byte waveform
+		"mov %[index], %B[phase]\n\t"
+		"lsr %[index]\n\t"
+		"eor %[index], %[mask]\n\t"
+		"andi %[index], 63\n\t"
+
+		// Left sample
+		"movw r30, %[ptr_l]\n\t"
+		"add r30, %[index]\n\t"
+		"adc r31, __zero_reg__\n\t"
+		"lpm %[sample_l], Z\n\t"
+		"eor %[sample_l], %[mask]\n\t"
+
+		// Right sample
+		"movw r30, %[ptr_r]\n\t"
+		"add r30, %[index]\n\t"
+		"adc r31, __zero_reg__\n\t"
+		"lpm %[sample_r], Z\n\t"
+		"eor %[sample_r], %[mask]\n\t"
+
+		// acc = ( sample_l << 8 ) - factor * sample_l + factor * sample_r
+		"mul %[factor], %[sample_l]\n\t"
+		"clr %A[acc]\n\t"
+		"mov %B[acc], %[sample_l]\n\t"
+		"sub %A[acc], r0\n\t"
+		"sbc %B[acc], r1\n\t"
+		"mul %[factor], %[sample_r]\n\t"
+		"add %A[acc], r0\n\t"
+		"adc %B[acc], r1\n\t"
+		"clr __zero_reg__\n\t"
+		: [index] "=&d" ( index ), [mask] "=&r" ( mask ),
+		  [sample_l] "=&r" ( sample_l ), [sample_r] "=&r" ( sample_r ), [acc] "=&r" ( acc )
+		: [phase] "r" ( phase2b ), [ptr_l] "r" ( e->ptr_l ), [ptr_r] "r" ( e->ptr_r ), [factor] "r" ( e->factor )
+		: "r0", "r30", "r31"
+	);
+
+	return acc >> 8;
+}
+#else
+static inline uint8_t get_wavetable_sample( const struct wavetable_entry *e, uint16_t phase2b )
+{
+	uint8_t phase_h = phase2b >> 8;
+	uint8_t mask = ( phase_h >> 7 ) - 1;
+	uint8_t index = ( ( phase_h >> 1 ) ^ mask ) & 63;
+	uint8_t sample_l = get_waveform_sample( e->ptr_l, index ) ^ mask;
+	uint8_t sample_r = get_waveform_sample( e->ptr_r, index ) ^ mask;
+	uint16_t acc = ( sample_l << 8 ) - e->factor * sample_l + e->factor * sample_r;
+	return acc >> 8;
+}
+#endif
+
+/**
+	24-bit DDS phase - 16-bit index (what get_wavetable_sample() takes) and 8-bit fraction. avr-gcc has a native
+	24-bit type. Elsewhere, a 32-bit one is used and the top byte is simply ignored.
+*/
+#ifdef __AVR__
+typedef __uint24 phase24;
+#else
+typedef uint32_t phase24;
+#endif
+
+//! Sampling frequency note_phase_steps was computed for
+#define NOTE_TABLE_SAMPLING_FREQ 20000
+
+//! Phase steps for all MIDI notes (A4 = 440 Hz)
+extern const uint32_t note_phase_steps[128] PROGMEM;
+
+//! Pitch - MIDI note number in the upper byte and fraction of a semitone in the lower one
+#define PITCH( note ) ( (uint16_t)( note ) << 8 )
+
+//! Voice level corresponding to unity gain
+#define VOICE_LEVEL_UNITY 128
+
+/**
+	A single voice - a 24-bit DDS oscillator reading its own (compact) wavetable.
+	The wavetable entry for the current slot is kept, so it's only derived when the slot changes.
+*/
+struct voice
+{
+	const struct compact_wavetable *wavetable;
+	struct wavetable_entry entry;
+	phase24 phase;
+	phase24 phase_step;
+	uint8_t slot;
+	uint8_t level;    //!< Mixing level (VOICE_LEVEL_UNITY is unity gain)
+};
+
+//! Saturates a value to 8-bit signed range
+static inline int8_t saturate8( int16_t x )
+{
+	if ( x > INT8_MAX ) return INT8_MAX;
+	if ( x < INT8_MIN ) return INT8_MIN;
+	return x;
+}
+
+//! Renders a single sample of all voices and mixes them (16-bit sum, saturated to 8 bits)
+static inline uint8_t render_voices_sample( struct voice *voices, uint8_t count )
+{
+	int16_t mix = 0;
+	for ( uint8_t i = 0; i < count; i++ )
+	{
+		struct voice *v = voices + i;
+		int8_t x = get_wavetable_sample( &v->entry, v->phase >> 8 ) - 128;
+		mix += ( x * v->level ) >> 7;
+		v->phase += v->phase_step;
+	}
+
+	return saturate8( mix ) + 128;
+}
+
+//! 8-bit signed audio signal
+typedef int8_t audio_signal;
+
+//! Branchless saturating 16-bit addition
+static inline int16_t sat_add16( int16_t a, int16_t b )
+{
+	int16_t sum = (uint16_t) a + (uint16_t) b;
+	int16_t overflow = ( ( a ^ sum ) & ( b ^ sum ) ) >> 15;  // All ones on overflow
+	int16_t limit = ( a >> 15 ) ^ INT16_MAX;                // INT16_MAX or INT16_MIN, depending on sign of a
+	return ( sum & ~overflow ) | ( limit & overflow );
+}
+
+//! Branchless saturating 16-bit subtraction
+static inline int16_t sat_sub16( int16_t a, int16_t b )
+{
+	int16_t diff = (uint16_t) a - (uint16_t) b;
+	int16_t overflow = ( ( a ^ b ) & ( a ^ diff ) ) >> 15;
+	int16_t limit = ( a >> 15 ) ^ INT16_MAX;
+	return ( diff & ~overflow ) | ( limit & overflow );
+}
+
+//! Returns ( a * b ) >> 8 - split into two 8x8 multiplications, so no 32-bit math is needed on AVR
+static inline int16_t mul_s16_u8( int16_t a, uint8_t b )
+{
+	int8_t a_h = a >> 8;
+	uint8_t a_l = a;
+	return a_h * b + ( ( a_l * b ) >> 8 );
+}
+
+//! Input signal is scaled up by this many bits in the SVF, which leaves headroom for resonance
+#define SVF_INPUT_SHIFT 6
+
+//! The output is scaled down by one more bit than the input (-6 dB), so resonant peaks and high-pass transients fit in 8 bits
+#define SVF_OUTPUT_SHIFT ( SVF_INPUT_SHIFT + 1 )
+
+/**
+	A 12 dB/oct resonant state-variable filter (Chamberlin) in 16-bit fixed point, with LP, BP and HP outputs.
+	The cutoff coefficient comes from svf_cutoff_table (see svf_cutoff_coeff()). Damping is 0-255, corresponding
+	to 0-2 (so lower values mean more resonance). All additions saturate.
+*/
+struct svf
+{
+	int16_t lp, bp, hp;
+};
+
+//! Feeds a sample into the state-variable filter
+static inline void svf_feed( struct svf *f, uint8_t coeff, uint8_t damping, audio_signal x )
+{
+	int16_t in = x * ( 1 << SVF_INPUT_SHIFT );
+	int16_t damp = mul_s16_u8( f->bp, damping );
+
+	f->lp = sat_add16( f->lp, mul_s16_u8( f->bp, coeff ) );
+	f->hp = sat_sub16( sat_sub16( in, f->lp ), sat_add16( damp, damp ) );
+	f->bp = sat_add16( f->bp, mul_s16_u8( f->hp, coeff ) );
+}
+
+//! Converts a filter output back to an 8-bit signal, branchlessly clamped to [-127, 127]
+static inline audio_signal svf_output( int16_t y )
+{
+	int16_t x = y >> SVF_OUTPUT_SHIFT;
+	int16_t over = ( INT8_MAX - x ) >> 15;   // All ones if x > 127
+	int16_t under = ( x + INT8_MAX ) >> 15;  // All ones if x < -127
+	x = ( x & ~over ) | ( INT8_MAX & over );
+	return ( x & ~under ) | ( -INT8_MAX & under );
+}
+
+//! Cutoff coefficients (2 * sin( pi * fc / fs ) in Q8) for exponentially spaced cutoff frequencies
+extern const uint8_t svf_cutoff_table[256] PROGMEM;
+
+//! Returns SVF coefficient for cutoff from 0 (40 Hz) to 255 (2.5 kHz)
+static inline uint8_t svf_cutoff_coeff( uint8_t cutoff )
+{
+	return pgm_read_byte( svf_cutoff_table + cutoff );
+}
+
+const uint8_t *load_wavetable( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data );
+const uint8_t *load_wavetable_n( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data, uint8_t index );
+
+const uint8_t *load_compact_wavetable( struct compact_wavetable *wt, const uint8_t *data );
+const uint8_t *load_compact_wavetable_n( struct compact_wavetable *wt, const uint8_t *data, uint8_t index );
+void get_compact_wavetable_entry( const struct compact_wavetable *wt, uint8_t slot, struct wavetable_entry *e );
+
+phase24 note_phase_step( uint16_t pitch );
+int16_t pitch_bend_offset( uint16_t bend, uint8_t range );
+uint16_t pitch_add( uint16_t pitch, int16_t offset );
+
+void voice_init( struct voice *v, const struct compact_wavetable *wt, uint16_t pitch, uint8_t level );
+void voice_set_slot( struct voice *v, uint8_t slot );
+void voice_set_pitch( struct voice *v, uint16_t pitch );
+
+#endif
@@ -1,9 +1,11 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
-#include <math.h>
+#include <unistd.h>
+#include <time.h>
 
-#include "../data/ppg_data.h"
+#include "avr_ppg_engine.h"
+#include "avr_ppg_mod.h"
 
 /**
 	\file avr_ppg_aplay.c
@@ -12,214 +14,223 @@
 	\brief A proof-of-concept implementation of wavetable synthesis (based on PPG Wave) meant to be
 	easily ported for AVR devices.
 
-	All calculations are performed using variables no bigger than 16 bits. The file could still probably
-	use some optimisations, but I'll leave that for later, when I actually get to work with the real hardware.
+	All calculations are performed using variables no bigger than 16 bits. The engine itself lives in
+	avr_ppg_engine.c, which compiles both for AVR and for the host, so the exact same fixed-point code
+	can be benchmarked here. It could still probably use some optimisations, but I'll leave that for later,
+	when I actually get to work with the real hardware.
 
 	For now, this program outputs 8-bit data meant for aplay on stdout. The sampling frequency is configured
 	using SAMPLING_FREQ macro.
 
-	I've also implemented two 1-pole filters chained together. They work pretty nicely and surely make the sound
-	more sophisticated. For that, see the file avr_ppg_filter_aplay.c.
+	The sound goes through a resonant state-variable filter (see struct svf) - low-pass by default, band-pass or
+	high-pass with the -t option.
 
-	There's still a lot of work to do - for example LFO and EGs.
+	The wavetable slot is swept by an integer LFO and the filter cutoff is driven by an ADSR
+	envelope (retriggered every NOTE_PERIOD control ticks) plus a faster LFO. All of them live in
+	avr_ppg_mod.c and are updated only once every CONTROL_PERIOD samples, using integer math only.
 */
 
 //! I think we can manage that...
 #define SAMPLING_FREQ 20000
 
-//! This would be 64, but we don't need the additional 3 waveforms that PPG provides
-#define DEFAULT_WAVETABLE_SIZE 61
+//! Modulation is updated once every CONTROL_PERIOD samples
+#define CONTROL_PERIOD 32
+#define CONTROL_RATE ( SAMPLING_FREQ / CONTROL_PERIOD )
 
-//! Contains currently used wavetable
-static struct wavetable_entry
-{
-	const uint8_t *ptr_l;
-	const uint8_t *ptr_r;
-	uint8_t factor;
-	uint8_t is_key;
-} current_wavetable[DEFAULT_WAVETABLE_SIZE];
-
-//! Returns a pointer to the wave with certain index (that can later be passed to get_waveform_sample())
-static inline const uint8_t *get_waveform_pointer( uint8_t index )
-{
-	return ppg_waveforms + ( index << 6 );
-}
+#if SAMPLING_FREQ != NOTE_TABLE_SAMPLING_FREQ
+#error note_phase_steps is computed for a different sampling frequency
+#endif
 
-//! This shall act as pgm_read_byte()
-static inline uint8_t get_waveform_sample( const uint8_t *ptr, uint8_t sample )
-{
-	return ptr[sample];
-}
+//! MIDI note played (B1, about 62 Hz)
+#define NOTE 35
 
-//! Reads sample from a 64-byte waveform buffer based on 16-bit phase value
-static inline uint8_t get_waveform_sample_by_phase( const uint8_t *ptr, uint16_t phase2b )
-{
-	// This phase ranges 0-127
-	uint8_t phase = ((uint8_t*) &phase2b)[1] >> 1;
-	uint8_t half_select = phase & 64;
-	phase &= 63; // Poor man's modulo 64
-
-	// Waveform mirroring
-	if ( half_select )
-		return get_waveform_sample( ptr, phase );
-	else
-		return 255u - get_waveform_sample( ptr, 63u - phase );
-}
+//! Frequencies of the LFOs sweeping through the wavetable and modulating the filter
+#define SLOT_LFO_FREQ 0.16
+#define FILTER_LFO_FREQ 5.1
+
+//! Filter envelope segment times (in ms) and sustain level (0 - 255)
+#define FILTER_ATTACK 20
+#define FILTER_DECAY 300
+#define FILTER_SUSTAIN 96
+#define FILTER_RELEASE 400
+
+//! Filter damping (0 - 255 corresponds to 0 - 2, lower means more resonance)
+#define FILTER_DAMPING 64
+
+//! The filter envelope is retriggered every NOTE_PERIOD control ticks and released after NOTE_LENGTH
+#define NOTE_PERIOD CONTROL_RATE
+#define NOTE_LENGTH ( CONTROL_RATE * 2 / 5 )
+
+//! Contains currently used wavetable and the voice playing it
+static struct compact_wavetable current_wavetable;
+static struct voice voice;
+
+//! Modulation sources
+static struct lfo slot_lfo, filter_lfo;
+static struct adsr filter_eg;
+
+//! The filter, its output used and current cutoff coefficient
+static struct svf filter;
+static const int16_t *filter_out = &filter.lp;
+static uint8_t filter_coeff;
 
-//! Reads a single sample based on a wavetable entry
-static inline uint8_t get_wavetable_sample( const struct wavetable_entry *e, uint16_t phase2b )
+//! Initializes modulation sources
+static void modulation_init( void )
 {
-	uint8_t sample_l = get_waveform_sample_by_phase( e->ptr_l, phase2b );
-	uint8_t sample_r = get_waveform_sample_by_phase( e->ptr_r, phase2b );
-	uint8_t factor = e->factor;
-	uint16_t mix_l = ( 256 - factor ) * sample_l;
-	uint16_t mix_r = factor * sample_r;
-	uint16_t mix = mix_l + mix_r;
-	return mix >> 8;
+	lfo_init( &slot_lfo, LFO_SINE, LFO_PHASE_STEP( SLOT_LFO_FREQ, CONTROL_RATE ) );
+	lfo_init( &filter_lfo, LFO_SINE, LFO_PHASE_STEP( FILTER_LFO_FREQ, CONTROL_RATE ) );
+	adsr_init( &filter_eg,
+		ADSR_STEP( FILTER_ATTACK, CONTROL_RATE ),
+		ADSR_STEP( FILTER_DECAY, CONTROL_RATE ),
+		ADSR_SUSTAIN( FILTER_SUSTAIN ),
+		ADSR_STEP( FILTER_RELEASE, CONTROL_RATE ) );
 }
 
-//! Reads a single sample from the global wavetable
-static inline uint8_t get_current_wavetable_sample( uint8_t slot, uint16_t phase2b )
+//! Updates modulation - called once every CONTROL_PERIOD samples
+static void modulation_update( void )
 {
-	return get_wavetable_sample( current_wavetable + slot, phase2b );
+	// Note on/off
+	static uint16_t note_cnt = 0;
+	if ( note_cnt == 0 ) adsr_gate( &filter_eg, 1 );
+	else if ( note_cnt == NOTE_LENGTH ) adsr_gate( &filter_eg, 0 );
+	if ( ++note_cnt == NOTE_PERIOD ) note_cnt = 0;
+
+	uint8_t slot = 30 + mod_scale( lfo_update( &slot_lfo ), 30 );
+	voice_set_slot( &voice, slot );
+	uint8_t cutoff = 48 + eg_scale( adsr_update( &filter_eg ), 160 ) + mod_scale( lfo_update( &filter_lfo ), 40 );
+	filter_coeff = svf_cutoff_coeff( cutoff );
 }
 
-/**
-	Load a wavetable stored in PPG Wave 2.2 format into an array of wavetable_entry structs of size wavetable_size
-	Returns a pointer to the next wavetable
-*/
-const uint8_t *load_wavetable( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data )
+//! Renders a single sample
+static inline uint8_t render_sample( void )
 {
-	// Wipe the wavetable
-	memset( entries, 0, wavetable_size * sizeof( struct wavetable_entry ) );
-
-	// The fist byte is ignored
-	data++;
-
-	// Read wavetable entries up to size - 1
-	uint8_t waveform, pos;
-	do
+	// Control rate modulation
+	static uint8_t control_countdown = 0;
+	if ( control_countdown-- == 0 )
 	{
-		waveform = *data++;
-		pos = *data++;
-
-		entries[pos].ptr_l = get_waveform_pointer( waveform );
-		entries[pos].ptr_r = NULL;
-		entries[pos].factor = 0;
-		entries[pos].is_key = 1;
+		control_countdown = CONTROL_PERIOD - 1;
+		modulation_update();
 	}
-	while ( pos < wavetable_size - 1 );
-
-	// Now, generate interpolation coefficients
-	const struct wavetable_entry *el = NULL, *er = NULL;
-	for ( uint8_t i = 0; i < wavetable_size; i++ )
-	{
-		// If the current entry contains a key-wave
-		if ( entries[i].is_key )
-		{
-			// Write both pointers in case the right key waveform is not found
-			el = er = &entries[i];
-
-			// Look for the next key-wave
-			for ( uint8_t j = i + 1; j < wavetable_size; j++ )
-			{
-				if ( entries[j].is_key )
-				{
-					er = &entries[j];
-					break;
-				}
-			}
-		}
-
-		// Total distance between known key-waves and distance from the left one
-		uint8_t distance_total = er - el;
-		uint8_t distance_l = &entries[i] - el;
 
-		entries[i].ptr_l = el->ptr_l;
-		entries[i].ptr_r = er->ptr_l;
+	// Waveform generation
+	uint8_t sample = render_voices_sample( &voice, 1 );
 
-		// We have to avoid division by 0 for the last slot
-		if ( distance_total != 0 )
-			entries[i].factor = ( 65535 / distance_total * distance_l ) >> 8;
-		else
-			entries[i].factor = 0;
-	}
+	// Resonant state-variable filter
+	audio_signal x = sample - 127;
+	svf_feed( &filter, filter_coeff, FILTER_DAMPING, x );
+	audio_signal y = svf_output( *filter_out );
 
-	// Return pointer to the next wavetable
-	return data;
+	return 127 + y;
 }
 
-//! Loads n-th requested wavetable from binary format
-//! Not very efficient, but it doesn't need to be.
-//! \see load_wavetable()
-const uint8_t *load_wavetable_n( struct wavetable_entry *entries, uint8_t wavetable_size, const uint8_t *data, uint8_t index )
+//! Returns monotonic time in seconds
+static double get_time( void )
 {
-	for ( uint8_t i = 0; i < index + 1; i++ )
-		data = load_wavetable( entries, wavetable_size, data );
-	return data;
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
 }
 
-//! Safe add (no overflow and underflow)
-static inline int16_t safe_add( int16_t a, int16_t b )
-{
-	if ( a > 0 && b > INT16_MAX - a )
-		return INT16_MAX;
-	else if ( a < 0 && b < INT16_MIN - a )
-		return INT16_MIN;
-	return a + b;
-}
+//! Rendered samples are summed here, so the compiler can't skip rendering in benchmark()
+volatile uint8_t benchmark_sink;
 
-// A 16-bit overflow/underflow-safe digital integrator
-typedef int16_t integrator;
-static inline integrator integrator_feed( integrator *i, integrator x )
-{
-	return *i = safe_add( *i, x );
-	// return *i += x;
-}
-
-//! A 1 pole filter based on the above integrator
-//! \see integrator
-typedef int8_t audio_signal;
-typedef integrator filter1pole;
-static inline audio_signal filter1pole_feed( filter1pole *f, int8_t k, audio_signal x )
+/**
+	Renders given number of seconds of audio as fast as possible and reports the speed.
+	The CSV format is: engine,wavetable,voices,samples,seconds,ns_per_sample,samples_per_sec,x_realtime
+*/
+void benchmark( unsigned int wavetable, float seconds, int csv )
 {
-	integrator_feed( f, ( x - ( *f / 256 ) ) * k );
-	return *f / 256;
+	unsigned long samples = seconds * SAMPLING_FREQ;
+	uint8_t acc = 0;
+
+	double start = get_time();
+	for ( unsigned long i = 0; i < samples; i++ )
+		acc += render_sample();
+	double elapsed = get_time() - start;
+	benchmark_sink = acc;
+
+	double rate = samples / elapsed;
+	if ( csv )
+		printf( "avr_filter,%u,1,%lu,%.6f,%.3f,%.0f,%.2f\n", wavetable, samples, elapsed, 1e9 / rate, rate, rate / SAMPLING_FREQ );
+	else
+		printf( "samples: %lu, time: %.3f s, %.2f ns/sample, %.0f samples/s, %.2fx realtime\n", samples, elapsed, 1e9 / rate, rate, rate / SAMPLING_FREQ );
 }
 
 int main( int argc, char **argv )
 {
+	unsigned int wavetable = 18;
+	float bench_seconds = 0;
+	int csv = 0;
+
+	// Command line options
+	int opt;
+	while ( ( opt = getopt( argc, argv, "b:mt:w:" ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			// Benchmark
+			case 'b':
+				if ( sscanf( optarg, "%f", &bench_seconds ) != 1 || bench_seconds <= 0 )
+				{
+					fprintf( stderr, "invalid benchmark length\n" );
+					return 1;
+				}
+				break;
+
+			// Machine-readable benchmark output
+			case 'm':
+				csv = 1;
+				break;
+
+			// Filter output
+			case 't':
+				if ( !strcmp( optarg, "lp" ) )
+					filter_out = &filter.lp;
+				else if ( !strcmp( optarg, "bp" ) )
+					filter_out = &filter.bp;
+				else if ( !strcmp( optarg, "hp" ) )
+					filter_out = &filter.hp;
+				else
+				{
+					fprintf( stderr, "invalid filter output\n" );
+					return 1;
+				}
+				break;
+
+			// Wavetable index
+			case 'w':
+				if ( sscanf( optarg, "%u", &wavetable ) != 1 || wavetable >= WAVETABLE_COUNT )
+				{
+					fprintf( stderr, "invalid wavetable index\n" );
+					return 1;
+				}
+				break;
+
+			default:
+				fprintf( stderr, "Usage: %s [-b SECONDS] [-m] [-t lp|bp|hp] [-w WAVETABLE]\n", argv[0] );
+				fprintf( stderr, "\t-b - benchmark - render given number of seconds of audio and report speed\n" );
+				fprintf( stderr, "\t-m - machine-readable (CSV) benchmark output\n" );
+				fprintf( stderr, "\t-t - filter output - low-pass, band-pass or high-pass\n" );
+				fprintf( stderr, "\t-w - wavetable index (0 - %d)\n", WAVETABLE_COUNT - 1 );
+				return 1;
+		}
+	}
+
 	// Load wavetable
-	load_wavetable_n( current_wavetable, DEFAULT_WAVETABLE_SIZE, ppg_wavetable, 18 );
+	load_compact_wavetable_n( &current_wavetable, ppg_wavetable, wavetable );
+	voice_init( &voice, &current_wavetable, PITCH( NOTE ), VOICE_LEVEL_UNITY );
+	modulation_init();
 
-	// The main loop
-	while ( 1 )
+	if ( bench_seconds > 0 )
 	{
-		// DDS
-		static uint16_t phase = 0;
-		static float f = 62;
-		uint16_t phase_step = 65536 * f / SAMPLING_FREQ;
-
-		// Time counter
-		static uint32_t cnt = 0;
-		static float t = 0;
-		cnt++;
-		t = (float)cnt / SAMPLING_FREQ;
-
-		// Waveform generation
-		uint8_t sample = get_current_wavetable_sample( 30 + 30 * sin( t ), phase  );
-
-		// Two 1-pole filters chained together
-		audio_signal x = sample - 127;
-		int8_t k = 64 + sin( 32 * t ) * 30;
-		static filter1pole Fa = 0, Fb = 0;
-		audio_signal y = filter1pole_feed( &Fb, k, filter1pole_feed( &Fa, k, x ) );
-
-		// Audio output and phase stepping
-		putchar( 127 + y );
-		phase += phase_step;
+		benchmark( wavetable, bench_seconds, csv );
+		return 0;
 	}
 
+	// The main loop
+	while ( 1 )
+		putchar( render_sample() );
+
 	return 0;
 }
 
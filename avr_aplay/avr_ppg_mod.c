@@ -0,0 +1,124 @@
+#include <inttypes.h>
+#include "avr_ppg_mod.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#include "pgmspace_shim.h"
+#endif
+
+//! First quarter of sine (0 to 127) with 64 steps and the end point
+static const uint8_t lfo_sine_table[65] PROGMEM =
+{
+	  0,   3,   6,   9,  12,  16,  19,  22,
+	 25,  28,  31,  34,  37,  40,  43,  46,
+	 49,  51,  54,  57,  60,  63,  65,  68,
+	 71,  73,  76,  78,  81,  83,  85,  88,
+	 90,  92,  94,  96,  98, 100, 102, 104,
+	106, 107, 109, 111, 112, 113, 115, 116,
+	117, 118, 120, 121, 122, 122, 123, 124,
+	125, 125, 126, 126, 126, 127, 127, 127,
+	127
+};
+
+//! Initializes an LFO - see LFO_PHASE_STEP()
+void lfo_init( struct lfo *lfo, uint8_t shape, uint16_t phase_step )
+{
+	lfo->phase = 0;
+	lfo->phase_step = phase_step;
+	lfo->shape = shape;
+}
+
+//! Advances LFO by one control tick and returns its value (-127 to 127)
+int8_t lfo_update( struct lfo *lfo )
+{
+	lfo->phase += lfo->phase_step;
+	uint8_t phase = lfo->phase >> 8;
+
+	switch ( lfo->shape )
+	{
+		case LFO_SINE:
+		{
+			// Quarter-wave table, mirrored and inverted
+			uint8_t index = phase & 63;
+			if ( phase & 64 ) index = 64 - index;
+			int8_t x = pgm_read_byte( lfo_sine_table + index );
+			return ( phase & 128 ) ? -x : x;
+		}
+
+		case LFO_TRIANGLE:
+		{
+			// Rises in the first and last quarter, falls in between
+			uint8_t x = phase + 64;
+			return ( x & 128 ) ? 127 - ( ( x & 127 ) << 1 ) : -127 + ( x << 1 );
+		}
+
+		case LFO_SAW:
+			return (int8_t)( phase - 128 ) | 1;
+
+		default:
+			return 0;
+	}
+}
+
+//! Initializes an envelope generator - see ADSR_STEP() and ADSR_SUSTAIN()
+void adsr_init( struct adsr *eg, uint16_t attack, uint16_t decay, uint16_t sustain, uint16_t release )
+{
+	eg->level = 0;
+	eg->attack = attack;
+	eg->decay = decay;
+	eg->sustain = sustain;
+	eg->release = release;
+	eg->stage = ADSR_IDLE;
+}
+
+//! Starts (note on) or releases (note off) the envelope
+void adsr_gate( struct adsr *eg, uint8_t on )
+{
+	eg->stage = on ? ADSR_ATTACK : ADSR_RELEASE;
+}
+
+//! Advances the envelope by one control tick and returns its level (0 to 255)
+uint8_t adsr_update( struct adsr *eg )
+{
+	uint16_t level = eg->level;
+
+	switch ( eg->stage )
+	{
+		case ADSR_ATTACK:
+			if ( level > UINT16_MAX - eg->attack )
+			{
+				level = UINT16_MAX;
+				eg->stage = ADSR_DECAY;
+			}
+			else
+				level += eg->attack;
+			break;
+
+		case ADSR_DECAY:
+			if ( level <= eg->sustain || level - eg->sustain <= eg->decay )
+			{
+				level = eg->sustain;
+				eg->stage = ADSR_SUSTAIN;
+			}
+			else
+				level -= eg->decay;
+			break;
+
+		case ADSR_RELEASE:
+			if ( level < eg->release )
+			{
+				level = 0;
+				eg->stage = ADSR_IDLE;
+			}
+			else
+				level -= eg->release;
+			break;
+
+		default:
+			break;
+	}
+
+	eg->level = level;
+	return level >> 8;
+}
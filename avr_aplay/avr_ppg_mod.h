@@ -0,0 +1,82 @@
+#ifndef AVR_PPG_MOD_H
+#define AVR_PPG_MOD_H
+
+#include <inttypes.h>
+
+/**
+	\file avr_ppg_mod.h
+	\author Jacek Wieczorek
+
+	\brief Integer-only LFOs and ADSR envelope generators for the fixed-point engine.
+
+	Both are meant to be updated at a control rate (once every few samples) and use only 8/16-bit
+	integer math - there's no float and no division at runtime. The LFO_PHASE_STEP() and ADSR_STEP()
+	macros compute the increments at compile time.
+*/
+
+//! LFO phase step for given frequency (in Hz) at given control rate (in Hz)
+#define LFO_PHASE_STEP( freq, control_rate ) ( (uint16_t)( 65536.0 * ( freq ) / ( control_rate ) + 0.5 ) )
+
+//! Envelope increment per control tick for a full-scale segment lasting ms milliseconds
+#define ADSR_STEP( ms, control_rate ) ( (uint16_t)( 65535.0 * 1000 / ( (double)( ms ) * ( control_rate ) ) + 1 ) )
+
+//! Sustain level from 0 to 255
+#define ADSR_SUSTAIN( level ) ( (uint16_t)( level ) << 8 )
+
+//! LFO shapes
+enum lfo_shape
+{
+	LFO_SINE,
+	LFO_TRIANGLE,
+	LFO_SAW
+};
+
+//! A low-frequency oscillator with 16-bit phase
+struct lfo
+{
+	uint16_t phase;
+	uint16_t phase_step;
+	uint8_t shape;
+};
+
+//! ADSR envelope stages
+enum adsr_stage
+{
+	ADSR_IDLE,
+	ADSR_ATTACK,
+	ADSR_DECAY,
+	ADSR_SUSTAIN,
+	ADSR_RELEASE
+};
+
+//! A linear ADSR envelope generator with 16-bit level
+struct adsr
+{
+	uint16_t level;
+	uint16_t attack;   //!< Level increment per tick in attack stage
+	uint16_t decay;    //!< Level decrement per tick in decay stage
+	uint16_t sustain;  //!< Sustain level
+	uint16_t release;  //!< Level decrement per tick in release stage
+	uint8_t stage;
+};
+
+void lfo_init( struct lfo *lfo, uint8_t shape, uint16_t phase_step );
+int8_t lfo_update( struct lfo *lfo );
+
+void adsr_init( struct adsr *eg, uint16_t attack, uint16_t decay, uint16_t sustain, uint16_t release );
+void adsr_gate( struct adsr *eg, uint8_t on );
+uint8_t adsr_update( struct adsr *eg );
+
+//! Scales a -127 to 127 modulation value to -depth to depth
+static inline int8_t mod_scale( int8_t x, uint8_t depth )
+{
+	return ( (int16_t) x * depth ) >> 7;
+}
+
+//! Scales a 0 to 255 envelope value to 0 to depth
+static inline uint8_t eg_scale( uint8_t x, uint8_t depth )
+{
+	return ( (uint16_t) x * depth ) >> 8;
+}
+
+#endif
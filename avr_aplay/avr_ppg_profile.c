@@ -0,0 +1,318 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "avr_ppg_engine.h"
+
+/**
+	\file avr_ppg_profile.c
+	\author Jacek Wieczorek
+
+	\brief Cycle count profiling of the fixed-point engine.
+
+	This is meant to be compiled for an ATmega and run under simavr (see 'make profile'), so the cycle budget
+	can be tracked without a physical board. Each function is called PROFILE_RUNS times in a loop and the
+	cycles are counted with Timer 1 running at F_CPU. The cost of an empty loop is subtracted, so the results
+	are approximate. They're printed over UART, which simavr forwards to the console. Once done, the CPU goes
+	to sleep with interrupts disabled, which makes simavr quit.
+*/
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+//! Sampling frequency the budget is computed for
+#define SAMPLING_FREQ 20000
+
+//! Number of CPU cycles available per sample
+#define CYCLE_BUDGET ( F_CPU / SAMPLING_FREQ )
+
+//! Number of calls averaged for each function
+#define PROFILE_RUNS 256
+
+//! Number of voices in the polyphony profile and how often their slots are updated
+#define POLY_VOICES 4
+#define POLY_CONTROL_PERIOD 32
+
+//! UART baud rate (irrelevant under simavr, but has to be something)
+#define UART_BAUD 38400
+
+//! Contains currently used wavetable (in both representations)
+static struct wavetable_entry current_wavetable[DEFAULT_WAVETABLE_SIZE];
+static struct compact_wavetable current_compact_wavetable;
+
+//! Voices for the polyphony profile, each with its own wavetable
+static struct compact_wavetable voice_wavetables[POLY_VOICES];
+static struct voice voices[POLY_VOICES];
+
+//! Results of the profiled calls end up here, so they're not optimized out
+volatile uint8_t profile_sink;
+
+//! Timer 1 overflow counter - extends the timer to 32 bits
+static volatile uint16_t timer_overflows;
+
+ISR( TIMER1_OVF_vect )
+{
+	timer_overflows++;
+}
+
+//! Returns number of CPU cycles since the timer was started
+static uint32_t get_cycles( void )
+{
+	uint8_t sreg = SREG;
+	cli();
+	uint16_t low = TCNT1;
+	uint16_t high = timer_overflows;
+
+	// Overflow that hasn't been handled yet
+	if ( ( TIFR1 & _BV( TOV1 ) ) && low < 0x8000 )
+		high++;
+
+	SREG = sreg;
+	return ( (uint32_t) high << 16 ) | low;
+}
+
+//! Sends a character over UART
+static int uart_putchar( char c, FILE *f )
+{
+	loop_until_bit_is_set( UCSR0A, UDRE0 );
+	UDR0 = c;
+	return 0;
+}
+
+static FILE uart_stream = FDEV_SETUP_STREAM( uart_putchar, NULL, _FDEV_SETUP_WRITE );
+
+//! Empty loop of the same shape as the profiled ones
+static uint32_t profile_empty( void )
+{
+	uint8_t slot = 0;
+	uint16_t phase = 0;
+	uint8_t acc = 0;
+
+	uint32_t start = get_cycles();
+	for ( uint16_t i = 0; i < PROFILE_RUNS; i++ )
+	{
+		acc += slot + ( phase >> 8 );
+		phase += 1337;
+		if ( ++slot == DEFAULT_WAVETABLE_SIZE ) slot = 0;
+	}
+	uint32_t cycles = get_cycles() - start;
+
+	profile_sink = acc;
+	return cycles;
+}
+
+//! Wavetable lookup with the slot and phase changing on each call
+static uint32_t profile_wavetable_sample( void )
+{
+	uint8_t slot = 0;
+	uint16_t phase = 0;
+	uint8_t acc = 0;
+
+	uint32_t start = get_cycles();
+	for ( uint16_t i = 0; i < PROFILE_RUNS; i++ )
+	{
+		acc += get_wavetable_sample( current_wavetable + slot, phase );
+		phase += 1337;
+		if ( ++slot == DEFAULT_WAVETABLE_SIZE ) slot = 0;
+	}
+	uint32_t cycles = get_cycles() - start;
+
+	profile_sink = acc;
+	return cycles;
+}
+
+//! Same as above, but with the reference C implementation
+static uint32_t profile_wavetable_sample_ref( void )
+{
+	uint8_t slot = 0;
+	uint16_t phase = 0;
+	uint8_t acc = 0;
+
+	uint32_t start = get_cycles();
+	for ( uint16_t i = 0; i < PROFILE_RUNS; i++ )
+	{
+		acc += get_wavetable_sample_ref( current_wavetable + slot, phase );
+		phase += 1337;
+		if ( ++slot == DEFAULT_WAVETABLE_SIZE ) slot = 0;
+	}
+	uint32_t cycles = get_cycles() - start;
+
+	profile_sink = acc;
+	return cycles;
+}
+
+//! Compares get_wavetable_sample() with the reference on all slots and phases, returns number of mismatches
+static uint16_t check_wavetable_sample( void )
+{
+	uint16_t mismatches = 0;
+	for ( uint8_t slot = 0; slot < DEFAULT_WAVETABLE_SIZE; slot++ )
+	{
+		uint16_t phase = 0;
+		do
+		{
+			if ( get_wavetable_sample( current_wavetable + slot, phase ) != get_wavetable_sample_ref( current_wavetable + slot, phase ) )
+				mismatches++;
+			phase += 256;
+		}
+		while ( phase != 0 );
+	}
+	return mismatches;
+}
+
+//! State-variable filter fed with a sawtooth
+static uint32_t profile_svf( void )
+{
+	uint8_t slot = 0;
+	uint16_t phase = 0;
+	uint8_t acc = 0;
+	struct svf f = { 0 };
+
+	uint32_t start = get_cycles();
+	for ( uint16_t i = 0; i < PROFILE_RUNS; i++ )
+	{
+		svf_feed( &f, 4 * slot, 48, phase >> 8 );
+		acc += svf_output( f.lp );
+		phase += 1337;
+		if ( ++slot == DEFAULT_WAVETABLE_SIZE ) slot = 0;
+	}
+	uint32_t cycles = get_cycles() - start;
+
+	profile_sink = acc;
+	return cycles;
+}
+
+//! Loads all wavetables one after another
+static uint32_t profile_load_wavetable( void )
+{
+	const uint8_t *data = ppg_wavetable;
+
+	uint32_t start = get_cycles();
+	for ( uint8_t i = 0; i < WAVETABLE_COUNT; i++ )
+		data = load_wavetable( current_wavetable, DEFAULT_WAVETABLE_SIZE, data );
+	return get_cycles() - start;
+}
+
+//! Loads all wavetables one after another into a compact wavetable
+static uint32_t profile_load_compact_wavetable( void )
+{
+	const uint8_t *data = ppg_wavetable;
+
+	uint32_t start = get_cycles();
+	for ( uint8_t i = 0; i < WAVETABLE_COUNT; i++ )
+		data = load_compact_wavetable( &current_compact_wavetable, data );
+	return get_cycles() - start;
+}
+
+//! Derives entries for all slots of a compact wavetable
+static uint32_t profile_compact_wavetable_entry( void )
+{
+	struct wavetable_entry e;
+	uint8_t acc = 0;
+
+	uint32_t start = get_cycles();
+	for ( uint8_t slot = 0; slot < DEFAULT_WAVETABLE_SIZE; slot++ )
+	{
+		get_compact_wavetable_entry( &current_compact_wavetable, slot, &e );
+		acc += e.factor;
+	}
+	uint32_t cycles = get_cycles() - start;
+
+	profile_sink = acc;
+	return cycles;
+}
+
+/**
+	Renders samples of POLY_VOICES voices, changing slots of all of them every POLY_CONTROL_PERIOD samples
+	(worst case - entries are re-derived every time). This includes the loop overhead.
+*/
+static uint32_t profile_voices( void )
+{
+	for ( uint8_t i = 0; i < POLY_VOICES; i++ )
+	{
+		load_compact_wavetable_n( &voice_wavetables[i], ppg_wavetable, 18 + i );
+		voice_init( &voices[i], &voice_wavetables[i], PITCH( 35 + 4 * i ), VOICE_LEVEL_UNITY / 2 );
+	}
+
+	uint8_t slot = 0;
+	uint8_t acc = 0;
+
+	uint32_t start = get_cycles();
+	for ( uint16_t i = 0; i < PROFILE_RUNS; i++ )
+	{
+		if ( i % POLY_CONTROL_PERIOD == 0 )
+		{
+			if ( ++slot == DEFAULT_WAVETABLE_SIZE ) slot = 0;
+			for ( uint8_t j = 0; j < POLY_VOICES; j++ )
+				voice_set_slot( &voices[j], slot );
+		}
+
+		acc += render_voices_sample( voices, POLY_VOICES );
+	}
+	uint32_t cycles = get_cycles() - start;
+
+	profile_sink = acc;
+	return cycles;
+}
+
+//! Prints cycles per call and the percentage of the per-sample budget
+static void report( const char *name, uint32_t cycles, uint16_t calls )
+{
+	uint32_t per_call = ( cycles + calls / 2 ) / calls;
+	printf( "%s: %lu cycles/call (%lu%% of %lu cycle budget)\n", name,
+		(unsigned long) per_call, (unsigned long)( per_call * 100 / CYCLE_BUDGET ), (unsigned long) CYCLE_BUDGET );
+}
+
+int main( void )
+{
+	// UART for reporting
+	UBRR0 = F_CPU / 16 / UART_BAUD - 1;
+	UCSR0B = _BV( TXEN0 );
+	stdout = &uart_stream;
+
+	// Timer 1 counts CPU cycles
+	TCCR1A = 0;
+	TCCR1B = _BV( CS10 );
+	TIMSK1 = _BV( TOIE1 );
+	sei();
+
+	// Load a wavetable first, so there's something to play
+	uint32_t load = profile_load_wavetable();
+	uint32_t load_compact = profile_load_compact_wavetable();
+	load_wavetable_n( current_wavetable, DEFAULT_WAVETABLE_SIZE, ppg_wavetable, 18 );
+	load_compact_wavetable_n( &current_compact_wavetable, ppg_wavetable, 18 );
+	uint32_t derive = profile_compact_wavetable_entry();
+
+	uint32_t empty = profile_empty();
+	uint32_t lookup = profile_wavetable_sample() - empty;
+	uint32_t lookup_ref = profile_wavetable_sample_ref() - empty;
+	uint32_t filter = profile_svf() - empty;
+	uint32_t poly = profile_voices();
+
+	printf( "F_CPU: %lu Hz, sampling frequency: %u Hz\n", (unsigned long) F_CPU, SAMPLING_FREQ );
+	report( "get_current_wavetable_sample", lookup, PROFILE_RUNS );
+	report( "get_current_wavetable_sample (C reference)", lookup_ref, PROFILE_RUNS );
+	printf( "assembly vs reference mismatches: %u\n", check_wavetable_sample() );
+	report( "svf_feed", filter, PROFILE_RUNS );
+	report( "sample with filter", lookup + filter, PROFILE_RUNS );
+	report( "render_voices_sample with slot updates", poly, PROFILE_RUNS );
+	printf( "headroom with %d voices: %ld cycles/sample\n", POLY_VOICES,
+		(long) CYCLE_BUDGET - (long)( ( poly + PROFILE_RUNS / 2 ) / PROFILE_RUNS ) );
+	report( "load_wavetable", load, WAVETABLE_COUNT );
+	report( "load_compact_wavetable", load_compact, WAVETABLE_COUNT );
+	report( "get_compact_wavetable_entry", derive, DEFAULT_WAVETABLE_SIZE );
+
+	// SRAM needed for each voice to hold its own wavetable
+	printf( "SRAM per voice: %u bytes (wavetable_entry array), %u bytes (compact wavetable + current entry)\n",
+		(unsigned) sizeof( current_wavetable ),
+		(unsigned)( sizeof( struct compact_wavetable ) + sizeof( struct wavetable_entry ) ) );
+
+	// Make simavr quit
+	cli();
+	sleep_enable();
+	sleep_cpu();
+
+	return 0;
+}
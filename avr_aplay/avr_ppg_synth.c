@@ -0,0 +1,154 @@
+#include <inttypes.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "avr_ppg_engine.h"
+#include "avr_ppg_mod.h"
+
+/**
+	\file avr_ppg_synth.c
+	\author Jacek Wieczorek
+
+	\brief The wavetable synthesizer running on an actual ATmega.
+
+	Samples are output by a timer interrupt at exactly SAMPLING_FREQ. Timer 1 (CTC mode) triggers the ISR,
+	which writes the next sample to Timer 0 running as 8-bit fast PWM on OC0A (PD6 on ATmega328P). The PWM
+	output needs a simple RC low-pass filter.
+
+	The ISR only copies samples from a double buffer. When it finishes playing one half, it switches to the
+	other one and lets the main loop know. The main loop then renders a whole block into the half that's no
+	longer played. This way, all the wavetable math stays out of the ISR, and the output timing doesn't depend
+	on how long rendering of a particular sample takes (as long as a block is rendered in time on average).
+
+	VOICE_COUNT voices are played, each with its own wavetable (see struct compact_wavetable) and slot LFO.
+*/
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+//! Output sampling frequency
+#define SAMPLING_FREQ 20000
+
+//! Size of each half of the output buffer
+#define AUDIO_BLOCK_SIZE 32
+
+//! Number of voices
+#define VOICE_COUNT 4
+
+#if SAMPLING_FREQ != NOTE_TABLE_SAMPLING_FREQ
+#error note_phase_steps is computed for a different sampling frequency
+#endif
+
+//! MIDI note of the lowest voice (B1, about 62 Hz)
+#define BASE_NOTE 35
+
+//! Modulation is updated once per block
+#define CONTROL_RATE ( SAMPLING_FREQ / AUDIO_BLOCK_SIZE )
+
+//! Frequency of the LFO sweeping through the wavetable
+#define SLOT_LFO_FREQ 0.16
+
+//! Each voice plays its own wavetable
+static struct compact_wavetable voice_wavetables[VOICE_COUNT];
+static struct voice voices[VOICE_COUNT];
+
+//! The double buffer - the ISR plays one half while the other one is rendered
+static uint8_t audio_buffer[2][AUDIO_BLOCK_SIZE];
+
+//! Buffer half currently being played and position in it
+static volatile uint8_t play_half;
+static uint8_t play_pos;
+
+//! Set by the ISR when a buffer half is free to be rendered
+static volatile uint8_t render_pending;
+
+//! Counts blocks that weren't rendered in time
+static volatile uint8_t underruns;
+
+//! The LFOs sweeping through the wavetables
+static struct lfo slot_lfo[VOICE_COUNT];
+
+//! Outputs one sample
+ISR( TIMER1_COMPA_vect )
+{
+	OCR0A = audio_buffer[play_half][play_pos];
+
+	if ( ++play_pos == AUDIO_BLOCK_SIZE )
+	{
+		play_pos = 0;
+		play_half ^= 1;
+
+		// The main loop hasn't picked up the previous block yet
+		if ( render_pending ) underruns++;
+		render_pending = 1;
+	}
+}
+
+//! Renders a block of samples
+static void render_block( uint8_t *out )
+{
+	for ( uint8_t i = 0; i < VOICE_COUNT; i++ )
+		voice_set_slot( &voices[i], 30 + mod_scale( lfo_update( &slot_lfo[i] ), 30 ) );
+
+	for ( uint8_t i = 0; i < AUDIO_BLOCK_SIZE; i++ )
+		out[i] = render_voices_sample( voices, VOICE_COUNT );
+}
+
+//! Sets up the voices - a major chord with an octave on top
+static void voices_init( void )
+{
+	static const uint8_t intervals[VOICE_COUNT] = { 0, 4, 7, 12 };
+
+	for ( uint8_t i = 0; i < VOICE_COUNT; i++ )
+	{
+		load_compact_wavetable_n( &voice_wavetables[i], ppg_wavetable, 18 + i );
+		voice_init( &voices[i], &voice_wavetables[i], PITCH( BASE_NOTE + intervals[i] ), VOICE_LEVEL_UNITY * 2 / ( VOICE_COUNT + 1 ) );
+		lfo_init( &slot_lfo[i], LFO_SINE, LFO_PHASE_STEP( SLOT_LFO_FREQ, CONTROL_RATE ) );
+		slot_lfo[i].phase = i * ( 65536 / VOICE_COUNT );
+	}
+}
+
+//! Sets up PWM output and the sample rate timer
+static void audio_init( void )
+{
+	// Output pin
+	DDRD |= _BV( PD6 );
+
+	// Timer 0 - fast PWM on OC0A, no prescaler
+	TCCR0A = _BV( COM0A1 ) | _BV( WGM01 ) | _BV( WGM00 );
+	TCCR0B = _BV( CS00 );
+	OCR0A = 128;
+
+	// Timer 1 - CTC mode, interrupt at the sampling frequency
+	TCCR1A = 0;
+	TCCR1B = _BV( WGM12 ) | _BV( CS10 );
+	OCR1A = F_CPU / SAMPLING_FREQ - 1;
+	TIMSK1 = _BV( OCIE1A );
+}
+
+int main( void )
+{
+	voices_init();
+
+	// Fill both halves before starting the output
+	render_block( audio_buffer[0] );
+	render_block( audio_buffer[1] );
+
+	audio_init();
+	set_sleep_mode( SLEEP_MODE_IDLE );
+	sei();
+
+	while ( 1 )
+	{
+		// Sleep until a buffer half is free (each sample interrupt wakes us up)
+		while ( !render_pending )
+			sleep_mode();
+
+		render_pending = 0;
+		render_block( audio_buffer[play_half ^ 1] );
+	}
+
+	return 0;
+}
@@ -0,0 +1,21 @@
+#ifndef PGMSPACE_SHIM_H
+#define PGMSPACE_SHIM_H
+
+#include <inttypes.h>
+
+/**
+	\file pgmspace_shim.h
+	\author Jacek Wieczorek
+
+	\brief Host replacement for <avr/pgmspace.h>
+
+	On the host, program memory is just ordinary memory, so PROGMEM does nothing
+	and pgm_read_*() are plain reads.
+*/
+
+#define PROGMEM
+#define pgm_read_byte( addr ) ( *(const uint8_t *)( addr ) )
+#define pgm_read_word( addr ) ( *(const uint16_t *)( addr ) )
+#define pgm_read_dword( addr ) ( *(const uint32_t *)( addr ) )
+
+#endif
@@ -0,0 +1,21 @@
+#!/bin/bash
+cd "$(dirname "$0")"
+
+# Benchmarks all engines on every wavetable and prints results as CSV.
+# Run 'make bench' to build optimized binaries first.
+
+# Length of each run in seconds of audio (at 20 kHz)
+BENCH_LENGTH=${BENCH_LENGTH:-20}
+
+echo "engine,wavetable,voices,samples,seconds,ns_per_sample,samples_per_sec,x_realtime"
+
+for n in {0..28}; do
+	for k in scalar sse2 avx2; do
+		# Kernels the CPU can't run get a row with empty results (the reason goes to stderr)
+		./ppg_aplay_bench -b $BENCH_LENGTH -m -k $k -w $n || echo "float_$k,$n,1,,,,,"
+	done
+	for v in 1 4; do
+		./avr_aplay/avr_ppg_aplay_bench -b $BENCH_LENGTH -m -v $v -w $n
+	done
+	./avr_aplay/avr_ppg_filter_aplay_bench -b $BENCH_LENGTH -m -w $n
+done;
@@ -0,0 +1,40 @@
+#!/bin/bash
+cd "$(dirname "$0")"
+
+# Checks that all render kernels produce bit-identical output (which is what makes switching
+# between them at runtime safe). Every wavetable is rendered by every kernel with 16 voices,
+# with and without mipmaps, and the raw F32 output is compared against the scalar kernel.
+# Run 'make check' to build the program and run it.
+
+# Bytes of F32 output compared per run (16384 samples)
+CHECK_BYTES=65536
+
+failures=0
+checked=0
+ref=$(mktemp)
+out=$(mktemp)
+trap 'rm -f "$ref" "$out"' EXIT
+
+for k in sse2 avx2; do
+	if ! ./ppg_aplay -k $k -b 0.001 > /dev/null; then
+		echo "$k: skipped"
+		continue
+	fi
+
+	for n in {0..28}; do
+		for a in "" "-a"; do
+			./ppg_aplay -k scalar -f f32 -v 16 -w $n $a | head -c $CHECK_BYTES > "$ref"
+			./ppg_aplay -k $k -f f32 -v 16 -w $n $a | head -c $CHECK_BYTES > "$out"
+			checked=$((checked + 1))
+
+			# Short output means the program failed, which must not pass as a match
+			if [ $(stat -c %s "$ref") -ne $CHECK_BYTES ] || ! cmp -s "$ref" "$out"; then
+				echo "mismatch: kernel $k, wavetable $n $a"
+				failures=$((failures + 1))
+			fi
+		done
+	done
+done
+
+echo "$checked kernel runs checked against scalar, $failures mismatches"
+[ $failures -eq 0 ]
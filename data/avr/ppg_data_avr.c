@@ -1,17165 +0,0 @@
-#include <inttypes.h>
-#include <avr/pgmspace.h>
-#include "ppg_data_avr.h"
-
-
-const uint8_t ppg_wavetable[] PROGMEM = {
-	0x00, // 0x00000000
-	0x65,
-	0x00,
-	0x45,
-	0x08,
-	0x46,
-	0x10,
-	0x47,
-	0x18,
-	0x48,
-	0x20,
-	0x49,
-	0x28,
-	0x4a,
-	0x30,
-	0x4b,
-	0x3c, // 0x00000010
-	0x01,
-	0x4d,
-	0x00,
-	0x4e,
-	0x08,
-	0x4f,
-	0x10,
-	0x50,
-	0x18,
-	0x51,
-	0x20,
-	0x52,
-	0x28,
-	0x53,
-	0x30,
-	0x54, // 0x00000020
-	0x3c,
-	0x02,
-	0x65,
-	0x00,
-	0x2f,
-	0x1e,
-	0x83,
-	0x26,
-	0x84,
-	0x2e,
-	0x8d,
-	0x36,
-	0x8e,
-	0x3c,
-	0x03,
-	0x65, // 0x00000030
-	0x00,
-	0x5e,
-	0x08,
-	0x5f,
-	0x10,
-	0x60,
-	0x18,
-	0x61,
-	0x20,
-	0x62,
-	0x28,
-	0x64,
-	0x3c,
-	0x04,
-	0x02,
-	0x00, // 0x00000040
-	0x01,
-	0x18,
-	0x00,
-	0x30,
-	0x01,
-	0x3c,
-	0x05,
-	0x83,
-	0x00,
-	0x84,
-	0x08,
-	0x8d,
-	0x10,
-	0x8e,
-	0x18,
-	0x8f, // 0x00000050
-	0x20,
-	0x90,
-	0x3c,
-	0x06,
-	0x65,
-	0x00,
-	0x36,
-	0x08,
-	0x37,
-	0x10,
-	0x38,
-	0x18,
-	0x39,
-	0x20,
-	0x58,
-	0x28, // 0x00000060
-	0x59,
-	0x30,
-	0x35,
-	0x36,
-	0x68,
-	0x3c,
-	0x07,
-	0x72,
-	0x00,
-	0x73,
-	0x14,
-	0x74,
-	0x28,
-	0x63,
-	0x3c,
-	0x08, // 0x00000070
-	0x6c,
-	0x00,
-	0x41,
-	0x18,
-	0x3f,
-	0x28,
-	0x5a,
-	0x3c,
-	0x09,
-	0x65,
-	0x00,
-	0x3d,
-	0x08,
-	0x3e,
-	0x10,
-	0x3f, // 0x00000080
-	0x18,
-	0x42,
-	0x20,
-	0x43,
-	0x28,
-	0x44,
-	0x3c,
-	0x0a,
-	0x2a,
-	0x00,
-	0x2b,
-	0x0e,
-	0x2c,
-	0x1e,
-	0x2d,
-	0x2e, // 0x00000090
-	0x2e,
-	0x3c,
-	0x0b,
-	0x29,
-	0x00,
-	0x28,
-	0x10,
-	0x27,
-	0x20,
-	0x26,
-	0x30,
-	0x25,
-	0x3c,
-	0x0c,
-	0x65,
-	0x00, // 0x000000a0
-	0x36,
-	0x08,
-	0x37,
-	0x10,
-	0x38,
-	0x18,
-	0x39,
-	0x20,
-	0x3a,
-	0x28,
-	0x3b,
-	0x30,
-	0x3c,
-	0x3c,
-	0x0d,
-	0xf1, // 0x000000b0
-	0x00,
-	0xf2,
-	0x08,
-	0xf3,
-	0x10,
-	0xf4,
-	0x18,
-	0xf5,
-	0x20,
-	0xf1,
-	0x28,
-	0xf2,
-	0x30,
-	0xf3,
-	0x3c,
-	0x0e, // 0x000000c0
-	0x65,
-	0x00,
-	0x05,
-	0x0c,
-	0x06,
-	0x18,
-	0x55,
-	0x24,
-	0x08,
-	0x30,
-	0x30,
-	0x3c,
-	0x0f,
-	0x0c,
-	0x00,
-	0x0b, // 0x000000d0
-	0x14,
-	0x35,
-	0x32,
-	0x68,
-	0x3c,
-	0x10,
-	0x92,
-	0x00,
-	0x93,
-	0x02,
-	0x94,
-	0x04,
-	0x95,
-	0x06,
-	0x96,
-	0x08, // 0x000000e0
-	0x97,
-	0x0a,
-	0x98,
-	0x0c,
-	0x99,
-	0x0e,
-	0x9a,
-	0x10,
-	0x9b,
-	0x12,
-	0x9c,
-	0x14,
-	0x9d,
-	0x16,
-	0x9e,
-	0x18, // 0x000000f0
-	0x9f,
-	0x1a,
-	0xa0,
-	0x1c,
-	0xa1,
-	0x1e,
-	0xa2,
-	0x20,
-	0xa3,
-	0x22,
-	0xa4,
-	0x24,
-	0xa5,
-	0x26,
-	0xa6,
-	0x28, // 0x00000100
-	0xa7,
-	0x2a,
-	0xa8,
-	0x2c,
-	0xa9,
-	0x2e,
-	0xaa,
-	0x30,
-	0xab,
-	0x32,
-	0xac,
-	0x34,
-	0xad,
-	0x36,
-	0xae,
-	0x38, // 0x00000110
-	0xaf,
-	0x3a,
-	0xb0,
-	0x3c,
-	0x17,
-	0x6a,
-	0x00,
-	0x6d,
-	0x08,
-	0x71,
-	0x0e,
-	0x5a,
-	0x16,
-	0x0d,
-	0x1c,
-	0x71, // 0x00000120
-	0x3c,
-	0x12,
-	0x55,
-	0x00,
-	0x55,
-	0x08,
-	0x56,
-	0x10,
-	0x5b,
-	0x18,
-	0x3e,
-	0x20,
-	0x47,
-	0x28,
-	0x56,
-	0x30, // 0x00000130
-	0x55,
-	0x38,
-	0x55,
-	0x3c,
-	0x13,
-	0x75,
-	0x00,
-	0x75,
-	0x1c,
-	0x74,
-	0x28,
-	0x77,
-	0x34,
-	0x77,
-	0x3c,
-	0x14, // 0x00000140
-	0x65,
-	0x00,
-	0x65,
-	0x03,
-	0x50,
-	0x04,
-	0x50,
-	0x07,
-	0x45,
-	0x08,
-	0x45,
-	0x0b,
-	0x51,
-	0x0c,
-	0x51,
-	0x0f, // 0x00000150
-	0x46,
-	0x10,
-	0x46,
-	0x13,
-	0x52,
-	0x14,
-	0x52,
-	0x17,
-	0x47,
-	0x18,
-	0x47,
-	0x1b,
-	0x53,
-	0x1c,
-	0x53,
-	0x1f, // 0x00000160
-	0x48,
-	0x20,
-	0x48,
-	0x23,
-	0x54,
-	0x24,
-	0x54,
-	0x27,
-	0x49,
-	0x28,
-	0x49,
-	0x2b,
-	0x55,
-	0x2c,
-	0x55,
-	0x2f, // 0x00000170
-	0x4a,
-	0x30,
-	0x4a,
-	0x3c,
-	0x21,
-	0x20,
-	0x00,
-	0x1e,
-	0x0c,
-	0x1d,
-	0x11,
-	0x1c,
-	0x16,
-	0x1b,
-	0x1b,
-	0x1a, // 0x00000180
-	0x20,
-	0x19,
-	0x25,
-	0x18,
-	0x2a,
-	0x17,
-	0x2e,
-	0x16,
-	0x32,
-	0x15,
-	0x36,
-	0x15,
-	0x3c,
-	0x22,
-	0x20,
-	0x00, // 0x00000190
-	0x21,
-	0x0e,
-	0x20,
-	0x0f,
-	0x22,
-	0x1d,
-	0x20,
-	0x1e,
-	0x23,
-	0x2b,
-	0x20,
-	0x2c,
-	0x24,
-	0x3c,
-	0x17,
-	0x88, // 0x000001a0
-	0x00,
-	0x88,
-	0x08,
-	0x89,
-	0x14,
-	0x8a,
-	0x20,
-	0x8b,
-	0x2c,
-	0x8c,
-	0x38,
-	0x8c,
-	0x3c,
-	0x18,
-	0x6a,
-	0x00, // 0x000001b0
-	0x6b,
-	0x0a,
-	0x6c,
-	0x14,
-	0x6d,
-	0x1e,
-	0x6e,
-	0x28,
-	0x6f,
-	0x32,
-	0x70,
-	0x3c,
-	0x25,
-	0x65,
-	0x00,
-	0x70, // 0x000001c0
-	0x10,
-	0x65,
-	0x11,
-	0x71,
-	0x20,
-	0x65,
-	0x21,
-	0x70,
-	0x30,
-	0x65,
-	0x31,
-	0x5b,
-	0x3c,
-	0x1a,
-	0xb2,
-	0x00, // 0x000001d0
-	0xb3,
-	0x02,
-	0xb4,
-	0x04,
-	0xb5,
-	0x06,
-	0xb6,
-	0x08,
-	0xb7,
-	0x0a,
-	0xb8,
-	0x0c,
-	0xb9,
-	0x0e,
-	0xba,
-	0x10, // 0x000001e0
-	0xbb,
-	0x12,
-	0xbc,
-	0x14,
-	0xbd,
-	0x16,
-	0xbe,
-	0x18,
-	0xbf,
-	0x1a,
-	0xc0,
-	0x1c,
-	0xc1,
-	0x1e,
-	0xc2,
-	0x20, // 0x000001f0
-	0xc3,
-	0x22,
-	0xc4,
-	0x24,
-	0xc5,
-	0x26,
-	0xc6,
-	0x28,
-	0xc7,
-	0x2a,
-	0xc8,
-	0x2c,
-	0xc9,
-	0x2e,
-	0xca,
-	0x30, // 0x00000200
-	0xcb,
-	0x32,
-	0xcc,
-	0x34,
-	0xcd,
-	0x36,
-	0xce,
-	0x38,
-	0xcf,
-	0x3a,
-	0xd0,
-	0x3c,
-	0x1b,
-	0xd3,
-	0x00,
-	0xd4, // 0x00000210
-	0x02,
-	0xd5,
-	0x04,
-	0xd6,
-	0x06,
-	0xd7,
-	0x08,
-	0xd8,
-	0x0a,
-	0xd9,
-	0x0c,
-	0xda,
-	0x0e,
-	0xdb,
-	0x10,
-	0xdc, // 0x00000220
-	0x12,
-	0xdd,
-	0x14,
-	0xde,
-	0x16,
-	0xdf,
-	0x18,
-	0xe0,
-	0x1a,
-	0xe1,
-	0x1c,
-	0xe2,
-	0x1e,
-	0xe3,
-	0x20,
-	0xe4, // 0x00000230
-	0x22,
-	0xe5,
-	0x24,
-	0xe6,
-	0x26,
-	0xe7,
-	0x28,
-	0xe8,
-	0x2a,
-	0xe9,
-	0x2c,
-	0xea,
-	0x2e,
-	0xeb,
-	0x30,
-	0xec, // 0x00000240
-	0x32,
-	0xed,
-	0x34,
-	0xee,
-	0x36,
-	0xef,
-	0x38,
-	0xf0,
-	0x3a,
-	0xf1,
-	0x3c,
-	0x28,
-	0x37,
-	0x00,
-	0x61,
-	0x0c, // 0x00000250
-	0x46,
-	0x0e,
-	0x74,
-	0x10,
-	0x47,
-	0x12,
-	0x29,
-	0x14,
-	0x7c,
-	0x16,
-	0x8a,
-	0x18,
-	0x01,
-	0x1a,
-	0x50,
-	0x1c, // 0x00000260
-	0x2b,
-	0x1e,
-	0x95,
-	0x20,
-	0x75,
-	0x22,
-	0x42,
-	0x24,
-	0x55,
-	0x26,
-	0x1b,
-	0x28,
-	0x26,
-	0x2a,
-	0x2c,
-	0x2c, // 0x00000270
-	0x52,
-	0x2e,
-	0x67,
-	0x30,
-	0x08,
-	0x32,
-	0x6b,
-	0x34,
-	0x6d,
-	0x36,
-	0x41,
-	0x38,
-	0x6c,
-	0x3a,
-	0x65,
-	0x3c, // 0x00000280
-	0xad,
-	0xda,
-	0x21,
-	0x2d,
-	0x36,
-	0x40,
-	0x48,
-	0x50,
-	0x57,
-	0x5c,
-	0x61,
-	0x64,
-	0x66,
-	0x67,
-	0x66,
-	0x65, // 0x00000290
-	0x62,
-	0x5e,
-	0x59,
-	0x54,
-	0x4f,
-	0x4a,
-	0x43,
-	0x3a,
-	0x34,
-	0x2c,
-	0x25,
-	0x1e,
-	0x17,
-	0x10,
-	0x0a,
-	0x05, // 0x000002a0
-	0xff,
-	0xfb,
-	0xf6,
-	0xf4,
-	0xef,
-	0xec,
-	0xe9,
-	0xe6,
-	0xe6,
-	0xe5,
-	0xe4,
-	0xe4,
-	0xe4,
-	0xe5,
-	0xe5,
-	0xe6, // 0x000002b0
-	0xe8,
-	0xe9,
-	0xea,
-	0xeb,
-	0xec,
-	0xee,
-	0xef,
-	0xf0,
-	0xf2,
-	0xf3,
-	0xf6,
-	0xf6,
-	0xf9,
-	0xf9,
-	0xfd,
-	0xff, // 0x000002c0
-	0x0d,
-	0x1a,
-	0x25,
-	0x30,
-	0x3a,
-	0x42,
-	0x49,
-	0x4c,
-	0x4e,
-	0x4c,
-	0x49,
-	0x45,
-	0x3d,
-	0x36,
-	0x2c,
-	0x22, // 0x000002d0
-	0x18,
-	0x0e,
-	0x06,
-	0xfc,
-	0xf5,
-	0xef,
-	0xea,
-	0xe9,
-	0xe8,
-	0xe7,
-	0xeb,
-	0xee,
-	0xf3,
-	0xf9,
-	0x01,
-	0x09, // 0x000002e0
-	0x12,
-	0x1a,
-	0x21,
-	0x28,
-	0x2d,
-	0x33,
-	0x35,
-	0x37,
-	0x37,
-	0x34,
-	0x2f,
-	0x2a,
-	0x23,
-	0x1c,
-	0x13,
-	0x0b, // 0x000002f0
-	0x04,
-	0xfb,
-	0xf3,
-	0xeb,
-	0xe5,
-	0xe1,
-	0xde,
-	0xdc,
-	0xdc,
-	0xdd,
-	0xe0,
-	0xe5,
-	0xea,
-	0xf0,
-	0xf7,
-};
-
-
-const uint8_t ppg_waveforms[] PROGMEM = {
-	131,	// -------- wave 000 (00h), sample 00
-	162,	// sample 01
-	188,	// sample 02
-	205,	// sample 03
-	211,	// sample 04
-	208,	// sample 05
-	196,	// sample 06
-	181,	// sample 07
-	164,	// sample 08
-	150,	// sample 09
-	141,	// sample 10
-	134,	// sample 11
-	132,	// sample 12
-	126,	// sample 13
-	119,	// sample 14
-	108,	// sample 15
-	 96,	// sample 16
-	 82,	// sample 17
-	 70,	// sample 18
-	 65,	// sample 19
-	 68,	// sample 20
-	 81,	// sample 21
-	101,	// sample 22
-	125,	// sample 23
-	149,	// sample 24
-	167,	// sample 25
-	178,	// sample 26
-	178,	// sample 27
-	169,	// sample 28
-	154,	// sample 29
-	134,	// sample 30
-	115,	// sample 31
-	103,	// sample 32
-	 97,	// sample 33
-	 98,	// sample 34
-	105,	// sample 35
-	114,	// sample 36
-	122,	// sample 37
-	127,	// sample 38
-	129,	// sample 39
-	127,	// sample 40
-	126,	// sample 41
-	125,	// sample 42
-	130,	// sample 43
-	142,	// sample 44
-	156,	// sample 45
-	171,	// sample 46
-	186,	// sample 47
-	194,	// sample 48
-	193,	// sample 49
-	182,	// sample 50
-	161,	// sample 51
-	132,	// sample 52
-	102,	// sample 53
-	 75,	// sample 54
-	 54,	// sample 55
-	 45,	// sample 56
-	 47,	// sample 57
-	 55,	// sample 58
-	 71,	// sample 59
-	 87,	// sample 60
-	103,	// sample 61
-	114,	// sample 62
-	124,	// sample 63
-	129,	// -------- wave 001 (01h), sample 00
-	167,	// sample 01
-	196,	// sample 02
-	213,	// sample 03
-	219,	// sample 04
-	215,	// sample 05
-	201,	// sample 06
-	185,	// sample 07
-	169,	// sample 08
-	156,	// sample 09
-	147,	// sample 10
-	142,	// sample 11
-	139,	// sample 12
-	135,	// sample 13
-	130,	// sample 14
-	124,	// sample 15
-	118,	// sample 16
-	115,	// sample 17
-	115,	// sample 18
-	120,	// sample 19
-	128,	// sample 20
-	140,	// sample 21
-	150,	// sample 22
-	156,	// sample 23
-	161,	// sample 24
-	160,	// sample 25
-	155,	// sample 26
-	149,	// sample 27
-	140,	// sample 28
-	134,	// sample 29
-	127,	// sample 30
-	124,	// sample 31
-	121,	// sample 32
-	119,	// sample 33
-	119,	// sample 34
-	119,	// sample 35
-	119,	// sample 36
-	117,	// sample 37
-	117,	// sample 38
-	115,	// sample 39
-	113,	// sample 40
-	108,	// sample 41
-	104,	// sample 42
-	103,	// sample 43
-	103,	// sample 44
-	111,	// sample 45
-	121,	// sample 46
-	134,	// sample 47
-	148,	// sample 48
-	159,	// sample 49
-	161,	// sample 50
-	152,	// sample 51
-	136,	// sample 52
-	112,	// sample 53
-	 88,	// sample 54
-	 63,	// sample 55
-	 47,	// sample 56
-	 41,	// sample 57
-	 43,	// sample 58
-	 56,	// sample 59
-	 71,	// sample 60
-	 88,	// sample 61
-	103,	// sample 62
-	118,	// sample 63
-	130,	// -------- wave 002 (02h), sample 00
-	164,	// sample 01
-	192,	// sample 02
-	214,	// sample 03
-	225,	// sample 04
-	227,	// sample 05
-	223,	// sample 06
-	210,	// sample 07
-	194,	// sample 08
-	178,	// sample 09
-	162,	// sample 10
-	150,	// sample 11
-	141,	// sample 12
-	136,	// sample 13
-	134,	// sample 14
-	133,	// sample 15
-	134,	// sample 16
-	133,	// sample 17
-	138,	// sample 18
-	142,	// sample 19
-	146,	// sample 20
-	151,	// sample 21
-	157,	// sample 22
-	161,	// sample 23
-	163,	// sample 24
-	163,	// sample 25
-	160,	// sample 26
-	154,	// sample 27
-	145,	// sample 28
-	139,	// sample 29
-	133,	// sample 30
-	128,	// sample 31
-	126,	// sample 32
-	128,	// sample 33
-	130,	// sample 34
-	135,	// sample 35
-	136,	// sample 36
-	134,	// sample 37
-	130,	// sample 38
-	123,	// sample 39
-	116,	// sample 40
-	109,	// sample 41
-	102,	// sample 42
-	102,	// sample 43
-	106,	// sample 44
-	116,	// sample 45
-	127,	// sample 46
-	138,	// sample 47
-	149,	// sample 48
-	152,	// sample 49
-	151,	// sample 50
-	141,	// sample 51
-	128,	// sample 52
-	106,	// sample 53
-	 86,	// sample 54
-	 66,	// sample 55
-	 50,	// sample 56
-	 42,	// sample 57
-	 38,	// sample 58
-	 43,	// sample 59
-	 53,	// sample 60
-	 69,	// sample 61
-	 88,	// sample 62
-	108,	// sample 63
-	132,	// -------- wave 003 (03h), sample 00
-	211,	// sample 01
-	241,	// sample 02
-	223,	// sample 03
-	198,	// sample 04
-	191,	// sample 05
-	192,	// sample 06
-	200,	// sample 07
-	215,	// sample 08
-	223,	// sample 09
-	214,	// sample 10
-	191,	// sample 11
-	183,	// sample 12
-	183,	// sample 13
-	184,	// sample 14
-	173,	// sample 15
-	160,	// sample 16
-	143,	// sample 17
-	131,	// sample 18
-	122,	// sample 19
-	130,	// sample 20
-	148,	// sample 21
-	154,	// sample 22
-	145,	// sample 23
-	131,	// sample 24
-	119,	// sample 25
-	119,	// sample 26
-	130,	// sample 27
-	150,	// sample 28
-	163,	// sample 29
-	168,	// sample 30
-	170,	// sample 31
-	176,	// sample 32
-	181,	// sample 33
-	180,	// sample 34
-	171,	// sample 35
-	164,	// sample 36
-	163,	// sample 37
-	165,	// sample 38
-	164,	// sample 39
-	164,	// sample 40
-	167,	// sample 41
-	160,	// sample 42
-	165,	// sample 43
-	167,	// sample 44
-	167,	// sample 45
-	169,	// sample 46
-	164,	// sample 47
-	164,	// sample 48
-	168,	// sample 49
-	164,	// sample 50
-	162,	// sample 51
-	160,	// sample 52
-	160,	// sample 53
-	153,	// sample 54
-	143,	// sample 55
-	149,	// sample 56
-	150,	// sample 57
-	141,	// sample 58
-	135,	// sample 59
-	132,	// sample 60
-	130,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	128,	// -------- wave 004 (04h), sample 00
-	128,	// sample 01
-	128,	// sample 02
-	128,	// sample 03
-	128,	// sample 04
-	128,	// sample 05
-	128,	// sample 06
-	128,	// sample 07
-	128,	// sample 08
-	128,	// sample 09
-	128,	// sample 10
-	128,	// sample 11
-	128,	// sample 12
-	128,	// sample 13
-	128,	// sample 14
-	128,	// sample 15
-	128,	// sample 16
-	128,	// sample 17
-	128,	// sample 18
-	128,	// sample 19
-	128,	// sample 20
-	128,	// sample 21
-	128,	// sample 22
-	128,	// sample 23
-	128,	// sample 24
-	128,	// sample 25
-	128,	// sample 26
-	128,	// sample 27
-	128,	// sample 28
-	128,	// sample 29
-	128,	// sample 30
-	128,	// sample 31
-	128,	// sample 32
-	128,	// sample 33
-	128,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	128,	// sample 39
-	128,	// sample 40
-	128,	// sample 41
-	128,	// sample 42
-	128,	// sample 43
-	128,	// sample 44
-	128,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	128,	// sample 48
-	128,	// sample 49
-	128,	// sample 50
-	128,	// sample 51
-	128,	// sample 52
-	128,	// sample 53
-	128,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	128,	// sample 57
-	128,	// sample 58
-	128,	// sample 59
-	128,	// sample 60
-	128,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	130,	// -------- wave 005 (05h), sample 00
-	152,	// sample 01
-	169,	// sample 02
-	185,	// sample 03
-	197,	// sample 04
-	205,	// sample 05
-	206,	// sample 06
-	204,	// sample 07
-	196,	// sample 08
-	185,	// sample 09
-	172,	// sample 10
-	159,	// sample 11
-	145,	// sample 12
-	132,	// sample 13
-	124,	// sample 14
-	119,	// sample 15
-	117,	// sample 16
-	121,	// sample 17
-	130,	// sample 18
-	141,	// sample 19
-	157,	// sample 20
-	173,	// sample 21
-	190,	// sample 22
-	206,	// sample 23
-	218,	// sample 24
-	226,	// sample 25
-	230,	// sample 26
-	230,	// sample 27
-	224,	// sample 28
-	214,	// sample 29
-	199,	// sample 30
-	181,	// sample 31
-	164,	// sample 32
-	146,	// sample 33
-	129,	// sample 34
-	115,	// sample 35
-	105,	// sample 36
-	 97,	// sample 37
-	 98,	// sample 38
-	101,	// sample 39
-	109,	// sample 40
-	121,	// sample 41
-	135,	// sample 42
-	151,	// sample 43
-	163,	// sample 44
-	177,	// sample 45
-	185,	// sample 46
-	191,	// sample 47
-	193,	// sample 48
-	188,	// sample 49
-	179,	// sample 50
-	167,	// sample 51
-	153,	// sample 52
-	134,	// sample 53
-	116,	// sample 54
-	 99,	// sample 55
-	 88,	// sample 56
-	 78,	// sample 57
-	 72,	// sample 58
-	 72,	// sample 59
-	 77,	// sample 60
-	 85,	// sample 61
-	 97,	// sample 62
-	113,	// sample 63
-	132,	// -------- wave 006 (06h), sample 00
-	160,	// sample 01
-	185,	// sample 02
-	203,	// sample 03
-	211,	// sample 04
-	211,	// sample 05
-	202,	// sample 06
-	190,	// sample 07
-	177,	// sample 08
-	167,	// sample 09
-	161,	// sample 10
-	160,	// sample 11
-	166,	// sample 12
-	172,	// sample 13
-	178,	// sample 14
-	182,	// sample 15
-	182,	// sample 16
-	176,	// sample 17
-	166,	// sample 18
-	155,	// sample 19
-	146,	// sample 20
-	138,	// sample 21
-	136,	// sample 22
-	140,	// sample 23
-	150,	// sample 24
-	162,	// sample 25
-	174,	// sample 26
-	184,	// sample 27
-	186,	// sample 28
-	181,	// sample 29
-	166,	// sample 30
-	149,	// sample 31
-	126,	// sample 32
-	105,	// sample 33
-	 89,	// sample 34
-	 82,	// sample 35
-	 83,	// sample 36
-	 91,	// sample 37
-	108,	// sample 38
-	129,	// sample 39
-	150,	// sample 40
-	167,	// sample 41
-	180,	// sample 42
-	188,	// sample 43
-	188,	// sample 44
-	186,	// sample 45
-	182,	// sample 46
-	181,	// sample 47
-	182,	// sample 48
-	185,	// sample 49
-	193,	// sample 50
-	202,	// sample 51
-	207,	// sample 52
-	209,	// sample 53
-	203,	// sample 54
-	192,	// sample 55
-	175,	// sample 56
-	154,	// sample 57
-	132,	// sample 58
-	114,	// sample 59
-	103,	// sample 60
-	 97,	// sample 61
-	103,	// sample 62
-	114,	// sample 63
-	131,	// -------- wave 007 (07h), sample 00
-	176,	// sample 01
-	206,	// sample 02
-	210,	// sample 03
-	188,	// sample 04
-	158,	// sample 05
-	129,	// sample 06
-	114,	// sample 07
-	114,	// sample 08
-	122,	// sample 09
-	126,	// sample 10
-	125,	// sample 11
-	112,	// sample 12
-	 99,	// sample 13
-	 94,	// sample 14
-	 98,	// sample 15
-	112,	// sample 16
-	125,	// sample 17
-	135,	// sample 18
-	134,	// sample 19
-	131,	// sample 20
-	129,	// sample 21
-	137,	// sample 22
-	152,	// sample 23
-	166,	// sample 24
-	171,	// sample 25
-	160,	// sample 26
-	132,	// sample 27
-	 97,	// sample 28
-	 73,	// sample 29
-	 70,	// sample 30
-	 93,	// sample 31
-	131,	// sample 32
-	166,	// sample 33
-	186,	// sample 34
-	182,	// sample 35
-	157,	// sample 36
-	123,	// sample 37
-	 96,	// sample 38
-	 85,	// sample 39
-	 91,	// sample 40
-	106,	// sample 41
-	120,	// sample 42
-	129,	// sample 43
-	126,	// sample 44
-	123,	// sample 45
-	123,	// sample 46
-	132,	// sample 47
-	147,	// sample 48
-	159,	// sample 49
-	162,	// sample 50
-	156,	// sample 51
-	143,	// sample 52
-	131,	// sample 53
-	129,	// sample 54
-	134,	// sample 55
-	141,	// sample 56
-	140,	// sample 57
-	126,	// sample 58
-	 98,	// sample 59
-	 66,	// sample 60
-	 47,	// sample 61
-	 52,	// sample 62
-	 83,	// sample 63
-	132,	// -------- wave 008 (08h), sample 00
-	193,	// sample 01
-	233,	// sample 02
-	245,	// sample 03
-	237,	// sample 04
-	223,	// sample 05
-	211,	// sample 06
-	204,	// sample 07
-	201,	// sample 08
-	196,	// sample 09
-	188,	// sample 10
-	183,	// sample 11
-	177,	// sample 12
-	171,	// sample 13
-	170,	// sample 14
-	172,	// sample 15
-	177,	// sample 16
-	180,	// sample 17
-	179,	// sample 18
-	166,	// sample 19
-	157,	// sample 20
-	146,	// sample 21
-	143,	// sample 22
-	147,	// sample 23
-	149,	// sample 24
-	148,	// sample 25
-	141,	// sample 26
-	130,	// sample 27
-	121,	// sample 28
-	121,	// sample 29
-	124,	// sample 30
-	141,	// sample 31
-	162,	// sample 32
-	178,	// sample 33
-	184,	// sample 34
-	178,	// sample 35
-	166,	// sample 36
-	150,	// sample 37
-	141,	// sample 38
-	139,	// sample 39
-	142,	// sample 40
-	145,	// sample 41
-	142,	// sample 42
-	135,	// sample 43
-	125,	// sample 44
-	115,	// sample 45
-	111,	// sample 46
-	112,	// sample 47
-	120,	// sample 48
-	130,	// sample 49
-	141,	// sample 50
-	142,	// sample 51
-	139,	// sample 52
-	134,	// sample 53
-	129,	// sample 54
-	130,	// sample 55
-	124,	// sample 56
-	109,	// sample 57
-	 93,	// sample 58
-	 74,	// sample 59
-	 62,	// sample 60
-	 70,	// sample 61
-	 84,	// sample 62
-	107,	// sample 63
-	130,	// -------- wave 009 (09h), sample 00
-	158,	// sample 01
-	180,	// sample 02
-	203,	// sample 03
-	219,	// sample 04
-	231,	// sample 05
-	236,	// sample 06
-	240,	// sample 07
-	236,	// sample 08
-	230,	// sample 09
-	222,	// sample 10
-	210,	// sample 11
-	199,	// sample 12
-	185,	// sample 13
-	171,	// sample 14
-	159,	// sample 15
-	150,	// sample 16
-	139,	// sample 17
-	130,	// sample 18
-	123,	// sample 19
-	116,	// sample 20
-	112,	// sample 21
-	108,	// sample 22
-	108,	// sample 23
-	107,	// sample 24
-	108,	// sample 25
-	112,	// sample 26
-	114,	// sample 27
-	117,	// sample 28
-	121,	// sample 29
-	124,	// sample 30
-	126,	// sample 31
-	125,	// sample 32
-	125,	// sample 33
-	123,	// sample 34
-	123,	// sample 35
-	119,	// sample 36
-	116,	// sample 37
-	113,	// sample 38
-	110,	// sample 39
-	112,	// sample 40
-	111,	// sample 41
-	114,	// sample 42
-	117,	// sample 43
-	120,	// sample 44
-	126,	// sample 45
-	133,	// sample 46
-	142,	// sample 47
-	147,	// sample 48
-	156,	// sample 49
-	166,	// sample 50
-	176,	// sample 51
-	188,	// sample 52
-	197,	// sample 53
-	206,	// sample 54
-	211,	// sample 55
-	217,	// sample 56
-	217,	// sample 57
-	218,	// sample 58
-	210,	// sample 59
-	200,	// sample 60
-	185,	// sample 61
-	166,	// sample 62
-	149,	// sample 63
-	130,	// -------- wave 010 (0ah), sample 00
-	161,	// sample 01
-	187,	// sample 02
-	209,	// sample 03
-	224,	// sample 04
-	234,	// sample 05
-	241,	// sample 06
-	239,	// sample 07
-	234,	// sample 08
-	225,	// sample 09
-	215,	// sample 10
-	201,	// sample 11
-	186,	// sample 12
-	169,	// sample 13
-	156,	// sample 14
-	139,	// sample 15
-	128,	// sample 16
-	116,	// sample 17
-	112,	// sample 18
-	109,	// sample 19
-	110,	// sample 20
-	112,	// sample 21
-	114,	// sample 22
-	120,	// sample 23
-	124,	// sample 24
-	128,	// sample 25
-	132,	// sample 26
-	138,	// sample 27
-	141,	// sample 28
-	142,	// sample 29
-	141,	// sample 30
-	142,	// sample 31
-	143,	// sample 32
-	140,	// sample 33
-	139,	// sample 34
-	137,	// sample 35
-	137,	// sample 36
-	131,	// sample 37
-	128,	// sample 38
-	124,	// sample 39
-	120,	// sample 40
-	115,	// sample 41
-	112,	// sample 42
-	110,	// sample 43
-	110,	// sample 44
-	110,	// sample 45
-	113,	// sample 46
-	118,	// sample 47
-	123,	// sample 48
-	129,	// sample 49
-	138,	// sample 50
-	147,	// sample 51
-	158,	// sample 52
-	168,	// sample 53
-	179,	// sample 54
-	189,	// sample 55
-	195,	// sample 56
-	198,	// sample 57
-	200,	// sample 58
-	196,	// sample 59
-	185,	// sample 60
-	172,	// sample 61
-	159,	// sample 62
-	143,	// sample 63
-	129,	// -------- wave 011 (0bh), sample 00
-	186,	// sample 01
-	223,	// sample 02
-	237,	// sample 03
-	229,	// sample 04
-	210,	// sample 05
-	178,	// sample 06
-	152,	// sample 07
-	123,	// sample 08
-	102,	// sample 09
-	 96,	// sample 10
-	 98,	// sample 11
-	108,	// sample 12
-	121,	// sample 13
-	130,	// sample 14
-	136,	// sample 15
-	139,	// sample 16
-	140,	// sample 17
-	136,	// sample 18
-	129,	// sample 19
-	124,	// sample 20
-	123,	// sample 21
-	119,	// sample 22
-	122,	// sample 23
-	121,	// sample 24
-	123,	// sample 25
-	124,	// sample 26
-	128,	// sample 27
-	135,	// sample 28
-	138,	// sample 29
-	146,	// sample 30
-	147,	// sample 31
-	148,	// sample 32
-	147,	// sample 33
-	144,	// sample 34
-	142,	// sample 35
-	134,	// sample 36
-	135,	// sample 37
-	128,	// sample 38
-	121,	// sample 39
-	116,	// sample 40
-	113,	// sample 41
-	119,	// sample 42
-	119,	// sample 43
-	127,	// sample 44
-	134,	// sample 45
-	140,	// sample 46
-	140,	// sample 47
-	142,	// sample 48
-	136,	// sample 49
-	125,	// sample 50
-	112,	// sample 51
-	104,	// sample 52
-	 93,	// sample 53
-	 96,	// sample 54
-	106,	// sample 55
-	128,	// sample 56
-	157,	// sample 57
-	188,	// sample 58
-	207,	// sample 59
-	216,	// sample 60
-	205,	// sample 61
-	180,	// sample 62
-	157,	// sample 63
-	131,	// -------- wave 012 (0ch), sample 00
-	160,	// sample 01
-	184,	// sample 02
-	206,	// sample 03
-	223,	// sample 04
-	236,	// sample 05
-	242,	// sample 06
-	244,	// sample 07
-	240,	// sample 08
-	231,	// sample 09
-	220,	// sample 10
-	205,	// sample 11
-	190,	// sample 12
-	172,	// sample 13
-	158,	// sample 14
-	143,	// sample 15
-	133,	// sample 16
-	124,	// sample 17
-	117,	// sample 18
-	114,	// sample 19
-	114,	// sample 20
-	114,	// sample 21
-	115,	// sample 22
-	119,	// sample 23
-	123,	// sample 24
-	125,	// sample 25
-	129,	// sample 26
-	131,	// sample 27
-	134,	// sample 28
-	135,	// sample 29
-	135,	// sample 30
-	136,	// sample 31
-	136,	// sample 32
-	136,	// sample 33
-	135,	// sample 34
-	134,	// sample 35
-	133,	// sample 36
-	131,	// sample 37
-	129,	// sample 38
-	124,	// sample 39
-	123,	// sample 40
-	118,	// sample 41
-	117,	// sample 42
-	114,	// sample 43
-	114,	// sample 44
-	115,	// sample 45
-	120,	// sample 46
-	126,	// sample 47
-	134,	// sample 48
-	146,	// sample 49
-	160,	// sample 50
-	175,	// sample 51
-	192,	// sample 52
-	207,	// sample 53
-	221,	// sample 54
-	232,	// sample 55
-	239,	// sample 56
-	242,	// sample 57
-	240,	// sample 58
-	231,	// sample 59
-	219,	// sample 60
-	199,	// sample 61
-	177,	// sample 62
-	153,	// sample 63
-	134,	// -------- wave 013 (0dh), sample 00
-	162,	// sample 01
-	157,	// sample 02
-	229,	// sample 03
-	132,	// sample 04
-	165,	// sample 05
-	165,	// sample 06
-	 87,	// sample 07
-	 71,	// sample 08
-	167,	// sample 09
-	240,	// sample 10
-	200,	// sample 11
-	135,	// sample 12
-	148,	// sample 13
-	201,	// sample 14
-	208,	// sample 15
-	175,	// sample 16
-	148,	// sample 17
-	127,	// sample 18
-	 87,	// sample 19
-	 60,	// sample 20
-	 82,	// sample 21
-	138,	// sample 22
-	166,	// sample 23
-	158,	// sample 24
-	152,	// sample 25
-	147,	// sample 26
-	110,	// sample 27
-	 51,	// sample 28
-	 30,	// sample 29
-	 76,	// sample 30
-	141,	// sample 31
-	156,	// sample 32
-	128,	// sample 33
-	119,	// sample 34
-	157,	// sample 35
-	170,	// sample 36
-	141,	// sample 37
-	108,	// sample 38
-	121,	// sample 39
-	152,	// sample 40
-	152,	// sample 41
-	114,	// sample 42
-	 91,	// sample 43
-	117,	// sample 44
-	163,	// sample 45
-	188,	// sample 46
-	171,	// sample 47
-	135,	// sample 48
-	 97,	// sample 49
-	 88,	// sample 50
-	103,	// sample 51
-	122,	// sample 52
-	128,	// sample 53
-	144,	// sample 54
-	157,	// sample 55
-	150,	// sample 56
-	102,	// sample 57
-	 68,	// sample 58
-	 90,	// sample 59
-	133,	// sample 60
-	121,	// sample 61
-	 59,	// sample 62
-	 49,	// sample 63
-	132,	// -------- wave 014 (0eh), sample 00
-	180,	// sample 01
-	217,	// sample 02
-	242,	// sample 03
-	251,	// sample 04
-	253,	// sample 05
-	250,	// sample 06
-	239,	// sample 07
-	224,	// sample 08
-	209,	// sample 09
-	201,	// sample 10
-	194,	// sample 11
-	195,	// sample 12
-	189,	// sample 13
-	187,	// sample 14
-	182,	// sample 15
-	178,	// sample 16
-	170,	// sample 17
-	168,	// sample 18
-	161,	// sample 19
-	158,	// sample 20
-	153,	// sample 21
-	152,	// sample 22
-	153,	// sample 23
-	152,	// sample 24
-	148,	// sample 25
-	135,	// sample 26
-	127,	// sample 27
-	113,	// sample 28
-	105,	// sample 29
-	 99,	// sample 30
-	 97,	// sample 31
-	100,	// sample 32
-	106,	// sample 33
-	114,	// sample 34
-	122,	// sample 35
-	131,	// sample 36
-	135,	// sample 37
-	141,	// sample 38
-	144,	// sample 39
-	144,	// sample 40
-	142,	// sample 41
-	142,	// sample 42
-	141,	// sample 43
-	145,	// sample 44
-	148,	// sample 45
-	143,	// sample 46
-	134,	// sample 47
-	125,	// sample 48
-	117,	// sample 49
-	111,	// sample 50
-	109,	// sample 51
-	107,	// sample 52
-	104,	// sample 53
-	106,	// sample 54
-	111,	// sample 55
-	118,	// sample 56
-	122,	// sample 57
-	125,	// sample 58
-	128,	// sample 59
-	129,	// sample 60
-	134,	// sample 61
-	136,	// sample 62
-	133,	// sample 63
-	131,	// -------- wave 015 (0fh), sample 00
-	164,	// sample 01
-	191,	// sample 02
-	216,	// sample 03
-	233,	// sample 04
-	243,	// sample 05
-	246,	// sample 06
-	239,	// sample 07
-	231,	// sample 08
-	214,	// sample 09
-	194,	// sample 10
-	174,	// sample 11
-	154,	// sample 12
-	129,	// sample 13
-	110,	// sample 14
-	 95,	// sample 15
-	 83,	// sample 16
-	 73,	// sample 17
-	 73,	// sample 18
-	 74,	// sample 19
-	 83,	// sample 20
-	 93,	// sample 21
-	107,	// sample 22
-	121,	// sample 23
-	138,	// sample 24
-	153,	// sample 25
-	163,	// sample 26
-	174,	// sample 27
-	184,	// sample 28
-	187,	// sample 29
-	188,	// sample 30
-	189,	// sample 31
-	185,	// sample 32
-	178,	// sample 33
-	169,	// sample 34
-	160,	// sample 35
-	152,	// sample 36
-	141,	// sample 37
-	134,	// sample 38
-	127,	// sample 39
-	122,	// sample 40
-	119,	// sample 41
-	117,	// sample 42
-	118,	// sample 43
-	119,	// sample 44
-	122,	// sample 45
-	125,	// sample 46
-	132,	// sample 47
-	137,	// sample 48
-	140,	// sample 49
-	144,	// sample 50
-	146,	// sample 51
-	147,	// sample 52
-	145,	// sample 53
-	144,	// sample 54
-	140,	// sample 55
-	139,	// sample 56
-	137,	// sample 57
-	135,	// sample 58
-	136,	// sample 59
-	134,	// sample 60
-	134,	// sample 61
-	132,	// sample 62
-	132,	// sample 63
-	128,	// -------- wave 016 (10h), sample 00
-	190,	// sample 01
-	222,	// sample 02
-	222,	// sample 03
-	203,	// sample 04
-	180,	// sample 05
-	162,	// sample 06
-	146,	// sample 07
-	142,	// sample 08
-	146,	// sample 09
-	149,	// sample 10
-	148,	// sample 11
-	143,	// sample 12
-	132,	// sample 13
-	128,	// sample 14
-	131,	// sample 15
-	135,	// sample 16
-	144,	// sample 17
-	154,	// sample 18
-	158,	// sample 19
-	157,	// sample 20
-	150,	// sample 21
-	146,	// sample 22
-	134,	// sample 23
-	127,	// sample 24
-	123,	// sample 25
-	123,	// sample 26
-	128,	// sample 27
-	131,	// sample 28
-	132,	// sample 29
-	137,	// sample 30
-	136,	// sample 31
-	135,	// sample 32
-	141,	// sample 33
-	147,	// sample 34
-	146,	// sample 35
-	146,	// sample 36
-	144,	// sample 37
-	151,	// sample 38
-	147,	// sample 39
-	146,	// sample 40
-	138,	// sample 41
-	135,	// sample 42
-	131,	// sample 43
-	137,	// sample 44
-	136,	// sample 45
-	129,	// sample 46
-	128,	// sample 47
-	125,	// sample 48
-	119,	// sample 49
-	117,	// sample 50
-	114,	// sample 51
-	118,	// sample 52
-	123,	// sample 53
-	131,	// sample 54
-	134,	// sample 55
-	138,	// sample 56
-	137,	// sample 57
-	131,	// sample 58
-	127,	// sample 59
-	125,	// sample 60
-	130,	// sample 61
-	130,	// sample 62
-	128,	// sample 63
-	131,	// -------- wave 017 (11h), sample 00
-	145,	// sample 01
-	157,	// sample 02
-	168,	// sample 03
-	179,	// sample 04
-	190,	// sample 05
-	200,	// sample 06
-	209,	// sample 07
-	216,	// sample 08
-	223,	// sample 09
-	228,	// sample 10
-	232,	// sample 11
-	235,	// sample 12
-	236,	// sample 13
-	237,	// sample 14
-	237,	// sample 15
-	235,	// sample 16
-	231,	// sample 17
-	228,	// sample 18
-	224,	// sample 19
-	219,	// sample 20
-	216,	// sample 21
-	209,	// sample 22
-	203,	// sample 23
-	198,	// sample 24
-	192,	// sample 25
-	186,	// sample 26
-	181,	// sample 27
-	175,	// sample 28
-	169,	// sample 29
-	166,	// sample 30
-	161,	// sample 31
-	158,	// sample 32
-	154,	// sample 33
-	150,	// sample 34
-	148,	// sample 35
-	147,	// sample 36
-	142,	// sample 37
-	141,	// sample 38
-	140,	// sample 39
-	138,	// sample 40
-	137,	// sample 41
-	135,	// sample 42
-	133,	// sample 43
-	132,	// sample 44
-	130,	// sample 45
-	130,	// sample 46
-	128,	// sample 47
-	129,	// sample 48
-	127,	// sample 49
-	126,	// sample 50
-	126,	// sample 51
-	125,	// sample 52
-	125,	// sample 53
-	124,	// sample 54
-	122,	// sample 55
-	122,	// sample 56
-	124,	// sample 57
-	124,	// sample 58
-	125,	// sample 59
-	126,	// sample 60
-	126,	// sample 61
-	125,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 018 (12h), sample 00
-	150,	// sample 01
-	165,	// sample 02
-	181,	// sample 03
-	195,	// sample 04
-	208,	// sample 05
-	218,	// sample 06
-	226,	// sample 07
-	230,	// sample 08
-	233,	// sample 09
-	235,	// sample 10
-	232,	// sample 11
-	228,	// sample 12
-	222,	// sample 13
-	216,	// sample 14
-	207,	// sample 15
-	196,	// sample 16
-	184,	// sample 17
-	174,	// sample 18
-	162,	// sample 19
-	154,	// sample 20
-	142,	// sample 21
-	134,	// sample 22
-	127,	// sample 23
-	119,	// sample 24
-	114,	// sample 25
-	111,	// sample 26
-	107,	// sample 27
-	105,	// sample 28
-	106,	// sample 29
-	105,	// sample 30
-	107,	// sample 31
-	109,	// sample 32
-	110,	// sample 33
-	113,	// sample 34
-	117,	// sample 35
-	119,	// sample 36
-	120,	// sample 37
-	123,	// sample 38
-	123,	// sample 39
-	126,	// sample 40
-	126,	// sample 41
-	128,	// sample 42
-	128,	// sample 43
-	130,	// sample 44
-	128,	// sample 45
-	130,	// sample 46
-	129,	// sample 47
-	129,	// sample 48
-	128,	// sample 49
-	128,	// sample 50
-	128,	// sample 51
-	129,	// sample 52
-	128,	// sample 53
-	129,	// sample 54
-	129,	// sample 55
-	129,	// sample 56
-	129,	// sample 57
-	129,	// sample 58
-	130,	// sample 59
-	129,	// sample 60
-	129,	// sample 61
-	127,	// sample 62
-	128,	// sample 63
-	129,	// -------- wave 019 (13h), sample 00
-	168,	// sample 01
-	197,	// sample 02
-	225,	// sample 03
-	238,	// sample 04
-	243,	// sample 05
-	237,	// sample 06
-	228,	// sample 07
-	215,	// sample 08
-	197,	// sample 09
-	183,	// sample 10
-	168,	// sample 11
-	155,	// sample 12
-	146,	// sample 13
-	138,	// sample 14
-	132,	// sample 15
-	129,	// sample 16
-	128,	// sample 17
-	129,	// sample 18
-	128,	// sample 19
-	125,	// sample 20
-	127,	// sample 21
-	123,	// sample 22
-	118,	// sample 23
-	116,	// sample 24
-	110,	// sample 25
-	110,	// sample 26
-	109,	// sample 27
-	109,	// sample 28
-	110,	// sample 29
-	114,	// sample 30
-	117,	// sample 31
-	119,	// sample 32
-	121,	// sample 33
-	124,	// sample 34
-	128,	// sample 35
-	126,	// sample 36
-	125,	// sample 37
-	125,	// sample 38
-	124,	// sample 39
-	121,	// sample 40
-	120,	// sample 41
-	119,	// sample 42
-	117,	// sample 43
-	123,	// sample 44
-	126,	// sample 45
-	127,	// sample 46
-	130,	// sample 47
-	134,	// sample 48
-	134,	// sample 49
-	132,	// sample 50
-	132,	// sample 51
-	133,	// sample 52
-	130,	// sample 53
-	132,	// sample 54
-	132,	// sample 55
-	134,	// sample 56
-	135,	// sample 57
-	133,	// sample 58
-	134,	// sample 59
-	129,	// sample 60
-	129,	// sample 61
-	127,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 020 (14h), sample 00
-	176,	// sample 01
-	211,	// sample 02
-	235,	// sample 03
-	244,	// sample 04
-	243,	// sample 05
-	232,	// sample 06
-	217,	// sample 07
-	199,	// sample 08
-	181,	// sample 09
-	162,	// sample 10
-	151,	// sample 11
-	141,	// sample 12
-	131,	// sample 13
-	128,	// sample 14
-	127,	// sample 15
-	125,	// sample 16
-	124,	// sample 17
-	126,	// sample 18
-	123,	// sample 19
-	122,	// sample 20
-	122,	// sample 21
-	121,	// sample 22
-	122,	// sample 23
-	124,	// sample 24
-	123,	// sample 25
-	118,	// sample 26
-	114,	// sample 27
-	109,	// sample 28
-	111,	// sample 29
-	112,	// sample 30
-	118,	// sample 31
-	123,	// sample 32
-	129,	// sample 33
-	130,	// sample 34
-	129,	// sample 35
-	130,	// sample 36
-	127,	// sample 37
-	124,	// sample 38
-	120,	// sample 39
-	121,	// sample 40
-	120,	// sample 41
-	120,	// sample 42
-	125,	// sample 43
-	128,	// sample 44
-	130,	// sample 45
-	133,	// sample 46
-	132,	// sample 47
-	129,	// sample 48
-	129,	// sample 49
-	128,	// sample 50
-	126,	// sample 51
-	130,	// sample 52
-	129,	// sample 53
-	132,	// sample 54
-	130,	// sample 55
-	133,	// sample 56
-	132,	// sample 57
-	132,	// sample 58
-	133,	// sample 59
-	130,	// sample 60
-	132,	// sample 61
-	130,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 021 (15h), sample 00
-	203,	// sample 01
-	243,	// sample 02
-	240,	// sample 03
-	196,	// sample 04
-	135,	// sample 05
-	 82,	// sample 06
-	 51,	// sample 07
-	 54,	// sample 08
-	 84,	// sample 09
-	130,	// sample 10
-	178,	// sample 11
-	213,	// sample 12
-	217,	// sample 13
-	196,	// sample 14
-	154,	// sample 15
-	116,	// sample 16
-	 93,	// sample 17
-	 94,	// sample 18
-	113,	// sample 19
-	140,	// sample 20
-	167,	// sample 21
-	187,	// sample 22
-	188,	// sample 23
-	177,	// sample 24
-	153,	// sample 25
-	130,	// sample 26
-	114,	// sample 27
-	117,	// sample 28
-	131,	// sample 29
-	150,	// sample 30
-	166,	// sample 31
-	174,	// sample 32
-	170,	// sample 33
-	156,	// sample 34
-	134,	// sample 35
-	121,	// sample 36
-	114,	// sample 37
-	117,	// sample 38
-	132,	// sample 39
-	150,	// sample 40
-	164,	// sample 41
-	169,	// sample 42
-	161,	// sample 43
-	145,	// sample 44
-	127,	// sample 45
-	113,	// sample 46
-	108,	// sample 47
-	112,	// sample 48
-	128,	// sample 49
-	146,	// sample 50
-	157,	// sample 51
-	160,	// sample 52
-	154,	// sample 53
-	137,	// sample 54
-	117,	// sample 55
-	109,	// sample 56
-	103,	// sample 57
-	114,	// sample 58
-	125,	// sample 59
-	139,	// sample 60
-	147,	// sample 61
-	148,	// sample 62
-	142,	// sample 63
-	129,	// -------- wave 022 (16h), sample 00
-	186,	// sample 01
-	221,	// sample 02
-	227,	// sample 03
-	209,	// sample 04
-	172,	// sample 05
-	134,	// sample 06
-	 99,	// sample 07
-	 82,	// sample 08
-	 73,	// sample 09
-	 88,	// sample 10
-	109,	// sample 11
-	142,	// sample 12
-	168,	// sample 13
-	184,	// sample 14
-	184,	// sample 15
-	170,	// sample 16
-	147,	// sample 17
-	121,	// sample 18
-	 97,	// sample 19
-	 88,	// sample 20
-	 91,	// sample 21
-	103,	// sample 22
-	123,	// sample 23
-	149,	// sample 24
-	166,	// sample 25
-	170,	// sample 26
-	164,	// sample 27
-	151,	// sample 28
-	131,	// sample 29
-	112,	// sample 30
-	 99,	// sample 31
-	 97,	// sample 32
-	107,	// sample 33
-	120,	// sample 34
-	136,	// sample 35
-	149,	// sample 36
-	154,	// sample 37
-	152,	// sample 38
-	148,	// sample 39
-	137,	// sample 40
-	125,	// sample 41
-	122,	// sample 42
-	113,	// sample 43
-	115,	// sample 44
-	121,	// sample 45
-	125,	// sample 46
-	132,	// sample 47
-	136,	// sample 48
-	139,	// sample 49
-	139,	// sample 50
-	139,	// sample 51
-	137,	// sample 52
-	126,	// sample 53
-	118,	// sample 54
-	117,	// sample 55
-	118,	// sample 56
-	120,	// sample 57
-	127,	// sample 58
-	133,	// sample 59
-	138,	// sample 60
-	143,	// sample 61
-	141,	// sample 62
-	135,	// sample 63
-	130,	// -------- wave 023 (17h), sample 00
-	180,	// sample 01
-	218,	// sample 02
-	237,	// sample 03
-	237,	// sample 04
-	220,	// sample 05
-	190,	// sample 06
-	155,	// sample 07
-	118,	// sample 08
-	 89,	// sample 09
-	 67,	// sample 10
-	 61,	// sample 11
-	 70,	// sample 12
-	 89,	// sample 13
-	117,	// sample 14
-	147,	// sample 15
-	173,	// sample 16
-	190,	// sample 17
-	195,	// sample 18
-	190,	// sample 19
-	173,	// sample 20
-	152,	// sample 21
-	129,	// sample 22
-	105,	// sample 23
-	 92,	// sample 24
-	 86,	// sample 25
-	 90,	// sample 26
-	101,	// sample 27
-	120,	// sample 28
-	141,	// sample 29
-	155,	// sample 30
-	167,	// sample 31
-	173,	// sample 32
-	168,	// sample 33
-	155,	// sample 34
-	141,	// sample 35
-	123,	// sample 36
-	107,	// sample 37
-	101,	// sample 38
-	101,	// sample 39
-	106,	// sample 40
-	116,	// sample 41
-	127,	// sample 42
-	140,	// sample 43
-	151,	// sample 44
-	155,	// sample 45
-	157,	// sample 46
-	153,	// sample 47
-	144,	// sample 48
-	134,	// sample 49
-	123,	// sample 50
-	117,	// sample 51
-	112,	// sample 52
-	110,	// sample 53
-	111,	// sample 54
-	116,	// sample 55
-	122,	// sample 56
-	134,	// sample 57
-	144,	// sample 58
-	143,	// sample 59
-	145,	// sample 60
-	140,	// sample 61
-	135,	// sample 62
-	129,	// sample 63
-	131,	// -------- wave 024 (18h), sample 00
-	160,	// sample 01
-	181,	// sample 02
-	204,	// sample 03
-	221,	// sample 04
-	233,	// sample 05
-	241,	// sample 06
-	242,	// sample 07
-	240,	// sample 08
-	235,	// sample 09
-	225,	// sample 10
-	214,	// sample 11
-	203,	// sample 12
-	191,	// sample 13
-	182,	// sample 14
-	174,	// sample 15
-	167,	// sample 16
-	162,	// sample 17
-	161,	// sample 18
-	160,	// sample 19
-	162,	// sample 20
-	165,	// sample 21
-	167,	// sample 22
-	170,	// sample 23
-	173,	// sample 24
-	171,	// sample 25
-	169,	// sample 26
-	166,	// sample 27
-	160,	// sample 28
-	153,	// sample 29
-	146,	// sample 30
-	136,	// sample 31
-	128,	// sample 32
-	120,	// sample 33
-	112,	// sample 34
-	107,	// sample 35
-	107,	// sample 36
-	107,	// sample 37
-	113,	// sample 38
-	119,	// sample 39
-	131,	// sample 40
-	143,	// sample 41
-	157,	// sample 42
-	168,	// sample 43
-	179,	// sample 44
-	188,	// sample 45
-	195,	// sample 46
-	197,	// sample 47
-	197,	// sample 48
-	190,	// sample 49
-	183,	// sample 50
-	172,	// sample 51
-	160,	// sample 52
-	149,	// sample 53
-	136,	// sample 54
-	125,	// sample 55
-	113,	// sample 56
-	109,	// sample 57
-	105,	// sample 58
-	103,	// sample 59
-	105,	// sample 60
-	109,	// sample 61
-	113,	// sample 62
-	120,	// sample 63
-	131,	// -------- wave 025 (19h), sample 00
-	164,	// sample 01
-	191,	// sample 02
-	216,	// sample 03
-	233,	// sample 04
-	243,	// sample 05
-	246,	// sample 06
-	239,	// sample 07
-	231,	// sample 08
-	214,	// sample 09
-	194,	// sample 10
-	174,	// sample 11
-	154,	// sample 12
-	129,	// sample 13
-	110,	// sample 14
-	 95,	// sample 15
-	 83,	// sample 16
-	 73,	// sample 17
-	 73,	// sample 18
-	 74,	// sample 19
-	 83,	// sample 20
-	 93,	// sample 21
-	107,	// sample 22
-	121,	// sample 23
-	138,	// sample 24
-	153,	// sample 25
-	163,	// sample 26
-	174,	// sample 27
-	184,	// sample 28
-	187,	// sample 29
-	188,	// sample 30
-	189,	// sample 31
-	185,	// sample 32
-	178,	// sample 33
-	169,	// sample 34
-	160,	// sample 35
-	152,	// sample 36
-	141,	// sample 37
-	134,	// sample 38
-	127,	// sample 39
-	122,	// sample 40
-	119,	// sample 41
-	117,	// sample 42
-	118,	// sample 43
-	119,	// sample 44
-	122,	// sample 45
-	125,	// sample 46
-	132,	// sample 47
-	137,	// sample 48
-	140,	// sample 49
-	144,	// sample 50
-	146,	// sample 51
-	147,	// sample 52
-	145,	// sample 53
-	144,	// sample 54
-	140,	// sample 55
-	139,	// sample 56
-	137,	// sample 57
-	135,	// sample 58
-	136,	// sample 59
-	134,	// sample 60
-	134,	// sample 61
-	132,	// sample 62
-	132,	// sample 63
-	130,	// -------- wave 026 (1ah), sample 00
-	154,	// sample 01
-	175,	// sample 02
-	190,	// sample 03
-	206,	// sample 04
-	215,	// sample 05
-	219,	// sample 06
-	219,	// sample 07
-	218,	// sample 08
-	210,	// sample 09
-	201,	// sample 10
-	190,	// sample 11
-	177,	// sample 12
-	164,	// sample 13
-	152,	// sample 14
-	140,	// sample 15
-	126,	// sample 16
-	114,	// sample 17
-	104,	// sample 18
-	 98,	// sample 19
-	 95,	// sample 20
-	 96,	// sample 21
-	 98,	// sample 22
-	106,	// sample 23
-	112,	// sample 24
-	123,	// sample 25
-	131,	// sample 26
-	140,	// sample 27
-	147,	// sample 28
-	153,	// sample 29
-	157,	// sample 30
-	158,	// sample 31
-	160,	// sample 32
-	160,	// sample 33
-	160,	// sample 34
-	160,	// sample 35
-	160,	// sample 36
-	160,	// sample 37
-	159,	// sample 38
-	158,	// sample 39
-	155,	// sample 40
-	153,	// sample 41
-	150,	// sample 42
-	146,	// sample 43
-	145,	// sample 44
-	143,	// sample 45
-	141,	// sample 46
-	140,	// sample 47
-	136,	// sample 48
-	136,	// sample 49
-	135,	// sample 50
-	130,	// sample 51
-	126,	// sample 52
-	123,	// sample 53
-	121,	// sample 54
-	115,	// sample 55
-	113,	// sample 56
-	112,	// sample 57
-	113,	// sample 58
-	113,	// sample 59
-	113,	// sample 60
-	117,	// sample 61
-	121,	// sample 62
-	123,	// sample 63
-	131,	// -------- wave 027 (1bh), sample 00
-	146,	// sample 01
-	159,	// sample 02
-	171,	// sample 03
-	181,	// sample 04
-	194,	// sample 05
-	204,	// sample 06
-	212,	// sample 07
-	220,	// sample 08
-	226,	// sample 09
-	232,	// sample 10
-	235,	// sample 11
-	238,	// sample 12
-	238,	// sample 13
-	238,	// sample 14
-	238,	// sample 15
-	235,	// sample 16
-	230,	// sample 17
-	226,	// sample 18
-	222,	// sample 19
-	217,	// sample 20
-	212,	// sample 21
-	205,	// sample 22
-	200,	// sample 23
-	194,	// sample 24
-	188,	// sample 25
-	183,	// sample 26
-	178,	// sample 27
-	172,	// sample 28
-	167,	// sample 29
-	165,	// sample 30
-	160,	// sample 31
-	158,	// sample 32
-	155,	// sample 33
-	152,	// sample 34
-	151,	// sample 35
-	149,	// sample 36
-	146,	// sample 37
-	145,	// sample 38
-	143,	// sample 39
-	142,	// sample 40
-	140,	// sample 41
-	139,	// sample 42
-	136,	// sample 43
-	135,	// sample 44
-	132,	// sample 45
-	131,	// sample 46
-	129,	// sample 47
-	129,	// sample 48
-	126,	// sample 49
-	124,	// sample 50
-	123,	// sample 51
-	123,	// sample 52
-	121,	// sample 53
-	120,	// sample 54
-	119,	// sample 55
-	118,	// sample 56
-	120,	// sample 57
-	121,	// sample 58
-	122,	// sample 59
-	123,	// sample 60
-	124,	// sample 61
-	124,	// sample 62
-	126,	// sample 63
-	130,	// -------- wave 028 (1ch), sample 00
-	141,	// sample 01
-	151,	// sample 02
-	158,	// sample 03
-	167,	// sample 04
-	175,	// sample 05
-	182,	// sample 06
-	191,	// sample 07
-	195,	// sample 08
-	201,	// sample 09
-	203,	// sample 10
-	207,	// sample 11
-	210,	// sample 12
-	211,	// sample 13
-	210,	// sample 14
-	211,	// sample 15
-	208,	// sample 16
-	205,	// sample 17
-	203,	// sample 18
-	198,	// sample 19
-	193,	// sample 20
-	189,	// sample 21
-	183,	// sample 22
-	177,	// sample 23
-	172,	// sample 24
-	164,	// sample 25
-	159,	// sample 26
-	153,	// sample 27
-	145,	// sample 28
-	139,	// sample 29
-	135,	// sample 30
-	129,	// sample 31
-	123,	// sample 32
-	118,	// sample 33
-	113,	// sample 34
-	109,	// sample 35
-	106,	// sample 36
-	100,	// sample 37
-	 98,	// sample 38
-	 96,	// sample 39
-	 94,	// sample 40
-	 92,	// sample 41
-	 91,	// sample 42
-	 89,	// sample 43
-	 89,	// sample 44
-	 88,	// sample 45
-	 88,	// sample 46
-	 88,	// sample 47
-	 89,	// sample 48
-	 89,	// sample 49
-	 90,	// sample 50
-	 91,	// sample 51
-	 93,	// sample 52
-	 94,	// sample 53
-	 97,	// sample 54
-	 99,	// sample 55
-	101,	// sample 56
-	104,	// sample 57
-	107,	// sample 58
-	111,	// sample 59
-	114,	// sample 60
-	119,	// sample 61
-	121,	// sample 62
-	124,	// sample 63
-	131,	// -------- wave 029 (1dh), sample 00
-	140,	// sample 01
-	151,	// sample 02
-	159,	// sample 03
-	166,	// sample 04
-	174,	// sample 05
-	183,	// sample 06
-	190,	// sample 07
-	197,	// sample 08
-	204,	// sample 09
-	210,	// sample 10
-	216,	// sample 11
-	221,	// sample 12
-	225,	// sample 13
-	230,	// sample 14
-	233,	// sample 15
-	235,	// sample 16
-	238,	// sample 17
-	239,	// sample 18
-	241,	// sample 19
-	240,	// sample 20
-	241,	// sample 21
-	239,	// sample 22
-	240,	// sample 23
-	238,	// sample 24
-	236,	// sample 25
-	233,	// sample 26
-	230,	// sample 27
-	228,	// sample 28
-	225,	// sample 29
-	223,	// sample 30
-	219,	// sample 31
-	215,	// sample 32
-	211,	// sample 33
-	206,	// sample 34
-	203,	// sample 35
-	199,	// sample 36
-	195,	// sample 37
-	191,	// sample 38
-	187,	// sample 39
-	183,	// sample 40
-	179,	// sample 41
-	177,	// sample 42
-	171,	// sample 43
-	170,	// sample 44
-	167,	// sample 45
-	163,	// sample 46
-	160,	// sample 47
-	158,	// sample 48
-	156,	// sample 49
-	153,	// sample 50
-	151,	// sample 51
-	148,	// sample 52
-	146,	// sample 53
-	144,	// sample 54
-	143,	// sample 55
-	139,	// sample 56
-	138,	// sample 57
-	137,	// sample 58
-	135,	// sample 59
-	134,	// sample 60
-	132,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	132,	// -------- wave 030 (1eh), sample 00
-	140,	// sample 01
-	149,	// sample 02
-	156,	// sample 03
-	164,	// sample 04
-	170,	// sample 05
-	178,	// sample 06
-	186,	// sample 07
-	192,	// sample 08
-	199,	// sample 09
-	206,	// sample 10
-	212,	// sample 11
-	217,	// sample 12
-	223,	// sample 13
-	227,	// sample 14
-	232,	// sample 15
-	236,	// sample 16
-	240,	// sample 17
-	241,	// sample 18
-	244,	// sample 19
-	246,	// sample 20
-	248,	// sample 21
-	248,	// sample 22
-	250,	// sample 23
-	250,	// sample 24
-	251,	// sample 25
-	249,	// sample 26
-	249,	// sample 27
-	248,	// sample 28
-	245,	// sample 29
-	244,	// sample 30
-	241,	// sample 31
-	238,	// sample 32
-	236,	// sample 33
-	232,	// sample 34
-	230,	// sample 35
-	226,	// sample 36
-	223,	// sample 37
-	219,	// sample 38
-	214,	// sample 39
-	210,	// sample 40
-	206,	// sample 41
-	203,	// sample 42
-	198,	// sample 43
-	194,	// sample 44
-	190,	// sample 45
-	188,	// sample 46
-	183,	// sample 47
-	179,	// sample 48
-	175,	// sample 49
-	171,	// sample 50
-	166,	// sample 51
-	164,	// sample 52
-	160,	// sample 53
-	157,	// sample 54
-	153,	// sample 55
-	150,	// sample 56
-	146,	// sample 57
-	144,	// sample 58
-	142,	// sample 59
-	138,	// sample 60
-	136,	// sample 61
-	131,	// sample 62
-	129,	// sample 63
-	128,	// -------- wave 031 (1fh), sample 00
-	128,	// sample 01
-	128,	// sample 02
-	128,	// sample 03
-	128,	// sample 04
-	128,	// sample 05
-	128,	// sample 06
-	128,	// sample 07
-	128,	// sample 08
-	128,	// sample 09
-	128,	// sample 10
-	128,	// sample 11
-	128,	// sample 12
-	128,	// sample 13
-	128,	// sample 14
-	128,	// sample 15
-	128,	// sample 16
-	128,	// sample 17
-	128,	// sample 18
-	128,	// sample 19
-	128,	// sample 20
-	128,	// sample 21
-	128,	// sample 22
-	128,	// sample 23
-	128,	// sample 24
-	128,	// sample 25
-	128,	// sample 26
-	128,	// sample 27
-	128,	// sample 28
-	128,	// sample 29
-	128,	// sample 30
-	128,	// sample 31
-	128,	// sample 32
-	128,	// sample 33
-	128,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	128,	// sample 39
-	128,	// sample 40
-	128,	// sample 41
-	128,	// sample 42
-	128,	// sample 43
-	128,	// sample 44
-	128,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	128,	// sample 48
-	128,	// sample 49
-	128,	// sample 50
-	128,	// sample 51
-	128,	// sample 52
-	128,	// sample 53
-	128,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	128,	// sample 57
-	128,	// sample 58
-	128,	// sample 59
-	128,	// sample 60
-	128,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	131,	// -------- wave 032 (20h), sample 00
-	137,	// sample 01
-	144,	// sample 02
-	150,	// sample 03
-	156,	// sample 04
-	160,	// sample 05
-	164,	// sample 06
-	170,	// sample 07
-	175,	// sample 08
-	181,	// sample 09
-	187,	// sample 10
-	192,	// sample 11
-	197,	// sample 12
-	202,	// sample 13
-	207,	// sample 14
-	212,	// sample 15
-	216,	// sample 16
-	220,	// sample 17
-	222,	// sample 18
-	224,	// sample 19
-	227,	// sample 20
-	231,	// sample 21
-	233,	// sample 22
-	236,	// sample 23
-	238,	// sample 24
-	241,	// sample 25
-	242,	// sample 26
-	244,	// sample 27
-	245,	// sample 28
-	246,	// sample 29
-	247,	// sample 30
-	247,	// sample 31
-	247,	// sample 32
-	247,	// sample 33
-	246,	// sample 34
-	245,	// sample 35
-	244,	// sample 36
-	242,	// sample 37
-	241,	// sample 38
-	238,	// sample 39
-	236,	// sample 40
-	233,	// sample 41
-	231,	// sample 42
-	227,	// sample 43
-	224,	// sample 44
-	222,	// sample 45
-	220,	// sample 46
-	216,	// sample 47
-	212,	// sample 48
-	207,	// sample 49
-	202,	// sample 50
-	197,	// sample 51
-	192,	// sample 52
-	187,	// sample 53
-	181,	// sample 54
-	175,	// sample 55
-	170,	// sample 56
-	164,	// sample 57
-	160,	// sample 58
-	156,	// sample 59
-	150,	// sample 60
-	144,	// sample 61
-	137,	// sample 62
-	131,	// sample 63
-	131,	// -------- wave 033 (21h), sample 00
-	152,	// sample 01
-	172,	// sample 02
-	188,	// sample 03
-	199,	// sample 04
-	206,	// sample 05
-	206,	// sample 06
-	200,	// sample 07
-	190,	// sample 08
-	174,	// sample 09
-	158,	// sample 10
-	139,	// sample 11
-	121,	// sample 12
-	105,	// sample 13
-	 95,	// sample 14
-	 89,	// sample 15
-	 87,	// sample 16
-	 91,	// sample 17
-	101,	// sample 18
-	115,	// sample 19
-	134,	// sample 20
-	155,	// sample 21
-	175,	// sample 22
-	194,	// sample 23
-	212,	// sample 24
-	223,	// sample 25
-	229,	// sample 26
-	231,	// sample 27
-	225,	// sample 28
-	216,	// sample 29
-	201,	// sample 30
-	182,	// sample 31
-	162,	// sample 32
-	144,	// sample 33
-	124,	// sample 34
-	110,	// sample 35
-	100,	// sample 36
-	 95,	// sample 37
-	 97,	// sample 38
-	102,	// sample 39
-	113,	// sample 40
-	129,	// sample 41
-	148,	// sample 42
-	167,	// sample 43
-	185,	// sample 44
-	202,	// sample 45
-	213,	// sample 46
-	220,	// sample 47
-	222,	// sample 48
-	217,	// sample 49
-	206,	// sample 50
-	191,	// sample 51
-	172,	// sample 52
-	151,	// sample 53
-	128,	// sample 54
-	109,	// sample 55
-	 91,	// sample 56
-	 79,	// sample 57
-	 71,	// sample 58
-	 68,	// sample 59
-	 73,	// sample 60
-	 82,	// sample 61
-	 95,	// sample 62
-	111,	// sample 63
-	131,	// -------- wave 034 (22h), sample 00
-	160,	// sample 01
-	181,	// sample 02
-	204,	// sample 03
-	221,	// sample 04
-	233,	// sample 05
-	241,	// sample 06
-	242,	// sample 07
-	240,	// sample 08
-	235,	// sample 09
-	225,	// sample 10
-	214,	// sample 11
-	203,	// sample 12
-	191,	// sample 13
-	182,	// sample 14
-	174,	// sample 15
-	167,	// sample 16
-	162,	// sample 17
-	161,	// sample 18
-	160,	// sample 19
-	162,	// sample 20
-	165,	// sample 21
-	167,	// sample 22
-	170,	// sample 23
-	173,	// sample 24
-	171,	// sample 25
-	169,	// sample 26
-	166,	// sample 27
-	160,	// sample 28
-	153,	// sample 29
-	146,	// sample 30
-	136,	// sample 31
-	128,	// sample 32
-	120,	// sample 33
-	112,	// sample 34
-	107,	// sample 35
-	107,	// sample 36
-	107,	// sample 37
-	113,	// sample 38
-	119,	// sample 39
-	131,	// sample 40
-	143,	// sample 41
-	157,	// sample 42
-	168,	// sample 43
-	179,	// sample 44
-	188,	// sample 45
-	195,	// sample 46
-	197,	// sample 47
-	197,	// sample 48
-	190,	// sample 49
-	183,	// sample 50
-	172,	// sample 51
-	160,	// sample 52
-	149,	// sample 53
-	136,	// sample 54
-	125,	// sample 55
-	113,	// sample 56
-	109,	// sample 57
-	105,	// sample 58
-	103,	// sample 59
-	105,	// sample 60
-	109,	// sample 61
-	113,	// sample 62
-	120,	// sample 63
-	128,	// -------- wave 035 (23h), sample 00
-	200,	// sample 01
-	238,	// sample 02
-	243,	// sample 03
-	222,	// sample 04
-	193,	// sample 05
-	172,	// sample 06
-	164,	// sample 07
-	164,	// sample 08
-	173,	// sample 09
-	180,	// sample 10
-	185,	// sample 11
-	180,	// sample 12
-	180,	// sample 13
-	189,	// sample 14
-	194,	// sample 15
-	205,	// sample 16
-	202,	// sample 17
-	195,	// sample 18
-	175,	// sample 19
-	157,	// sample 20
-	138,	// sample 21
-	132,	// sample 22
-	140,	// sample 23
-	151,	// sample 24
-	155,	// sample 25
-	145,	// sample 26
-	121,	// sample 27
-	101,	// sample 28
-	 92,	// sample 29
-	 93,	// sample 30
-	105,	// sample 31
-	127,	// sample 32
-	155,	// sample 33
-	166,	// sample 34
-	161,	// sample 35
-	147,	// sample 36
-	132,	// sample 37
-	127,	// sample 38
-	135,	// sample 39
-	149,	// sample 40
-	161,	// sample 41
-	164,	// sample 42
-	161,	// sample 43
-	148,	// sample 44
-	131,	// sample 45
-	118,	// sample 46
-	115,	// sample 47
-	119,	// sample 48
-	125,	// sample 49
-	133,	// sample 50
-	135,	// sample 51
-	140,	// sample 52
-	147,	// sample 53
-	154,	// sample 54
-	162,	// sample 55
-	160,	// sample 56
-	148,	// sample 57
-	121,	// sample 58
-	 90,	// sample 59
-	 67,	// sample 60
-	 63,	// sample 61
-	 76,	// sample 62
-	101,	// sample 63
-	128,	// -------- wave 036 (24h), sample 00
-	196,	// sample 01
-	232,	// sample 02
-	229,	// sample 03
-	202,	// sample 04
-	170,	// sample 05
-	146,	// sample 06
-	136,	// sample 07
-	139,	// sample 08
-	151,	// sample 09
-	162,	// sample 10
-	164,	// sample 11
-	156,	// sample 12
-	146,	// sample 13
-	142,	// sample 14
-	143,	// sample 15
-	151,	// sample 16
-	160,	// sample 17
-	165,	// sample 18
-	161,	// sample 19
-	150,	// sample 20
-	139,	// sample 21
-	131,	// sample 22
-	135,	// sample 23
-	139,	// sample 24
-	142,	// sample 25
-	139,	// sample 26
-	136,	// sample 27
-	126,	// sample 28
-	120,	// sample 29
-	120,	// sample 30
-	124,	// sample 31
-	133,	// sample 32
-	139,	// sample 33
-	134,	// sample 34
-	133,	// sample 35
-	128,	// sample 36
-	123,	// sample 37
-	125,	// sample 38
-	135,	// sample 39
-	143,	// sample 40
-	146,	// sample 41
-	140,	// sample 42
-	132,	// sample 43
-	125,	// sample 44
-	125,	// sample 45
-	131,	// sample 46
-	139,	// sample 47
-	146,	// sample 48
-	147,	// sample 49
-	141,	// sample 50
-	130,	// sample 51
-	127,	// sample 52
-	131,	// sample 53
-	142,	// sample 54
-	153,	// sample 55
-	161,	// sample 56
-	154,	// sample 57
-	131,	// sample 58
-	 97,	// sample 59
-	 67,	// sample 60
-	 58,	// sample 61
-	 71,	// sample 62
-	 99,	// sample 63
-	131,	// -------- wave 037 (25h), sample 00
-	155,	// sample 01
-	177,	// sample 02
-	195,	// sample 03
-	212,	// sample 04
-	227,	// sample 05
-	239,	// sample 06
-	245,	// sample 07
-	250,	// sample 08
-	250,	// sample 09
-	247,	// sample 10
-	241,	// sample 11
-	235,	// sample 12
-	224,	// sample 13
-	216,	// sample 14
-	206,	// sample 15
-	196,	// sample 16
-	186,	// sample 17
-	177,	// sample 18
-	169,	// sample 19
-	162,	// sample 20
-	157,	// sample 21
-	151,	// sample 22
-	149,	// sample 23
-	145,	// sample 24
-	141,	// sample 25
-	138,	// sample 26
-	135,	// sample 27
-	131,	// sample 28
-	127,	// sample 29
-	122,	// sample 30
-	117,	// sample 31
-	115,	// sample 32
-	110,	// sample 33
-	105,	// sample 34
-	104,	// sample 35
-	102,	// sample 36
-	100,	// sample 37
-	100,	// sample 38
-	101,	// sample 39
-	103,	// sample 40
-	107,	// sample 41
-	111,	// sample 42
-	115,	// sample 43
-	120,	// sample 44
-	123,	// sample 45
-	128,	// sample 46
-	130,	// sample 47
-	131,	// sample 48
-	133,	// sample 49
-	134,	// sample 50
-	133,	// sample 51
-	132,	// sample 52
-	130,	// sample 53
-	129,	// sample 54
-	124,	// sample 55
-	123,	// sample 56
-	121,	// sample 57
-	121,	// sample 58
-	121,	// sample 59
-	121,	// sample 60
-	124,	// sample 61
-	123,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 038 (26h), sample 00
-	176,	// sample 01
-	213,	// sample 02
-	238,	// sample 03
-	248,	// sample 04
-	247,	// sample 05
-	234,	// sample 06
-	218,	// sample 07
-	200,	// sample 08
-	186,	// sample 09
-	180,	// sample 10
-	180,	// sample 11
-	186,	// sample 12
-	192,	// sample 13
-	193,	// sample 14
-	193,	// sample 15
-	182,	// sample 16
-	167,	// sample 17
-	148,	// sample 18
-	127,	// sample 19
-	110,	// sample 20
-	 96,	// sample 21
-	 91,	// sample 22
-	 85,	// sample 23
-	 89,	// sample 24
-	 93,	// sample 25
-	 96,	// sample 26
-	 97,	// sample 27
-	 97,	// sample 28
-	 97,	// sample 29
-	 99,	// sample 30
-	 98,	// sample 31
-	105,	// sample 32
-	111,	// sample 33
-	120,	// sample 34
-	132,	// sample 35
-	139,	// sample 36
-	146,	// sample 37
-	149,	// sample 38
-	149,	// sample 39
-	145,	// sample 40
-	139,	// sample 41
-	133,	// sample 42
-	124,	// sample 43
-	118,	// sample 44
-	113,	// sample 45
-	108,	// sample 46
-	106,	// sample 47
-	106,	// sample 48
-	104,	// sample 49
-	105,	// sample 50
-	106,	// sample 51
-	109,	// sample 52
-	107,	// sample 53
-	110,	// sample 54
-	111,	// sample 55
-	112,	// sample 56
-	115,	// sample 57
-	114,	// sample 58
-	116,	// sample 59
-	117,	// sample 60
-	119,	// sample 61
-	121,	// sample 62
-	125,	// sample 63
-	132,	// -------- wave 039 (27h), sample 00
-	172,	// sample 01
-	206,	// sample 02
-	227,	// sample 03
-	232,	// sample 04
-	223,	// sample 05
-	203,	// sample 06
-	179,	// sample 07
-	157,	// sample 08
-	142,	// sample 09
-	137,	// sample 10
-	139,	// sample 11
-	152,	// sample 12
-	160,	// sample 13
-	167,	// sample 14
-	172,	// sample 15
-	169,	// sample 16
-	162,	// sample 17
-	154,	// sample 18
-	146,	// sample 19
-	147,	// sample 20
-	151,	// sample 21
-	160,	// sample 22
-	170,	// sample 23
-	180,	// sample 24
-	184,	// sample 25
-	184,	// sample 26
-	174,	// sample 27
-	159,	// sample 28
-	142,	// sample 29
-	127,	// sample 30
-	117,	// sample 31
-	116,	// sample 32
-	122,	// sample 33
-	132,	// sample 34
-	144,	// sample 35
-	155,	// sample 36
-	160,	// sample 37
-	156,	// sample 38
-	147,	// sample 39
-	133,	// sample 40
-	120,	// sample 41
-	108,	// sample 42
-	104,	// sample 43
-	109,	// sample 44
-	120,	// sample 45
-	135,	// sample 46
-	156,	// sample 47
-	173,	// sample 48
-	183,	// sample 49
-	187,	// sample 50
-	185,	// sample 51
-	174,	// sample 52
-	160,	// sample 53
-	142,	// sample 54
-	126,	// sample 55
-	115,	// sample 56
-	109,	// sample 57
-	105,	// sample 58
-	107,	// sample 59
-	110,	// sample 60
-	114,	// sample 61
-	118,	// sample 62
-	124,	// sample 63
-	131,	// -------- wave 040 (28h), sample 00
-	163,	// sample 01
-	194,	// sample 02
-	218,	// sample 03
-	233,	// sample 04
-	244,	// sample 05
-	245,	// sample 06
-	237,	// sample 07
-	224,	// sample 08
-	206,	// sample 09
-	185,	// sample 10
-	164,	// sample 11
-	144,	// sample 12
-	126,	// sample 13
-	113,	// sample 14
-	106,	// sample 15
-	103,	// sample 16
-	107,	// sample 17
-	112,	// sample 18
-	121,	// sample 19
-	133,	// sample 20
-	144,	// sample 21
-	154,	// sample 22
-	161,	// sample 23
-	166,	// sample 24
-	168,	// sample 25
-	169,	// sample 26
-	167,	// sample 27
-	163,	// sample 28
-	162,	// sample 29
-	158,	// sample 30
-	158,	// sample 31
-	156,	// sample 32
-	160,	// sample 33
-	161,	// sample 34
-	165,	// sample 35
-	168,	// sample 36
-	171,	// sample 37
-	172,	// sample 38
-	168,	// sample 39
-	166,	// sample 40
-	160,	// sample 41
-	154,	// sample 42
-	141,	// sample 43
-	132,	// sample 44
-	121,	// sample 45
-	111,	// sample 46
-	106,	// sample 47
-	102,	// sample 48
-	102,	// sample 49
-	108,	// sample 50
-	118,	// sample 51
-	130,	// sample 52
-	143,	// sample 53
-	157,	// sample 54
-	169,	// sample 55
-	181,	// sample 56
-	190,	// sample 57
-	194,	// sample 58
-	193,	// sample 59
-	187,	// sample 60
-	177,	// sample 61
-	161,	// sample 62
-	146,	// sample 63
-	130,	// -------- wave 041 (29h), sample 00
-	150,	// sample 01
-	166,	// sample 02
-	183,	// sample 03
-	196,	// sample 04
-	206,	// sample 05
-	211,	// sample 06
-	212,	// sample 07
-	211,	// sample 08
-	207,	// sample 09
-	201,	// sample 10
-	190,	// sample 11
-	181,	// sample 12
-	169,	// sample 13
-	158,	// sample 14
-	148,	// sample 15
-	140,	// sample 16
-	132,	// sample 17
-	126,	// sample 18
-	121,	// sample 19
-	118,	// sample 20
-	118,	// sample 21
-	116,	// sample 22
-	120,	// sample 23
-	120,	// sample 24
-	121,	// sample 25
-	124,	// sample 26
-	126,	// sample 27
-	127,	// sample 28
-	129,	// sample 29
-	129,	// sample 30
-	130,	// sample 31
-	130,	// sample 32
-	130,	// sample 33
-	129,	// sample 34
-	129,	// sample 35
-	128,	// sample 36
-	125,	// sample 37
-	124,	// sample 38
-	121,	// sample 39
-	120,	// sample 40
-	118,	// sample 41
-	119,	// sample 42
-	118,	// sample 43
-	120,	// sample 44
-	123,	// sample 45
-	127,	// sample 46
-	134,	// sample 47
-	140,	// sample 48
-	150,	// sample 49
-	160,	// sample 50
-	171,	// sample 51
-	181,	// sample 52
-	192,	// sample 53
-	201,	// sample 54
-	207,	// sample 55
-	210,	// sample 56
-	210,	// sample 57
-	209,	// sample 58
-	202,	// sample 59
-	192,	// sample 60
-	177,	// sample 61
-	161,	// sample 62
-	144,	// sample 63
-	130,	// -------- wave 042 (2ah), sample 00
-	143,	// sample 01
-	154,	// sample 02
-	165,	// sample 03
-	175,	// sample 04
-	185,	// sample 05
-	195,	// sample 06
-	203,	// sample 07
-	210,	// sample 08
-	217,	// sample 09
-	221,	// sample 10
-	225,	// sample 11
-	227,	// sample 12
-	231,	// sample 13
-	230,	// sample 14
-	231,	// sample 15
-	229,	// sample 16
-	226,	// sample 17
-	223,	// sample 18
-	220,	// sample 19
-	215,	// sample 20
-	209,	// sample 21
-	203,	// sample 22
-	197,	// sample 23
-	190,	// sample 24
-	183,	// sample 25
-	176,	// sample 26
-	169,	// sample 27
-	163,	// sample 28
-	157,	// sample 29
-	152,	// sample 30
-	144,	// sample 31
-	140,	// sample 32
-	134,	// sample 33
-	129,	// sample 34
-	125,	// sample 35
-	121,	// sample 36
-	119,	// sample 37
-	115,	// sample 38
-	111,	// sample 39
-	110,	// sample 40
-	108,	// sample 41
-	108,	// sample 42
-	107,	// sample 43
-	107,	// sample 44
-	107,	// sample 45
-	105,	// sample 46
-	106,	// sample 47
-	106,	// sample 48
-	106,	// sample 49
-	109,	// sample 50
-	108,	// sample 51
-	110,	// sample 52
-	110,	// sample 53
-	112,	// sample 54
-	114,	// sample 55
-	115,	// sample 56
-	117,	// sample 57
-	118,	// sample 58
-	121,	// sample 59
-	121,	// sample 60
-	123,	// sample 61
-	124,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 043 (2bh), sample 00
-	155,	// sample 01
-	179,	// sample 02
-	199,	// sample 03
-	214,	// sample 04
-	225,	// sample 05
-	233,	// sample 06
-	238,	// sample 07
-	234,	// sample 08
-	231,	// sample 09
-	225,	// sample 10
-	215,	// sample 11
-	206,	// sample 12
-	197,	// sample 13
-	189,	// sample 14
-	182,	// sample 15
-	174,	// sample 16
-	169,	// sample 17
-	165,	// sample 18
-	162,	// sample 19
-	158,	// sample 20
-	157,	// sample 21
-	153,	// sample 22
-	147,	// sample 23
-	140,	// sample 24
-	134,	// sample 25
-	127,	// sample 26
-	120,	// sample 27
-	113,	// sample 28
-	107,	// sample 29
-	103,	// sample 30
-	 98,	// sample 31
-	 99,	// sample 32
-	103,	// sample 33
-	106,	// sample 34
-	112,	// sample 35
-	118,	// sample 36
-	126,	// sample 37
-	132,	// sample 38
-	139,	// sample 39
-	144,	// sample 40
-	146,	// sample 41
-	147,	// sample 42
-	143,	// sample 43
-	140,	// sample 44
-	135,	// sample 45
-	127,	// sample 46
-	122,	// sample 47
-	114,	// sample 48
-	111,	// sample 49
-	107,	// sample 50
-	107,	// sample 51
-	107,	// sample 52
-	110,	// sample 53
-	114,	// sample 54
-	119,	// sample 55
-	124,	// sample 56
-	128,	// sample 57
-	131,	// sample 58
-	136,	// sample 59
-	136,	// sample 60
-	136,	// sample 61
-	134,	// sample 62
-	132,	// sample 63
-	130,	// -------- wave 044 (2ch), sample 00
-	157,	// sample 01
-	180,	// sample 02
-	201,	// sample 03
-	217,	// sample 04
-	231,	// sample 05
-	238,	// sample 06
-	243,	// sample 07
-	241,	// sample 08
-	233,	// sample 09
-	224,	// sample 10
-	212,	// sample 11
-	194,	// sample 12
-	178,	// sample 13
-	161,	// sample 14
-	147,	// sample 15
-	131,	// sample 16
-	118,	// sample 17
-	108,	// sample 18
-	104,	// sample 19
-	101,	// sample 20
-	101,	// sample 21
-	104,	// sample 22
-	110,	// sample 23
-	116,	// sample 24
-	125,	// sample 25
-	134,	// sample 26
-	141,	// sample 27
-	146,	// sample 28
-	153,	// sample 29
-	155,	// sample 30
-	156,	// sample 31
-	157,	// sample 32
-	154,	// sample 33
-	150,	// sample 34
-	146,	// sample 35
-	142,	// sample 36
-	137,	// sample 37
-	130,	// sample 38
-	126,	// sample 39
-	123,	// sample 40
-	121,	// sample 41
-	119,	// sample 42
-	117,	// sample 43
-	118,	// sample 44
-	119,	// sample 45
-	119,	// sample 46
-	123,	// sample 47
-	125,	// sample 48
-	125,	// sample 49
-	129,	// sample 50
-	128,	// sample 51
-	130,	// sample 52
-	130,	// sample 53
-	129,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	128,	// sample 57
-	128,	// sample 58
-	127,	// sample 59
-	126,	// sample 60
-	127,	// sample 61
-	127,	// sample 62
-	129,	// sample 63
-	131,	// -------- wave 045 (2dh), sample 00
-	179,	// sample 01
-	217,	// sample 02
-	240,	// sample 03
-	244,	// sample 04
-	232,	// sample 05
-	208,	// sample 06
-	176,	// sample 07
-	150,	// sample 08
-	130,	// sample 09
-	125,	// sample 10
-	132,	// sample 11
-	154,	// sample 12
-	178,	// sample 13
-	206,	// sample 14
-	222,	// sample 15
-	227,	// sample 16
-	218,	// sample 17
-	193,	// sample 18
-	161,	// sample 19
-	128,	// sample 20
-	 97,	// sample 21
-	 77,	// sample 22
-	 70,	// sample 23
-	 76,	// sample 24
-	 92,	// sample 25
-	116,	// sample 26
-	141,	// sample 27
-	160,	// sample 28
-	172,	// sample 29
-	173,	// sample 30
-	167,	// sample 31
-	155,	// sample 32
-	139,	// sample 33
-	124,	// sample 34
-	112,	// sample 35
-	108,	// sample 36
-	109,	// sample 37
-	114,	// sample 38
-	126,	// sample 39
-	135,	// sample 40
-	143,	// sample 41
-	150,	// sample 42
-	151,	// sample 43
-	149,	// sample 44
-	142,	// sample 45
-	133,	// sample 46
-	126,	// sample 47
-	121,	// sample 48
-	115,	// sample 49
-	115,	// sample 50
-	114,	// sample 51
-	118,	// sample 52
-	123,	// sample 53
-	127,	// sample 54
-	129,	// sample 55
-	135,	// sample 56
-	138,	// sample 57
-	139,	// sample 58
-	140,	// sample 59
-	140,	// sample 60
-	137,	// sample 61
-	136,	// sample 62
-	133,	// sample 63
-	130,	// -------- wave 046 (2eh), sample 00
-	198,	// sample 01
-	236,	// sample 02
-	227,	// sample 03
-	182,	// sample 04
-	118,	// sample 05
-	 68,	// sample 06
-	 56,	// sample 07
-	 84,	// sample 08
-	137,	// sample 09
-	195,	// sample 10
-	227,	// sample 11
-	227,	// sample 12
-	193,	// sample 13
-	150,	// sample 14
-	108,	// sample 15
-	 86,	// sample 16
-	 92,	// sample 17
-	114,	// sample 18
-	148,	// sample 19
-	172,	// sample 20
-	184,	// sample 21
-	171,	// sample 22
-	150,	// sample 23
-	122,	// sample 24
-	 99,	// sample 25
-	 89,	// sample 26
-	 92,	// sample 27
-	106,	// sample 28
-	127,	// sample 29
-	142,	// sample 30
-	150,	// sample 31
-	144,	// sample 32
-	129,	// sample 33
-	110,	// sample 34
-	100,	// sample 35
-	 97,	// sample 36
-	103,	// sample 37
-	119,	// sample 38
-	132,	// sample 39
-	140,	// sample 40
-	140,	// sample 41
-	135,	// sample 42
-	126,	// sample 43
-	122,	// sample 44
-	123,	// sample 45
-	127,	// sample 46
-	131,	// sample 47
-	135,	// sample 48
-	137,	// sample 49
-	137,	// sample 50
-	133,	// sample 51
-	133,	// sample 52
-	136,	// sample 53
-	135,	// sample 54
-	135,	// sample 55
-	133,	// sample 56
-	129,	// sample 57
-	128,	// sample 58
-	130,	// sample 59
-	131,	// sample 60
-	133,	// sample 61
-	135,	// sample 62
-	132,	// sample 63
-	131,	// -------- wave 047 (2fh), sample 00
-	158,	// sample 01
-	178,	// sample 02
-	193,	// sample 03
-	195,	// sample 04
-	188,	// sample 05
-	177,	// sample 06
-	166,	// sample 07
-	160,	// sample 08
-	157,	// sample 09
-	163,	// sample 10
-	173,	// sample 11
-	185,	// sample 12
-	194,	// sample 13
-	196,	// sample 14
-	188,	// sample 15
-	171,	// sample 16
-	148,	// sample 17
-	124,	// sample 18
-	103,	// sample 19
-	 90,	// sample 20
-	 88,	// sample 21
-	 93,	// sample 22
-	106,	// sample 23
-	122,	// sample 24
-	138,	// sample 25
-	147,	// sample 26
-	148,	// sample 27
-	143,	// sample 28
-	136,	// sample 29
-	127,	// sample 30
-	124,	// sample 31
-	129,	// sample 32
-	144,	// sample 33
-	164,	// sample 34
-	188,	// sample 35
-	211,	// sample 36
-	226,	// sample 37
-	232,	// sample 38
-	227,	// sample 39
-	216,	// sample 40
-	195,	// sample 41
-	178,	// sample 42
-	163,	// sample 43
-	156,	// sample 44
-	155,	// sample 45
-	160,	// sample 46
-	166,	// sample 47
-	171,	// sample 48
-	168,	// sample 49
-	159,	// sample 50
-	140,	// sample 51
-	116,	// sample 52
-	 93,	// sample 53
-	 74,	// sample 54
-	 63,	// sample 55
-	 64,	// sample 56
-	 75,	// sample 57
-	 91,	// sample 58
-	110,	// sample 59
-	128,	// sample 60
-	139,	// sample 61
-	141,	// sample 62
-	137,	// sample 63
-	131,	// -------- wave 048 (30h), sample 00
-	219,	// sample 01
-	238,	// sample 02
-	215,	// sample 03
-	208,	// sample 04
-	220,	// sample 05
-	210,	// sample 06
-	188,	// sample 07
-	185,	// sample 08
-	192,	// sample 09
-	190,	// sample 10
-	179,	// sample 11
-	178,	// sample 12
-	177,	// sample 13
-	166,	// sample 14
-	154,	// sample 15
-	157,	// sample 16
-	161,	// sample 17
-	158,	// sample 18
-	153,	// sample 19
-	157,	// sample 20
-	156,	// sample 21
-	140,	// sample 22
-	133,	// sample 23
-	140,	// sample 24
-	141,	// sample 25
-	133,	// sample 26
-	140,	// sample 27
-	162,	// sample 28
-	155,	// sample 29
-	113,	// sample 30
-	103,	// sample 31
-	148,	// sample 32
-	190,	// sample 33
-	177,	// sample 34
-	136,	// sample 35
-	129,	// sample 36
-	148,	// sample 37
-	150,	// sample 38
-	140,	// sample 39
-	137,	// sample 40
-	143,	// sample 41
-	134,	// sample 42
-	122,	// sample 43
-	121,	// sample 44
-	128,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	136,	// sample 48
-	145,	// sample 49
-	141,	// sample 50
-	132,	// sample 51
-	137,	// sample 52
-	139,	// sample 53
-	131,	// sample 54
-	129,	// sample 55
-	138,	// sample 56
-	129,	// sample 57
-	104,	// sample 58
-	 91,	// sample 59
-	 94,	// sample 60
-	 79,	// sample 61
-	 47,	// sample 62
-	 57,	// sample 63
-	133,	// -------- wave 049 (31h), sample 00
-	190,	// sample 01
-	206,	// sample 02
-	203,	// sample 03
-	213,	// sample 04
-	218,	// sample 05
-	197,	// sample 06
-	183,	// sample 07
-	205,	// sample 08
-	224,	// sample 09
-	205,	// sample 10
-	175,	// sample 11
-	170,	// sample 12
-	170,	// sample 13
-	153,	// sample 14
-	154,	// sample 15
-	194,	// sample 16
-	232,	// sample 17
-	231,	// sample 18
-	212,	// sample 19
-	206,	// sample 20
-	197,	// sample 21
-	164,	// sample 22
-	141,	// sample 23
-	156,	// sample 24
-	171,	// sample 25
-	150,	// sample 26
-	120,	// sample 27
-	117,	// sample 28
-	120,	// sample 29
-	111,	// sample 30
-	118,	// sample 31
-	167,	// sample 32
-	215,	// sample 33
-	221,	// sample 34
-	210,	// sample 35
-	212,	// sample 36
-	207,	// sample 37
-	178,	// sample 38
-	156,	// sample 39
-	169,	// sample 40
-	182,	// sample 41
-	156,	// sample 42
-	119,	// sample 43
-	108,	// sample 44
-	103,	// sample 45
-	 82,	// sample 46
-	 80,	// sample 47
-	118,	// sample 48
-	154,	// sample 49
-	152,	// sample 50
-	130,	// sample 51
-	126,	// sample 52
-	118,	// sample 53
-	 87,	// sample 54
-	 64,	// sample 55
-	 81,	// sample 56
-	 99,	// sample 57
-	 82,	// sample 58
-	 58,	// sample 59
-	 59,	// sample 60
-	 68,	// sample 61
-	 63,	// sample 62
-	 76,	// sample 63
-	128,	// -------- wave 050 (32h), sample 00
-	128,	// sample 01
-	128,	// sample 02
-	128,	// sample 03
-	128,	// sample 04
-	128,	// sample 05
-	128,	// sample 06
-	128,	// sample 07
-	128,	// sample 08
-	128,	// sample 09
-	128,	// sample 10
-	128,	// sample 11
-	128,	// sample 12
-	128,	// sample 13
-	128,	// sample 14
-	128,	// sample 15
-	128,	// sample 16
-	128,	// sample 17
-	128,	// sample 18
-	128,	// sample 19
-	128,	// sample 20
-	128,	// sample 21
-	128,	// sample 22
-	128,	// sample 23
-	128,	// sample 24
-	128,	// sample 25
-	128,	// sample 26
-	128,	// sample 27
-	128,	// sample 28
-	128,	// sample 29
-	128,	// sample 30
-	128,	// sample 31
-	128,	// sample 32
-	128,	// sample 33
-	128,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	128,	// sample 39
-	128,	// sample 40
-	128,	// sample 41
-	128,	// sample 42
-	128,	// sample 43
-	128,	// sample 44
-	128,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	128,	// sample 48
-	128,	// sample 49
-	128,	// sample 50
-	128,	// sample 51
-	128,	// sample 52
-	128,	// sample 53
-	128,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	128,	// sample 57
-	128,	// sample 58
-	128,	// sample 59
-	128,	// sample 60
-	128,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	128,	// -------- wave 051 (33h), sample 00
-	128,	// sample 01
-	128,	// sample 02
-	128,	// sample 03
-	128,	// sample 04
-	128,	// sample 05
-	128,	// sample 06
-	128,	// sample 07
-	128,	// sample 08
-	128,	// sample 09
-	128,	// sample 10
-	128,	// sample 11
-	128,	// sample 12
-	128,	// sample 13
-	128,	// sample 14
-	128,	// sample 15
-	128,	// sample 16
-	128,	// sample 17
-	128,	// sample 18
-	128,	// sample 19
-	128,	// sample 20
-	128,	// sample 21
-	128,	// sample 22
-	128,	// sample 23
-	128,	// sample 24
-	128,	// sample 25
-	128,	// sample 26
-	128,	// sample 27
-	128,	// sample 28
-	128,	// sample 29
-	128,	// sample 30
-	128,	// sample 31
-	128,	// sample 32
-	128,	// sample 33
-	128,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	128,	// sample 39
-	128,	// sample 40
-	128,	// sample 41
-	128,	// sample 42
-	128,	// sample 43
-	128,	// sample 44
-	128,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	128,	// sample 48
-	128,	// sample 49
-	128,	// sample 50
-	128,	// sample 51
-	128,	// sample 52
-	128,	// sample 53
-	128,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	128,	// sample 57
-	128,	// sample 58
-	128,	// sample 59
-	128,	// sample 60
-	128,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	128,	// -------- wave 052 (34h), sample 00
-	128,	// sample 01
-	128,	// sample 02
-	128,	// sample 03
-	128,	// sample 04
-	128,	// sample 05
-	128,	// sample 06
-	128,	// sample 07
-	128,	// sample 08
-	128,	// sample 09
-	128,	// sample 10
-	128,	// sample 11
-	128,	// sample 12
-	128,	// sample 13
-	128,	// sample 14
-	128,	// sample 15
-	128,	// sample 16
-	128,	// sample 17
-	128,	// sample 18
-	128,	// sample 19
-	128,	// sample 20
-	128,	// sample 21
-	128,	// sample 22
-	128,	// sample 23
-	128,	// sample 24
-	128,	// sample 25
-	128,	// sample 26
-	128,	// sample 27
-	128,	// sample 28
-	128,	// sample 29
-	128,	// sample 30
-	128,	// sample 31
-	128,	// sample 32
-	128,	// sample 33
-	128,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	128,	// sample 39
-	128,	// sample 40
-	128,	// sample 41
-	128,	// sample 42
-	128,	// sample 43
-	128,	// sample 44
-	128,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	128,	// sample 48
-	128,	// sample 49
-	128,	// sample 50
-	128,	// sample 51
-	128,	// sample 52
-	128,	// sample 53
-	128,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	128,	// sample 57
-	128,	// sample 58
-	128,	// sample 59
-	128,	// sample 60
-	128,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	130,	// -------- wave 053 (35h), sample 00
-	207,	// sample 01
-	241,	// sample 02
-	238,	// sample 03
-	222,	// sample 04
-	214,	// sample 05
-	218,	// sample 06
-	226,	// sample 07
-	223,	// sample 08
-	214,	// sample 09
-	211,	// sample 10
-	213,	// sample 11
-	214,	// sample 12
-	210,	// sample 13
-	203,	// sample 14
-	197,	// sample 15
-	198,	// sample 16
-	202,	// sample 17
-	203,	// sample 18
-	196,	// sample 19
-	192,	// sample 20
-	195,	// sample 21
-	195,	// sample 22
-	189,	// sample 23
-	186,	// sample 24
-	183,	// sample 25
-	184,	// sample 26
-	185,	// sample 27
-	187,	// sample 28
-	181,	// sample 29
-	180,	// sample 30
-	176,	// sample 31
-	178,	// sample 32
-	183,	// sample 33
-	176,	// sample 34
-	173,	// sample 35
-	175,	// sample 36
-	170,	// sample 37
-	169,	// sample 38
-	166,	// sample 39
-	163,	// sample 40
-	160,	// sample 41
-	163,	// sample 42
-	158,	// sample 43
-	157,	// sample 44
-	157,	// sample 45
-	151,	// sample 46
-	155,	// sample 47
-	153,	// sample 48
-	151,	// sample 49
-	150,	// sample 50
-	150,	// sample 51
-	152,	// sample 52
-	147,	// sample 53
-	141,	// sample 54
-	140,	// sample 55
-	137,	// sample 56
-	135,	// sample 57
-	135,	// sample 58
-	130,	// sample 59
-	124,	// sample 60
-	125,	// sample 61
-	126,	// sample 62
-	129,	// sample 63
-	131,	// -------- wave 054 (36h), sample 00
-	139,	// sample 01
-	147,	// sample 02
-	154,	// sample 03
-	160,	// sample 04
-	165,	// sample 05
-	173,	// sample 06
-	179,	// sample 07
-	185,	// sample 08
-	191,	// sample 09
-	197,	// sample 10
-	203,	// sample 11
-	207,	// sample 12
-	212,	// sample 13
-	216,	// sample 14
-	221,	// sample 15
-	223,	// sample 16
-	226,	// sample 17
-	226,	// sample 18
-	228,	// sample 19
-	229,	// sample 20
-	231,	// sample 21
-	231,	// sample 22
-	232,	// sample 23
-	232,	// sample 24
-	232,	// sample 25
-	230,	// sample 26
-	229,	// sample 27
-	227,	// sample 28
-	226,	// sample 29
-	223,	// sample 30
-	221,	// sample 31
-	218,	// sample 32
-	215,	// sample 33
-	212,	// sample 34
-	209,	// sample 35
-	206,	// sample 36
-	202,	// sample 37
-	198,	// sample 38
-	194,	// sample 39
-	190,	// sample 40
-	187,	// sample 41
-	183,	// sample 42
-	178,	// sample 43
-	175,	// sample 44
-	171,	// sample 45
-	170,	// sample 46
-	166,	// sample 47
-	163,	// sample 48
-	160,	// sample 49
-	157,	// sample 50
-	154,	// sample 51
-	152,	// sample 52
-	149,	// sample 53
-	146,	// sample 54
-	143,	// sample 55
-	141,	// sample 56
-	139,	// sample 57
-	137,	// sample 58
-	136,	// sample 59
-	135,	// sample 60
-	133,	// sample 61
-	130,	// sample 62
-	128,	// sample 63
-	131,	// -------- wave 055 (37h), sample 00
-	140,	// sample 01
-	150,	// sample 02
-	158,	// sample 03
-	166,	// sample 04
-	173,	// sample 05
-	182,	// sample 06
-	189,	// sample 07
-	195,	// sample 08
-	203,	// sample 09
-	209,	// sample 10
-	214,	// sample 11
-	220,	// sample 12
-	223,	// sample 13
-	228,	// sample 14
-	232,	// sample 15
-	234,	// sample 16
-	237,	// sample 17
-	238,	// sample 18
-	239,	// sample 19
-	238,	// sample 20
-	239,	// sample 21
-	239,	// sample 22
-	239,	// sample 23
-	236,	// sample 24
-	234,	// sample 25
-	232,	// sample 26
-	229,	// sample 27
-	225,	// sample 28
-	223,	// sample 29
-	219,	// sample 30
-	214,	// sample 31
-	210,	// sample 32
-	205,	// sample 33
-	201,	// sample 34
-	196,	// sample 35
-	191,	// sample 36
-	187,	// sample 37
-	182,	// sample 38
-	177,	// sample 39
-	173,	// sample 40
-	170,	// sample 41
-	165,	// sample 42
-	160,	// sample 43
-	157,	// sample 44
-	155,	// sample 45
-	152,	// sample 46
-	148,	// sample 47
-	145,	// sample 48
-	143,	// sample 49
-	140,	// sample 50
-	138,	// sample 51
-	136,	// sample 52
-	135,	// sample 53
-	133,	// sample 54
-	131,	// sample 55
-	130,	// sample 56
-	130,	// sample 57
-	128,	// sample 58
-	129,	// sample 59
-	128,	// sample 60
-	129,	// sample 61
-	127,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 056 (38h), sample 00
-	146,	// sample 01
-	159,	// sample 02
-	168,	// sample 03
-	180,	// sample 04
-	190,	// sample 05
-	201,	// sample 06
-	209,	// sample 07
-	218,	// sample 08
-	224,	// sample 09
-	231,	// sample 10
-	236,	// sample 11
-	240,	// sample 12
-	243,	// sample 13
-	245,	// sample 14
-	249,	// sample 15
-	250,	// sample 16
-	249,	// sample 17
-	246,	// sample 18
-	246,	// sample 19
-	243,	// sample 20
-	241,	// sample 21
-	239,	// sample 22
-	236,	// sample 23
-	233,	// sample 24
-	231,	// sample 25
-	227,	// sample 26
-	223,	// sample 27
-	220,	// sample 28
-	216,	// sample 29
-	213,	// sample 30
-	208,	// sample 31
-	205,	// sample 32
-	201,	// sample 33
-	198,	// sample 34
-	193,	// sample 35
-	191,	// sample 36
-	186,	// sample 37
-	183,	// sample 38
-	179,	// sample 39
-	175,	// sample 40
-	173,	// sample 41
-	170,	// sample 42
-	165,	// sample 43
-	164,	// sample 44
-	161,	// sample 45
-	160,	// sample 46
-	159,	// sample 47
-	157,	// sample 48
-	154,	// sample 49
-	152,	// sample 50
-	150,	// sample 51
-	148,	// sample 52
-	147,	// sample 53
-	144,	// sample 54
-	143,	// sample 55
-	141,	// sample 56
-	140,	// sample 57
-	138,	// sample 58
-	137,	// sample 59
-	136,	// sample 60
-	133,	// sample 61
-	131,	// sample 62
-	128,	// sample 63
-	132,	// -------- wave 057 (39h), sample 00
-	149,	// sample 01
-	165,	// sample 02
-	179,	// sample 03
-	194,	// sample 04
-	206,	// sample 05
-	217,	// sample 06
-	223,	// sample 07
-	232,	// sample 08
-	236,	// sample 09
-	239,	// sample 10
-	242,	// sample 11
-	241,	// sample 12
-	240,	// sample 13
-	238,	// sample 14
-	237,	// sample 15
-	235,	// sample 16
-	232,	// sample 17
-	227,	// sample 18
-	223,	// sample 19
-	221,	// sample 20
-	219,	// sample 21
-	215,	// sample 22
-	211,	// sample 23
-	208,	// sample 24
-	205,	// sample 25
-	202,	// sample 26
-	198,	// sample 27
-	196,	// sample 28
-	192,	// sample 29
-	189,	// sample 30
-	184,	// sample 31
-	182,	// sample 32
-	178,	// sample 33
-	174,	// sample 34
-	171,	// sample 35
-	168,	// sample 36
-	163,	// sample 37
-	160,	// sample 38
-	158,	// sample 39
-	154,	// sample 40
-	152,	// sample 41
-	149,	// sample 42
-	147,	// sample 43
-	144,	// sample 44
-	142,	// sample 45
-	143,	// sample 46
-	142,	// sample 47
-	144,	// sample 48
-	143,	// sample 49
-	145,	// sample 50
-	147,	// sample 51
-	148,	// sample 52
-	150,	// sample 53
-	154,	// sample 54
-	151,	// sample 55
-	153,	// sample 56
-	152,	// sample 57
-	151,	// sample 58
-	150,	// sample 59
-	146,	// sample 60
-	144,	// sample 61
-	136,	// sample 62
-	134,	// sample 63
-	130,	// -------- wave 058 (3ah), sample 00
-	150,	// sample 01
-	166,	// sample 02
-	180,	// sample 03
-	190,	// sample 04
-	193,	// sample 05
-	195,	// sample 06
-	193,	// sample 07
-	192,	// sample 08
-	189,	// sample 09
-	187,	// sample 10
-	186,	// sample 11
-	182,	// sample 12
-	182,	// sample 13
-	184,	// sample 14
-	185,	// sample 15
-	184,	// sample 16
-	183,	// sample 17
-	182,	// sample 18
-	181,	// sample 19
-	181,	// sample 20
-	185,	// sample 21
-	188,	// sample 22
-	192,	// sample 23
-	200,	// sample 24
-	208,	// sample 25
-	215,	// sample 26
-	222,	// sample 27
-	229,	// sample 28
-	234,	// sample 29
-	234,	// sample 30
-	234,	// sample 31
-	234,	// sample 32
-	230,	// sample 33
-	227,	// sample 34
-	223,	// sample 35
-	219,	// sample 36
-	215,	// sample 37
-	213,	// sample 38
-	210,	// sample 39
-	207,	// sample 40
-	207,	// sample 41
-	206,	// sample 42
-	205,	// sample 43
-	205,	// sample 44
-	204,	// sample 45
-	205,	// sample 46
-	200,	// sample 47
-	197,	// sample 48
-	190,	// sample 49
-	183,	// sample 50
-	175,	// sample 51
-	168,	// sample 52
-	161,	// sample 53
-	156,	// sample 54
-	150,	// sample 55
-	147,	// sample 56
-	144,	// sample 57
-	142,	// sample 58
-	142,	// sample 59
-	140,	// sample 60
-	138,	// sample 61
-	133,	// sample 62
-	130,	// sample 63
-	131,	// -------- wave 059 (3bh), sample 00
-	200,	// sample 01
-	236,	// sample 02
-	242,	// sample 03
-	221,	// sample 04
-	188,	// sample 05
-	160,	// sample 06
-	144,	// sample 07
-	144,	// sample 08
-	157,	// sample 09
-	168,	// sample 10
-	174,	// sample 11
-	177,	// sample 12
-	175,	// sample 13
-	179,	// sample 14
-	188,	// sample 15
-	202,	// sample 16
-	217,	// sample 17
-	225,	// sample 18
-	209,	// sample 19
-	179,	// sample 20
-	149,	// sample 21
-	121,	// sample 22
-	110,	// sample 23
-	116,	// sample 24
-	137,	// sample 25
-	166,	// sample 26
-	187,	// sample 27
-	192,	// sample 28
-	179,	// sample 29
-	160,	// sample 30
-	140,	// sample 31
-	129,	// sample 32
-	129,	// sample 33
-	142,	// sample 34
-	155,	// sample 35
-	160,	// sample 36
-	157,	// sample 37
-	144,	// sample 38
-	130,	// sample 39
-	123,	// sample 40
-	123,	// sample 41
-	136,	// sample 42
-	157,	// sample 43
-	170,	// sample 44
-	168,	// sample 45
-	159,	// sample 46
-	147,	// sample 47
-	138,	// sample 48
-	133,	// sample 49
-	136,	// sample 50
-	147,	// sample 51
-	156,	// sample 52
-	159,	// sample 53
-	148,	// sample 54
-	130,	// sample 55
-	117,	// sample 56
-	112,	// sample 57
-	113,	// sample 58
-	128,	// sample 59
-	143,	// sample 60
-	145,	// sample 61
-	145,	// sample 62
-	137,	// sample 63
-	130,	// -------- wave 060 (3ch), sample 00
-	201,	// sample 01
-	236,	// sample 02
-	223,	// sample 03
-	168,	// sample 04
-	 95,	// sample 05
-	 38,	// sample 06
-	 23,	// sample 07
-	 55,	// sample 08
-	120,	// sample 09
-	188,	// sample 10
-	225,	// sample 11
-	219,	// sample 12
-	171,	// sample 13
-	107,	// sample 14
-	 53,	// sample 15
-	 33,	// sample 16
-	 58,	// sample 17
-	111,	// sample 18
-	173,	// sample 19
-	211,	// sample 20
-	212,	// sample 21
-	173,	// sample 22
-	117,	// sample 23
-	 68,	// sample 24
-	 46,	// sample 25
-	 63,	// sample 26
-	107,	// sample 27
-	160,	// sample 28
-	198,	// sample 29
-	204,	// sample 30
-	175,	// sample 31
-	126,	// sample 32
-	 78,	// sample 33
-	 55,	// sample 34
-	 65,	// sample 35
-	102,	// sample 36
-	151,	// sample 37
-	186,	// sample 38
-	197,	// sample 39
-	176,	// sample 40
-	134,	// sample 41
-	 91,	// sample 42
-	 66,	// sample 43
-	 71,	// sample 44
-	101,	// sample 45
-	143,	// sample 46
-	174,	// sample 47
-	184,	// sample 48
-	171,	// sample 49
-	139,	// sample 50
-	101,	// sample 51
-	 81,	// sample 52
-	 81,	// sample 53
-	102,	// sample 54
-	135,	// sample 55
-	162,	// sample 56
-	173,	// sample 57
-	164,	// sample 58
-	139,	// sample 59
-	112,	// sample 60
-	 92,	// sample 61
-	 88,	// sample 62
-	102,	// sample 63
-	131,	// -------- wave 061 (3dh), sample 00
-	141,	// sample 01
-	149,	// sample 02
-	159,	// sample 03
-	166,	// sample 04
-	173,	// sample 05
-	181,	// sample 06
-	187,	// sample 07
-	193,	// sample 08
-	200,	// sample 09
-	205,	// sample 10
-	208,	// sample 11
-	212,	// sample 12
-	216,	// sample 13
-	218,	// sample 14
-	220,	// sample 15
-	221,	// sample 16
-	220,	// sample 17
-	220,	// sample 18
-	219,	// sample 19
-	217,	// sample 20
-	217,	// sample 21
-	214,	// sample 22
-	213,	// sample 23
-	210,	// sample 24
-	209,	// sample 25
-	206,	// sample 26
-	204,	// sample 27
-	203,	// sample 28
-	201,	// sample 29
-	201,	// sample 30
-	199,	// sample 31
-	199,	// sample 32
-	198,	// sample 33
-	198,	// sample 34
-	199,	// sample 35
-	198,	// sample 36
-	200,	// sample 37
-	200,	// sample 38
-	202,	// sample 39
-	204,	// sample 40
-	203,	// sample 41
-	206,	// sample 42
-	206,	// sample 43
-	208,	// sample 44
-	207,	// sample 45
-	208,	// sample 46
-	209,	// sample 47
-	209,	// sample 48
-	207,	// sample 49
-	205,	// sample 50
-	202,	// sample 51
-	199,	// sample 52
-	197,	// sample 53
-	192,	// sample 54
-	187,	// sample 55
-	182,	// sample 56
-	176,	// sample 57
-	169,	// sample 58
-	164,	// sample 59
-	157,	// sample 60
-	149,	// sample 61
-	141,	// sample 62
-	133,	// sample 63
-	129,	// -------- wave 062 (3eh), sample 00
-	142,	// sample 01
-	153,	// sample 02
-	162,	// sample 03
-	171,	// sample 04
-	181,	// sample 05
-	188,	// sample 06
-	196,	// sample 07
-	201,	// sample 08
-	207,	// sample 09
-	212,	// sample 10
-	214,	// sample 11
-	216,	// sample 12
-	218,	// sample 13
-	220,	// sample 14
-	220,	// sample 15
-	219,	// sample 16
-	217,	// sample 17
-	214,	// sample 18
-	210,	// sample 19
-	207,	// sample 20
-	202,	// sample 21
-	195,	// sample 22
-	192,	// sample 23
-	186,	// sample 24
-	180,	// sample 25
-	171,	// sample 26
-	165,	// sample 27
-	160,	// sample 28
-	155,	// sample 29
-	149,	// sample 30
-	141,	// sample 31
-	136,	// sample 32
-	129,	// sample 33
-	123,	// sample 34
-	122,	// sample 35
-	119,	// sample 36
-	113,	// sample 37
-	110,	// sample 38
-	107,	// sample 39
-	106,	// sample 40
-	103,	// sample 41
-	104,	// sample 42
-	102,	// sample 43
-	103,	// sample 44
-	101,	// sample 45
-	101,	// sample 46
-	101,	// sample 47
-	101,	// sample 48
-	104,	// sample 49
-	105,	// sample 50
-	105,	// sample 51
-	108,	// sample 52
-	109,	// sample 53
-	114,	// sample 54
-	113,	// sample 55
-	115,	// sample 56
-	119,	// sample 57
-	121,	// sample 58
-	123,	// sample 59
-	124,	// sample 60
-	127,	// sample 61
-	125,	// sample 62
-	127,	// sample 63
-	129,	// -------- wave 063 (3fh), sample 00
-	142,	// sample 01
-	152,	// sample 02
-	160,	// sample 03
-	168,	// sample 04
-	178,	// sample 05
-	185,	// sample 06
-	193,	// sample 07
-	199,	// sample 08
-	205,	// sample 09
-	210,	// sample 10
-	214,	// sample 11
-	216,	// sample 12
-	218,	// sample 13
-	221,	// sample 14
-	221,	// sample 15
-	221,	// sample 16
-	218,	// sample 17
-	215,	// sample 18
-	212,	// sample 19
-	208,	// sample 20
-	203,	// sample 21
-	196,	// sample 22
-	193,	// sample 23
-	186,	// sample 24
-	180,	// sample 25
-	172,	// sample 26
-	166,	// sample 27
-	160,	// sample 28
-	154,	// sample 29
-	149,	// sample 30
-	141,	// sample 31
-	136,	// sample 32
-	129,	// sample 33
-	123,	// sample 34
-	120,	// sample 35
-	117,	// sample 36
-	112,	// sample 37
-	109,	// sample 38
-	105,	// sample 39
-	104,	// sample 40
-	102,	// sample 41
-	103,	// sample 42
-	101,	// sample 43
-	102,	// sample 44
-	101,	// sample 45
-	102,	// sample 46
-	102,	// sample 47
-	103,	// sample 48
-	105,	// sample 49
-	106,	// sample 50
-	107,	// sample 51
-	110,	// sample 52
-	111,	// sample 53
-	114,	// sample 54
-	113,	// sample 55
-	115,	// sample 56
-	118,	// sample 57
-	120,	// sample 58
-	122,	// sample 59
-	123,	// sample 60
-	125,	// sample 61
-	124,	// sample 62
-	127,	// sample 63
-	130,	// -------- wave 064 (40h), sample 00
-	148,	// sample 01
-	164,	// sample 02
-	178,	// sample 03
-	192,	// sample 04
-	205,	// sample 05
-	215,	// sample 06
-	223,	// sample 07
-	 47,	// sample 08
-	255,	// sample 09
-	236,	// sample 10
-	236,	// sample 11
-	237,	// sample 12
-	235,	// sample 13
-	231,	// sample 14
-	228,	// sample 15
-	223,	// sample 16
-	217,	// sample 17
-	210,	// sample 18
-	205,	// sample 19
-	199,	// sample 20
-	195,	// sample 21
-	189,	// sample 22
-	186,	// sample 23
-	182,	// sample 24
-	180,	// sample 25
-	178,	// sample 26
-	177,	// sample 27
-	176,	// sample 28
-	174,	// sample 29
-	175,	// sample 30
-	174,	// sample 31
-	172,	// sample 32
-	171,	// sample 33
-	168,	// sample 34
-	167,	// sample 35
-	162,	// sample 36
-	160,	// sample 37
-	156,	// sample 38
-	149,	// sample 39
-	146,	// sample 40
-	139,	// sample 41
-	135,	// sample 42
-	128,	// sample 43
-	122,	// sample 44
-	116,	// sample 45
-	111,	// sample 46
-	105,	// sample 47
-	101,	// sample 48
-	 98,	// sample 49
-	 96,	// sample 50
-	 94,	// sample 51
-	 93,	// sample 52
-	 93,	// sample 53
-	 94,	// sample 54
-	 95,	// sample 55
-	 96,	// sample 56
-	 99,	// sample 57
-	102,	// sample 58
-	106,	// sample 59
-	108,	// sample 60
-	114,	// sample 61
-	118,	// sample 62
-	124,	// sample 63
-	130,	// -------- wave 065 (41h), sample 00
-	140,	// sample 01
-	151,	// sample 02
-	160,	// sample 03
-	169,	// sample 04
-	176,	// sample 05
-	185,	// sample 06
-	193,	// sample 07
-	199,	// sample 08
-	207,	// sample 09
-	212,	// sample 10
-	218,	// sample 11
-	223,	// sample 12
-	225,	// sample 13
-	229,	// sample 14
-	232,	// sample 15
-	234,	// sample 16
-	235,	// sample 17
-	236,	// sample 18
-	236,	// sample 19
-	233,	// sample 20
-	233,	// sample 21
-	230,	// sample 22
-	228,	// sample 23
-	225,	// sample 24
-	223,	// sample 25
-	218,	// sample 26
-	214,	// sample 27
-	210,	// sample 28
-	206,	// sample 29
-	201,	// sample 30
-	195,	// sample 31
-	191,	// sample 32
-	186,	// sample 33
-	181,	// sample 34
-	177,	// sample 35
-	172,	// sample 36
-	167,	// sample 37
-	164,	// sample 38
-	160,	// sample 39
-	156,	// sample 40
-	152,	// sample 41
-	150,	// sample 42
-	146,	// sample 43
-	144,	// sample 44
-	142,	// sample 45
-	139,	// sample 46
-	137,	// sample 47
-	136,	// sample 48
-	133,	// sample 49
-	132,	// sample 50
-	131,	// sample 51
-	130,	// sample 52
-	129,	// sample 53
-	129,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	127,	// sample 57
-	127,	// sample 58
-	128,	// sample 59
-	127,	// sample 60
-	127,	// sample 61
-	126,	// sample 62
-	127,	// sample 63
-	132,	// -------- wave 066 (42h), sample 00
-	170,	// sample 01
-	202,	// sample 02
-	230,	// sample 03
-	245,	// sample 04
-	253,	// sample 05
-	253,	// sample 06
-	246,	// sample 07
-	236,	// sample 08
-	227,	// sample 09
-	216,	// sample 10
-	206,	// sample 11
-	195,	// sample 12
-	183,	// sample 13
-	173,	// sample 14
-	158,	// sample 15
-	144,	// sample 16
-	131,	// sample 17
-	123,	// sample 18
-	113,	// sample 19
-	108,	// sample 20
-	108,	// sample 21
-	110,	// sample 22
-	119,	// sample 23
-	124,	// sample 24
-	127,	// sample 25
-	131,	// sample 26
-	139,	// sample 27
-	145,	// sample 28
-	155,	// sample 29
-	166,	// sample 30
-	177,	// sample 31
-	188,	// sample 32
-	201,	// sample 33
-	207,	// sample 34
-	211,	// sample 35
-	210,	// sample 36
-	200,	// sample 37
-	190,	// sample 38
-	176,	// sample 39
-	164,	// sample 40
-	153,	// sample 41
-	143,	// sample 42
-	135,	// sample 43
-	129,	// sample 44
-	127,	// sample 45
-	121,	// sample 46
-	116,	// sample 47
-	110,	// sample 48
-	107,	// sample 49
-	103,	// sample 50
-	100,	// sample 51
-	103,	// sample 52
-	106,	// sample 53
-	112,	// sample 54
-	118,	// sample 55
-	122,	// sample 56
-	127,	// sample 57
-	130,	// sample 58
-	133,	// sample 59
-	132,	// sample 60
-	131,	// sample 61
-	130,	// sample 62
-	128,	// sample 63
-	132,	// -------- wave 067 (43h), sample 00
-	183,	// sample 01
-	223,	// sample 02
-	246,	// sample 03
-	245,	// sample 04
-	223,	// sample 05
-	188,	// sample 06
-	143,	// sample 07
-	100,	// sample 08
-	 70,	// sample 09
-	 52,	// sample 10
-	 56,	// sample 11
-	 76,	// sample 12
-	107,	// sample 13
-	148,	// sample 14
-	185,	// sample 15
-	215,	// sample 16
-	233,	// sample 17
-	236,	// sample 18
-	223,	// sample 19
-	203,	// sample 20
-	174,	// sample 21
-	142,	// sample 22
-	116,	// sample 23
-	 97,	// sample 24
-	 91,	// sample 25
-	 97,	// sample 26
-	115,	// sample 27
-	140,	// sample 28
-	166,	// sample 29
-	192,	// sample 30
-	206,	// sample 31
-	210,	// sample 32
-	201,	// sample 33
-	182,	// sample 34
-	161,	// sample 35
-	141,	// sample 36
-	121,	// sample 37
-	111,	// sample 38
-	108,	// sample 39
-	112,	// sample 40
-	121,	// sample 41
-	137,	// sample 42
-	147,	// sample 43
-	156,	// sample 44
-	161,	// sample 45
-	163,	// sample 46
-	159,	// sample 47
-	156,	// sample 48
-	147,	// sample 49
-	141,	// sample 50
-	131,	// sample 51
-	124,	// sample 52
-	117,	// sample 53
-	113,	// sample 54
-	111,	// sample 55
-	117,	// sample 56
-	125,	// sample 57
-	134,	// sample 58
-	143,	// sample 59
-	149,	// sample 60
-	150,	// sample 61
-	147,	// sample 62
-	138,	// sample 63
-	132,	// -------- wave 068 (44h), sample 00
-	199,	// sample 01
-	228,	// sample 02
-	211,	// sample 03
-	151,	// sample 04
-	 86,	// sample 05
-	 52,	// sample 06
-	 66,	// sample 07
-	118,	// sample 08
-	184,	// sample 09
-	226,	// sample 10
-	226,	// sample 11
-	186,	// sample 12
-	130,	// sample 13
-	 91,	// sample 14
-	 86,	// sample 15
-	116,	// sample 16
-	164,	// sample 17
-	205,	// sample 18
-	214,	// sample 19
-	195,	// sample 20
-	160,	// sample 21
-	126,	// sample 22
-	114,	// sample 23
-	125,	// sample 24
-	153,	// sample 25
-	177,	// sample 26
-	188,	// sample 27
-	180,	// sample 28
-	162,	// sample 29
-	146,	// sample 30
-	137,	// sample 31
-	138,	// sample 32
-	147,	// sample 33
-	157,	// sample 34
-	160,	// sample 35
-	159,	// sample 36
-	151,	// sample 37
-	145,	// sample 38
-	142,	// sample 39
-	145,	// sample 40
-	145,	// sample 41
-	146,	// sample 42
-	142,	// sample 43
-	138,	// sample 44
-	138,	// sample 45
-	137,	// sample 46
-	139,	// sample 47
-	142,	// sample 48
-	141,	// sample 49
-	140,	// sample 50
-	135,	// sample 51
-	130,	// sample 52
-	127,	// sample 53
-	128,	// sample 54
-	131,	// sample 55
-	136,	// sample 56
-	137,	// sample 57
-	134,	// sample 58
-	132,	// sample 59
-	128,	// sample 60
-	124,	// sample 61
-	123,	// sample 62
-	125,	// sample 63
-	130,	// -------- wave 069 (45h), sample 00
-	139,	// sample 01
-	148,	// sample 02
-	154,	// sample 03
-	161,	// sample 04
-	169,	// sample 05
-	175,	// sample 06
-	182,	// sample 07
-	189,	// sample 08
-	194,	// sample 09
-	199,	// sample 10
-	204,	// sample 11
-	208,	// sample 12
-	211,	// sample 13
-	215,	// sample 14
-	218,	// sample 15
-	219,	// sample 16
-	220,	// sample 17
-	220,	// sample 18
-	220,	// sample 19
-	218,	// sample 20
-	217,	// sample 21
-	214,	// sample 22
-	213,	// sample 23
-	210,	// sample 24
-	206,	// sample 25
-	201,	// sample 26
-	197,	// sample 27
-	191,	// sample 28
-	187,	// sample 29
-	182,	// sample 30
-	175,	// sample 31
-	170,	// sample 32
-	163,	// sample 33
-	158,	// sample 34
-	153,	// sample 35
-	147,	// sample 36
-	140,	// sample 37
-	136,	// sample 38
-	130,	// sample 39
-	124,	// sample 40
-	121,	// sample 41
-	116,	// sample 42
-	112,	// sample 43
-	109,	// sample 44
-	106,	// sample 45
-	103,	// sample 46
-	100,	// sample 47
-	 99,	// sample 48
-	 98,	// sample 49
-	 97,	// sample 50
-	 97,	// sample 51
-	 98,	// sample 52
-	 98,	// sample 53
-	100,	// sample 54
-	101,	// sample 55
-	102,	// sample 56
-	105,	// sample 57
-	108,	// sample 58
-	111,	// sample 59
-	115,	// sample 60
-	119,	// sample 61
-	120,	// sample 62
-	125,	// sample 63
-	130,	// -------- wave 070 (46h), sample 00
-	142,	// sample 01
-	154,	// sample 02
-	163,	// sample 03
-	173,	// sample 04
-	182,	// sample 05
-	190,	// sample 06
-	198,	// sample 07
-	203,	// sample 08
-	209,	// sample 09
-	214,	// sample 10
-	216,	// sample 11
-	216,	// sample 12
-	216,	// sample 13
-	215,	// sample 14
-	212,	// sample 15
-	209,	// sample 16
-	204,	// sample 17
-	198,	// sample 18
-	192,	// sample 19
-	185,	// sample 20
-	178,	// sample 21
-	171,	// sample 22
-	165,	// sample 23
-	158,	// sample 24
-	152,	// sample 25
-	145,	// sample 26
-	140,	// sample 27
-	137,	// sample 28
-	133,	// sample 29
-	131,	// sample 30
-	129,	// sample 31
-	128,	// sample 32
-	129,	// sample 33
-	130,	// sample 34
-	134,	// sample 35
-	137,	// sample 36
-	141,	// sample 37
-	147,	// sample 38
-	152,	// sample 39
-	160,	// sample 40
-	165,	// sample 41
-	173,	// sample 42
-	179,	// sample 43
-	187,	// sample 44
-	193,	// sample 45
-	200,	// sample 46
-	205,	// sample 47
-	209,	// sample 48
-	212,	// sample 49
-	214,	// sample 50
-	215,	// sample 51
-	215,	// sample 52
-	214,	// sample 53
-	210,	// sample 54
-	205,	// sample 55
-	201,	// sample 56
-	193,	// sample 57
-	186,	// sample 58
-	178,	// sample 59
-	168,	// sample 60
-	159,	// sample 61
-	147,	// sample 62
-	137,	// sample 63
-	130,	// -------- wave 071 (47h), sample 00
-	145,	// sample 01
-	159,	// sample 02
-	170,	// sample 03
-	182,	// sample 04
-	190,	// sample 05
-	198,	// sample 06
-	205,	// sample 07
-	208,	// sample 08
-	209,	// sample 09
-	209,	// sample 10
-	205,	// sample 11
-	200,	// sample 12
-	194,	// sample 13
-	186,	// sample 14
-	177,	// sample 15
-	168,	// sample 16
-	159,	// sample 17
-	150,	// sample 18
-	142,	// sample 19
-	134,	// sample 20
-	130,	// sample 21
-	126,	// sample 22
-	124,	// sample 23
-	123,	// sample 24
-	127,	// sample 25
-	131,	// sample 26
-	137,	// sample 27
-	145,	// sample 28
-	154,	// sample 29
-	164,	// sample 30
-	175,	// sample 31
-	186,	// sample 32
-	198,	// sample 33
-	207,	// sample 34
-	217,	// sample 35
-	224,	// sample 36
-	229,	// sample 37
-	234,	// sample 38
-	236,	// sample 39
-	237,	// sample 40
-	233,	// sample 41
-	229,	// sample 42
-	222,	// sample 43
-	214,	// sample 44
-	203,	// sample 45
-	192,	// sample 46
-	179,	// sample 47
-	166,	// sample 48
-	153,	// sample 49
-	141,	// sample 50
-	128,	// sample 51
-	117,	// sample 52
-	109,	// sample 53
-	101,	// sample 54
-	 95,	// sample 55
-	 92,	// sample 56
-	 91,	// sample 57
-	 92,	// sample 58
-	 95,	// sample 59
-	 98,	// sample 60
-	105,	// sample 61
-	111,	// sample 62
-	119,	// sample 63
-	130,	// -------- wave 072 (48h), sample 00
-	147,	// sample 01
-	164,	// sample 02
-	177,	// sample 03
-	188,	// sample 04
-	197,	// sample 05
-	203,	// sample 06
-	205,	// sample 07
-	203,	// sample 08
-	198,	// sample 09
-	192,	// sample 10
-	181,	// sample 11
-	170,	// sample 12
-	160,	// sample 13
-	148,	// sample 14
-	137,	// sample 15
-	128,	// sample 16
-	122,	// sample 17
-	118,	// sample 18
-	117,	// sample 19
-	120,	// sample 20
-	127,	// sample 21
-	135,	// sample 22
-	148,	// sample 23
-	160,	// sample 24
-	175,	// sample 25
-	190,	// sample 26
-	204,	// sample 27
-	217,	// sample 28
-	227,	// sample 29
-	235,	// sample 30
-	240,	// sample 31
-	242,	// sample 32
-	239,	// sample 33
-	233,	// sample 34
-	225,	// sample 35
-	214,	// sample 36
-	200,	// sample 37
-	186,	// sample 38
-	170,	// sample 39
-	158,	// sample 40
-	143,	// sample 41
-	133,	// sample 42
-	124,	// sample 43
-	118,	// sample 44
-	115,	// sample 45
-	117,	// sample 46
-	122,	// sample 47
-	128,	// sample 48
-	137,	// sample 49
-	149,	// sample 50
-	160,	// sample 51
-	171,	// sample 52
-	182,	// sample 53
-	191,	// sample 54
-	197,	// sample 55
-	201,	// sample 56
-	202,	// sample 57
-	199,	// sample 58
-	193,	// sample 59
-	184,	// sample 60
-	173,	// sample 61
-	158,	// sample 62
-	142,	// sample 63
-	130,	// -------- wave 073 (49h), sample 00
-	150,	// sample 01
-	168,	// sample 02
-	182,	// sample 03
-	193,	// sample 04
-	200,	// sample 05
-	201,	// sample 06
-	198,	// sample 07
-	190,	// sample 08
-	179,	// sample 09
-	166,	// sample 10
-	152,	// sample 11
-	138,	// sample 12
-	126,	// sample 13
-	118,	// sample 14
-	113,	// sample 15
-	112,	// sample 16
-	117,	// sample 17
-	126,	// sample 18
-	139,	// sample 19
-	155,	// sample 20
-	173,	// sample 21
-	191,	// sample 22
-	209,	// sample 23
-	222,	// sample 24
-	232,	// sample 25
-	238,	// sample 26
-	239,	// sample 27
-	236,	// sample 28
-	227,	// sample 29
-	216,	// sample 30
-	200,	// sample 31
-	184,	// sample 32
-	167,	// sample 33
-	152,	// sample 34
-	140,	// sample 35
-	131,	// sample 36
-	125,	// sample 37
-	127,	// sample 38
-	131,	// sample 39
-	141,	// sample 40
-	153,	// sample 41
-	167,	// sample 42
-	183,	// sample 43
-	197,	// sample 44
-	210,	// sample 45
-	219,	// sample 46
-	223,	// sample 47
-	224,	// sample 48
-	220,	// sample 49
-	210,	// sample 50
-	196,	// sample 51
-	179,	// sample 52
-	160,	// sample 53
-	141,	// sample 54
-	122,	// sample 55
-	107,	// sample 56
-	 96,	// sample 57
-	 87,	// sample 58
-	 85,	// sample 59
-	 87,	// sample 60
-	 93,	// sample 61
-	101,	// sample 62
-	114,	// sample 63
-	130,	// -------- wave 074 (4ah), sample 00
-	157,	// sample 01
-	181,	// sample 02
-	197,	// sample 03
-	209,	// sample 04
-	209,	// sample 05
-	203,	// sample 06
-	190,	// sample 07
-	173,	// sample 08
-	153,	// sample 09
-	134,	// sample 10
-	117,	// sample 11
-	104,	// sample 12
-	100,	// sample 13
-	103,	// sample 14
-	113,	// sample 15
-	128,	// sample 16
-	149,	// sample 17
-	170,	// sample 18
-	192,	// sample 19
-	212,	// sample 20
-	227,	// sample 21
-	235,	// sample 22
-	239,	// sample 23
-	234,	// sample 24
-	224,	// sample 25
-	208,	// sample 26
-	191,	// sample 27
-	171,	// sample 28
-	154,	// sample 29
-	141,	// sample 30
-	131,	// sample 31
-	128,	// sample 32
-	133,	// sample 33
-	141,	// sample 34
-	156,	// sample 35
-	173,	// sample 36
-	192,	// sample 37
-	211,	// sample 38
-	223,	// sample 39
-	230,	// sample 40
-	233,	// sample 41
-	228,	// sample 42
-	217,	// sample 43
-	202,	// sample 44
-	183,	// sample 45
-	162,	// sample 46
-	144,	// sample 47
-	128,	// sample 48
-	118,	// sample 49
-	112,	// sample 50
-	113,	// sample 51
-	120,	// sample 52
-	131,	// sample 53
-	144,	// sample 54
-	157,	// sample 55
-	169,	// sample 56
-	181,	// sample 57
-	185,	// sample 58
-	187,	// sample 59
-	182,	// sample 60
-	173,	// sample 61
-	160,	// sample 62
-	143,	// sample 63
-	130,	// -------- wave 075 (4bh), sample 00
-	160,	// sample 01
-	187,	// sample 02
-	201,	// sample 03
-	210,	// sample 04
-	205,	// sample 05
-	191,	// sample 06
-	171,	// sample 07
-	147,	// sample 08
-	125,	// sample 09
-	107,	// sample 10
-	 97,	// sample 11
-	 96,	// sample 12
-	106,	// sample 13
-	124,	// sample 14
-	148,	// sample 15
-	172,	// sample 16
-	197,	// sample 17
-	219,	// sample 18
-	231,	// sample 19
-	235,	// sample 20
-	231,	// sample 21
-	219,	// sample 22
-	201,	// sample 23
-	179,	// sample 24
-	159,	// sample 25
-	140,	// sample 26
-	131,	// sample 27
-	126,	// sample 28
-	133,	// sample 29
-	146,	// sample 30
-	163,	// sample 31
-	186,	// sample 32
-	207,	// sample 33
-	225,	// sample 34
-	235,	// sample 35
-	239,	// sample 36
-	233,	// sample 37
-	221,	// sample 38
-	200,	// sample 39
-	179,	// sample 40
-	156,	// sample 41
-	138,	// sample 42
-	125,	// sample 43
-	120,	// sample 44
-	126,	// sample 45
-	138,	// sample 46
-	153,	// sample 47
-	170,	// sample 48
-	189,	// sample 49
-	202,	// sample 50
-	207,	// sample 51
-	208,	// sample 52
-	200,	// sample 53
-	186,	// sample 54
-	165,	// sample 55
-	146,	// sample 56
-	125,	// sample 57
-	107,	// sample 58
-	 98,	// sample 59
-	 93,	// sample 60
-	 96,	// sample 61
-	100,	// sample 62
-	112,	// sample 63
-	130,	// -------- wave 076 (4ch), sample 00
-	163,	// sample 01
-	191,	// sample 02
-	206,	// sample 03
-	208,	// sample 04
-	196,	// sample 05
-	174,	// sample 06
-	148,	// sample 07
-	121,	// sample 08
-	101,	// sample 09
-	 93,	// sample 10
-	 94,	// sample 11
-	108,	// sample 12
-	134,	// sample 13
-	163,	// sample 14
-	193,	// sample 15
-	218,	// sample 16
-	231,	// sample 17
-	232,	// sample 18
-	224,	// sample 19
-	207,	// sample 20
-	183,	// sample 21
-	159,	// sample 22
-	139,	// sample 23
-	126,	// sample 24
-	125,	// sample 25
-	134,	// sample 26
-	152,	// sample 27
-	174,	// sample 28
-	200,	// sample 29
-	222,	// sample 30
-	235,	// sample 31
-	240,	// sample 32
-	232,	// sample 33
-	218,	// sample 34
-	196,	// sample 35
-	170,	// sample 36
-	149,	// sample 37
-	136,	// sample 38
-	127,	// sample 39
-	134,	// sample 40
-	145,	// sample 41
-	166,	// sample 42
-	186,	// sample 43
-	204,	// sample 44
-	216,	// sample 45
-	221,	// sample 46
-	213,	// sample 47
-	198,	// sample 48
-	176,	// sample 49
-	155,	// sample 50
-	133,	// sample 51
-	120,	// sample 52
-	113,	// sample 53
-	114,	// sample 54
-	121,	// sample 55
-	136,	// sample 56
-	152,	// sample 57
-	165,	// sample 58
-	175,	// sample 59
-	178,	// sample 60
-	173,	// sample 61
-	162,	// sample 62
-	145,	// sample 63
-	130,	// -------- wave 077 (4dh), sample 00
-	142,	// sample 01
-	153,	// sample 02
-	160,	// sample 03
-	164,	// sample 04
-	164,	// sample 05
-	164,	// sample 06
-	161,	// sample 07
-	160,	// sample 08
-	159,	// sample 09
-	160,	// sample 10
-	164,	// sample 11
-	170,	// sample 12
-	178,	// sample 13
-	189,	// sample 14
-	200,	// sample 15
-	208,	// sample 16
-	215,	// sample 17
-	217,	// sample 18
-	218,	// sample 19
-	215,	// sample 20
-	213,	// sample 21
-	207,	// sample 22
-	204,	// sample 23
-	202,	// sample 24
-	203,	// sample 25
-	206,	// sample 26
-	212,	// sample 27
-	219,	// sample 28
-	225,	// sample 29
-	232,	// sample 30
-	236,	// sample 31
-	237,	// sample 32
-	236,	// sample 33
-	231,	// sample 34
-	225,	// sample 35
-	218,	// sample 36
-	210,	// sample 37
-	204,	// sample 38
-	201,	// sample 39
-	201,	// sample 40
-	202,	// sample 41
-	207,	// sample 42
-	210,	// sample 43
-	214,	// sample 44
-	215,	// sample 45
-	215,	// sample 46
-	211,	// sample 47
-	205,	// sample 48
-	195,	// sample 49
-	184,	// sample 50
-	174,	// sample 51
-	166,	// sample 52
-	160,	// sample 53
-	156,	// sample 54
-	155,	// sample 55
-	157,	// sample 56
-	159,	// sample 57
-	160,	// sample 58
-	162,	// sample 59
-	160,	// sample 60
-	156,	// sample 61
-	147,	// sample 62
-	136,	// sample 63
-	130,	// -------- wave 078 (4eh), sample 00
-	146,	// sample 01
-	158,	// sample 02
-	167,	// sample 03
-	174,	// sample 04
-	178,	// sample 05
-	179,	// sample 06
-	179,	// sample 07
-	178,	// sample 08
-	177,	// sample 09
-	179,	// sample 10
-	184,	// sample 11
-	190,	// sample 12
-	198,	// sample 13
-	208,	// sample 14
-	218,	// sample 15
-	223,	// sample 16
-	227,	// sample 17
-	227,	// sample 18
-	225,	// sample 19
-	220,	// sample 20
-	212,	// sample 21
-	203,	// sample 22
-	195,	// sample 23
-	189,	// sample 24
-	185,	// sample 25
-	182,	// sample 26
-	182,	// sample 27
-	183,	// sample 28
-	184,	// sample 29
-	185,	// sample 30
-	183,	// sample 31
-	179,	// sample 32
-	172,	// sample 33
-	162,	// sample 34
-	152,	// sample 35
-	140,	// sample 36
-	127,	// sample 37
-	118,	// sample 38
-	111,	// sample 39
-	107,	// sample 40
-	107,	// sample 41
-	109,	// sample 42
-	112,	// sample 43
-	115,	// sample 44
-	116,	// sample 45
-	115,	// sample 46
-	112,	// sample 47
-	108,	// sample 48
-	101,	// sample 49
-	 95,	// sample 50
-	 88,	// sample 51
-	 85,	// sample 52
-	 83,	// sample 53
-	 84,	// sample 54
-	 89,	// sample 55
-	 97,	// sample 56
-	105,	// sample 57
-	115,	// sample 58
-	124,	// sample 59
-	129,	// sample 60
-	133,	// sample 61
-	133,	// sample 62
-	131,	// sample 63
-	130,	// -------- wave 079 (4fh), sample 00
-	149,	// sample 01
-	163,	// sample 02
-	175,	// sample 03
-	183,	// sample 04
-	187,	// sample 05
-	187,	// sample 06
-	186,	// sample 07
-	184,	// sample 08
-	185,	// sample 09
-	189,	// sample 10
-	194,	// sample 11
-	200,	// sample 12
-	206,	// sample 13
-	211,	// sample 14
-	213,	// sample 15
-	210,	// sample 16
-	202,	// sample 17
-	191,	// sample 18
-	177,	// sample 19
-	163,	// sample 20
-	150,	// sample 21
-	140,	// sample 22
-	133,	// sample 23
-	130,	// sample 24
-	130,	// sample 25
-	131,	// sample 26
-	132,	// sample 27
-	132,	// sample 28
-	129,	// sample 29
-	124,	// sample 30
-	116,	// sample 31
-	108,	// sample 32
-	101,	// sample 33
-	 98,	// sample 34
-	100,	// sample 35
-	105,	// sample 36
-	114,	// sample 37
-	126,	// sample 38
-	140,	// sample 39
-	153,	// sample 40
-	163,	// sample 41
-	171,	// sample 42
-	175,	// sample 43
-	177,	// sample 44
-	176,	// sample 45
-	176,	// sample 46
-	177,	// sample 47
-	181,	// sample 48
-	186,	// sample 49
-	194,	// sample 50
-	203,	// sample 51
-	211,	// sample 52
-	216,	// sample 53
-	216,	// sample 54
-	212,	// sample 55
-	205,	// sample 56
-	191,	// sample 57
-	178,	// sample 58
-	164,	// sample 59
-	152,	// sample 60
-	141,	// sample 61
-	134,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 080 (50h), sample 00
-	148,	// sample 01
-	161,	// sample 02
-	174,	// sample 03
-	179,	// sample 04
-	180,	// sample 05
-	179,	// sample 06
-	178,	// sample 07
-	176,	// sample 08
-	175,	// sample 09
-	178,	// sample 10
-	179,	// sample 11
-	181,	// sample 12
-	181,	// sample 13
-	177,	// sample 14
-	169,	// sample 15
-	159,	// sample 16
-	144,	// sample 17
-	130,	// sample 18
-	118,	// sample 19
-	108,	// sample 20
-	104,	// sample 21
-	104,	// sample 22
-	108,	// sample 23
-	114,	// sample 24
-	122,	// sample 25
-	128,	// sample 26
-	131,	// sample 27
-	133,	// sample 28
-	135,	// sample 29
-	137,	// sample 30
-	141,	// sample 31
-	148,	// sample 32
-	160,	// sample 33
-	172,	// sample 34
-	187,	// sample 35
-	200,	// sample 36
-	210,	// sample 37
-	214,	// sample 38
-	213,	// sample 39
-	209,	// sample 40
-	199,	// sample 41
-	191,	// sample 42
-	181,	// sample 43
-	174,	// sample 44
-	168,	// sample 45
-	165,	// sample 46
-	161,	// sample 47
-	158,	// sample 48
-	150,	// sample 49
-	141,	// sample 50
-	127,	// sample 51
-	112,	// sample 52
-	 99,	// sample 53
-	 89,	// sample 54
-	 82,	// sample 55
-	 81,	// sample 56
-	 86,	// sample 57
-	 92,	// sample 58
-	102,	// sample 59
-	112,	// sample 60
-	120,	// sample 61
-	124,	// sample 62
-	127,	// sample 63
-	130,	// -------- wave 081 (51h), sample 00
-	155,	// sample 01
-	175,	// sample 02
-	189,	// sample 03
-	195,	// sample 04
-	195,	// sample 05
-	191,	// sample 06
-	185,	// sample 07
-	180,	// sample 08
-	177,	// sample 09
-	177,	// sample 10
-	175,	// sample 11
-	170,	// sample 12
-	162,	// sample 13
-	149,	// sample 14
-	132,	// sample 15
-	114,	// sample 16
-	 98,	// sample 17
-	 90,	// sample 18
-	 87,	// sample 19
-	 94,	// sample 20
-	107,	// sample 21
-	124,	// sample 22
-	143,	// sample 23
-	158,	// sample 24
-	170,	// sample 25
-	178,	// sample 26
-	183,	// sample 27
-	187,	// sample 28
-	194,	// sample 29
-	202,	// sample 30
-	213,	// sample 31
-	223,	// sample 32
-	228,	// sample 33
-	228,	// sample 34
-	222,	// sample 35
-	207,	// sample 36
-	185,	// sample 37
-	162,	// sample 38
-	141,	// sample 39
-	125,	// sample 40
-	114,	// sample 41
-	111,	// sample 42
-	112,	// sample 43
-	113,	// sample 44
-	115,	// sample 45
-	116,	// sample 46
-	116,	// sample 47
-	115,	// sample 48
-	115,	// sample 49
-	123,	// sample 50
-	134,	// sample 51
-	151,	// sample 52
-	169,	// sample 53
-	188,	// sample 54
-	202,	// sample 55
-	209,	// sample 56
-	209,	// sample 57
-	200,	// sample 58
-	186,	// sample 59
-	170,	// sample 60
-	156,	// sample 61
-	143,	// sample 62
-	134,	// sample 63
-	130,	// -------- wave 082 (52h), sample 00
-	159,	// sample 01
-	180,	// sample 02
-	193,	// sample 03
-	197,	// sample 04
-	194,	// sample 05
-	185,	// sample 06
-	176,	// sample 07
-	168,	// sample 08
-	162,	// sample 09
-	159,	// sample 10
-	153,	// sample 11
-	142,	// sample 12
-	128,	// sample 13
-	112,	// sample 14
-	 97,	// sample 15
-	 88,	// sample 16
-	 88,	// sample 17
-	 98,	// sample 18
-	117,	// sample 19
-	143,	// sample 20
-	168,	// sample 21
-	189,	// sample 22
-	204,	// sample 23
-	211,	// sample 24
-	211,	// sample 25
-	209,	// sample 26
-	207,	// sample 27
-	206,	// sample 28
-	204,	// sample 29
-	201,	// sample 30
-	193,	// sample 31
-	179,	// sample 32
-	160,	// sample 33
-	137,	// sample 34
-	116,	// sample 35
-	100,	// sample 36
-	 93,	// sample 37
-	 97,	// sample 38
-	111,	// sample 39
-	129,	// sample 40
-	149,	// sample 41
-	165,	// sample 42
-	178,	// sample 43
-	184,	// sample 44
-	188,	// sample 45
-	190,	// sample 46
-	195,	// sample 47
-	201,	// sample 48
-	205,	// sample 49
-	206,	// sample 50
-	199,	// sample 51
-	184,	// sample 52
-	160,	// sample 53
-	133,	// sample 54
-	106,	// sample 55
-	 87,	// sample 56
-	 75,	// sample 57
-	 73,	// sample 58
-	 81,	// sample 59
-	 93,	// sample 60
-	104,	// sample 61
-	115,	// sample 62
-	123,	// sample 63
-	130,	// -------- wave 083 (53h), sample 00
-	161,	// sample 01
-	185,	// sample 02
-	197,	// sample 03
-	199,	// sample 04
-	189,	// sample 05
-	176,	// sample 06
-	164,	// sample 07
-	153,	// sample 08
-	145,	// sample 09
-	138,	// sample 10
-	128,	// sample 11
-	116,	// sample 12
-	103,	// sample 13
-	 94,	// sample 14
-	 93,	// sample 15
-	101,	// sample 16
-	122,	// sample 17
-	151,	// sample 18
-	181,	// sample 19
-	206,	// sample 20
-	222,	// sample 21
-	223,	// sample 22
-	218,	// sample 23
-	205,	// sample 24
-	191,	// sample 25
-	178,	// sample 26
-	169,	// sample 27
-	159,	// sample 28
-	149,	// sample 29
-	136,	// sample 30
-	121,	// sample 31
-	108,	// sample 32
-	103,	// sample 33
-	107,	// sample 34
-	124,	// sample 35
-	151,	// sample 36
-	179,	// sample 37
-	206,	// sample 38
-	222,	// sample 39
-	225,	// sample 40
-	220,	// sample 41
-	206,	// sample 42
-	189,	// sample 43
-	175,	// sample 44
-	163,	// sample 45
-	154,	// sample 46
-	142,	// sample 47
-	128,	// sample 48
-	113,	// sample 49
-	 97,	// sample 50
-	 88,	// sample 51
-	 89,	// sample 52
-	 99,	// sample 53
-	122,	// sample 54
-	149,	// sample 55
-	175,	// sample 56
-	194,	// sample 57
-	201,	// sample 58
-	197,	// sample 59
-	184,	// sample 60
-	166,	// sample 61
-	152,	// sample 62
-	138,	// sample 63
-	130,	// -------- wave 084 (54h), sample 00
-	158,	// sample 01
-	179,	// sample 02
-	187,	// sample 03
-	184,	// sample 04
-	172,	// sample 05
-	159,	// sample 06
-	146,	// sample 07
-	135,	// sample 08
-	128,	// sample 09
-	120,	// sample 10
-	113,	// sample 11
-	105,	// sample 12
-	102,	// sample 13
-	106,	// sample 14
-	120,	// sample 15
-	143,	// sample 16
-	170,	// sample 17
-	195,	// sample 18
-	210,	// sample 19
-	212,	// sample 20
-	202,	// sample 21
-	182,	// sample 22
-	161,	// sample 23
-	144,	// sample 24
-	134,	// sample 25
-	128,	// sample 26
-	126,	// sample 27
-	123,	// sample 28
-	123,	// sample 29
-	125,	// sample 30
-	134,	// sample 31
-	148,	// sample 32
-	169,	// sample 33
-	193,	// sample 34
-	210,	// sample 35
-	219,	// sample 36
-	213,	// sample 37
-	193,	// sample 38
-	167,	// sample 39
-	144,	// sample 40
-	125,	// sample 41
-	115,	// sample 42
-	114,	// sample 43
-	117,	// sample 44
-	122,	// sample 45
-	127,	// sample 46
-	133,	// sample 47
-	142,	// sample 48
-	155,	// sample 49
-	173,	// sample 50
-	187,	// sample 51
-	199,	// sample 52
-	199,	// sample 53
-	185,	// sample 54
-	161,	// sample 55
-	134,	// sample 56
-	107,	// sample 57
-	 90,	// sample 58
-	 86,	// sample 59
-	 90,	// sample 60
-	 98,	// sample 61
-	110,	// sample 62
-	120,	// sample 63
-	135,	// -------- wave 085 (55h), sample 00
-	184,	// sample 01
-	218,	// sample 02
-	228,	// sample 03
-	219,	// sample 04
-	197,	// sample 05
-	180,	// sample 06
-	176,	// sample 07
-	183,	// sample 08
-	196,	// sample 09
-	206,	// sample 10
-	207,	// sample 11
-	199,	// sample 12
-	189,	// sample 13
-	181,	// sample 14
-	184,	// sample 15
-	193,	// sample 16
-	201,	// sample 17
-	199,	// sample 18
-	189,	// sample 19
-	173,	// sample 20
-	160,	// sample 21
-	155,	// sample 22
-	157,	// sample 23
-	160,	// sample 24
-	160,	// sample 25
-	140,	// sample 26
-	113,	// sample 27
-	 81,	// sample 28
-	 63,	// sample 29
-	 64,	// sample 30
-	 89,	// sample 31
-	131,	// sample 32
-	171,	// sample 33
-	195,	// sample 34
-	198,	// sample 35
-	179,	// sample 36
-	152,	// sample 37
-	129,	// sample 38
-	120,	// sample 39
-	123,	// sample 40
-	135,	// sample 41
-	142,	// sample 42
-	144,	// sample 43
-	136,	// sample 44
-	127,	// sample 45
-	123,	// sample 46
-	128,	// sample 47
-	140,	// sample 48
-	151,	// sample 49
-	156,	// sample 50
-	150,	// sample 51
-	137,	// sample 52
-	130,	// sample 53
-	129,	// sample 54
-	135,	// sample 55
-	144,	// sample 56
-	145,	// sample 57
-	132,	// sample 58
-	107,	// sample 59
-	 77,	// sample 60
-	 61,	// sample 61
-	 62,	// sample 62
-	 90,	// sample 63
-	132,	// -------- wave 086 (56h), sample 00
-	169,	// sample 01
-	200,	// sample 02
-	224,	// sample 03
-	239,	// sample 04
-	246,	// sample 05
-	247,	// sample 06
-	243,	// sample 07
-	236,	// sample 08
-	231,	// sample 09
-	226,	// sample 10
-	223,	// sample 11
-	221,	// sample 12
-	220,	// sample 13
-	221,	// sample 14
-	218,	// sample 15
-	217,	// sample 16
-	215,	// sample 17
-	212,	// sample 18
-	205,	// sample 19
-	202,	// sample 20
-	193,	// sample 21
-	189,	// sample 22
-	185,	// sample 23
-	182,	// sample 24
-	177,	// sample 25
-	173,	// sample 26
-	172,	// sample 27
-	166,	// sample 28
-	162,	// sample 29
-	159,	// sample 30
-	155,	// sample 31
-	155,	// sample 32
-	157,	// sample 33
-	159,	// sample 34
-	160,	// sample 35
-	164,	// sample 36
-	163,	// sample 37
-	163,	// sample 38
-	160,	// sample 39
-	159,	// sample 40
-	156,	// sample 41
-	155,	// sample 42
-	153,	// sample 43
-	150,	// sample 44
-	150,	// sample 45
-	147,	// sample 46
-	141,	// sample 47
-	137,	// sample 48
-	132,	// sample 49
-	129,	// sample 50
-	129,	// sample 51
-	128,	// sample 52
-	127,	// sample 53
-	126,	// sample 54
-	125,	// sample 55
-	124,	// sample 56
-	124,	// sample 57
-	124,	// sample 58
-	127,	// sample 59
-	127,	// sample 60
-	131,	// sample 61
-	128,	// sample 62
-	129,	// sample 63
-	132,	// -------- wave 087 (57h), sample 00
-	167,	// sample 01
-	197,	// sample 02
-	220,	// sample 03
-	230,	// sample 04
-	236,	// sample 05
-	232,	// sample 06
-	223,	// sample 07
-	213,	// sample 08
-	203,	// sample 09
-	195,	// sample 10
-	190,	// sample 11
-	190,	// sample 12
-	186,	// sample 13
-	189,	// sample 14
-	186,	// sample 15
-	182,	// sample 16
-	178,	// sample 17
-	174,	// sample 18
-	166,	// sample 19
-	164,	// sample 20
-	160,	// sample 21
-	159,	// sample 22
-	158,	// sample 23
-	156,	// sample 24
-	153,	// sample 25
-	146,	// sample 26
-	140,	// sample 27
-	130,	// sample 28
-	125,	// sample 29
-	121,	// sample 30
-	119,	// sample 31
-	120,	// sample 32
-	122,	// sample 33
-	128,	// sample 34
-	132,	// sample 35
-	140,	// sample 36
-	141,	// sample 37
-	143,	// sample 38
-	143,	// sample 39
-	144,	// sample 40
-	144,	// sample 41
-	144,	// sample 42
-	143,	// sample 43
-	145,	// sample 44
-	143,	// sample 45
-	138,	// sample 46
-	136,	// sample 47
-	130,	// sample 48
-	125,	// sample 49
-	122,	// sample 50
-	116,	// sample 51
-	115,	// sample 52
-	115,	// sample 53
-	117,	// sample 54
-	119,	// sample 55
-	123,	// sample 56
-	124,	// sample 57
-	126,	// sample 58
-	131,	// sample 59
-	132,	// sample 60
-	131,	// sample 61
-	131,	// sample 62
-	131,	// sample 63
-	131,	// -------- wave 088 (58h), sample 00
-	168,	// sample 01
-	199,	// sample 02
-	217,	// sample 03
-	223,	// sample 04
-	223,	// sample 05
-	218,	// sample 06
-	217,	// sample 07
-	219,	// sample 08
-	223,	// sample 09
-	228,	// sample 10
-	231,	// sample 11
-	235,	// sample 12
-	235,	// sample 13
-	232,	// sample 14
-	232,	// sample 15
-	224,	// sample 16
-	223,	// sample 17
-	217,	// sample 18
-	212,	// sample 19
-	212,	// sample 20
-	209,	// sample 21
-	211,	// sample 22
-	216,	// sample 23
-	214,	// sample 24
-	214,	// sample 25
-	212,	// sample 26
-	210,	// sample 27
-	210,	// sample 28
-	207,	// sample 29
-	207,	// sample 30
-	204,	// sample 31
-	202,	// sample 32
-	195,	// sample 33
-	188,	// sample 34
-	181,	// sample 35
-	173,	// sample 36
-	173,	// sample 37
-	175,	// sample 38
-	175,	// sample 39
-	176,	// sample 40
-	178,	// sample 41
-	178,	// sample 42
-	173,	// sample 43
-	173,	// sample 44
-	171,	// sample 45
-	166,	// sample 46
-	166,	// sample 47
-	162,	// sample 48
-	156,	// sample 49
-	152,	// sample 50
-	145,	// sample 51
-	143,	// sample 52
-	141,	// sample 53
-	141,	// sample 54
-	142,	// sample 55
-	142,	// sample 56
-	140,	// sample 57
-	139,	// sample 58
-	137,	// sample 59
-	133,	// sample 60
-	129,	// sample 61
-	127,	// sample 62
-	125,	// sample 63
-	131,	// -------- wave 089 (59h), sample 00
-	188,	// sample 01
-	227,	// sample 02
-	247,	// sample 03
-	249,	// sample 04
-	246,	// sample 05
-	243,	// sample 06
-	244,	// sample 07
-	242,	// sample 08
-	240,	// sample 09
-	237,	// sample 10
-	235,	// sample 11
-	233,	// sample 12
-	233,	// sample 13
-	234,	// sample 14
-	235,	// sample 15
-	231,	// sample 16
-	226,	// sample 17
-	223,	// sample 18
-	218,	// sample 19
-	216,	// sample 20
-	217,	// sample 21
-	217,	// sample 22
-	215,	// sample 23
-	209,	// sample 24
-	208,	// sample 25
-	209,	// sample 26
-	203,	// sample 27
-	202,	// sample 28
-	200,	// sample 29
-	198,	// sample 30
-	197,	// sample 31
-	196,	// sample 32
-	199,	// sample 33
-	192,	// sample 34
-	183,	// sample 35
-	182,	// sample 36
-	180,	// sample 37
-	183,	// sample 38
-	177,	// sample 39
-	175,	// sample 40
-	167,	// sample 41
-	164,	// sample 42
-	163,	// sample 43
-	161,	// sample 44
-	165,	// sample 45
-	159,	// sample 46
-	158,	// sample 47
-	156,	// sample 48
-	154,	// sample 49
-	156,	// sample 50
-	148,	// sample 51
-	144,	// sample 52
-	143,	// sample 53
-	143,	// sample 54
-	141,	// sample 55
-	136,	// sample 56
-	132,	// sample 57
-	129,	// sample 58
-	127,	// sample 59
-	127,	// sample 60
-	127,	// sample 61
-	123,	// sample 62
-	126,	// sample 63
-	132,	// -------- wave 090 (5ah), sample 00
-	180,	// sample 01
-	217,	// sample 02
-	242,	// sample 03
-	251,	// sample 04
-	253,	// sample 05
-	250,	// sample 06
-	239,	// sample 07
-	224,	// sample 08
-	209,	// sample 09
-	201,	// sample 10
-	194,	// sample 11
-	195,	// sample 12
-	189,	// sample 13
-	187,	// sample 14
-	182,	// sample 15
-	178,	// sample 16
-	170,	// sample 17
-	168,	// sample 18
-	161,	// sample 19
-	158,	// sample 20
-	153,	// sample 21
-	152,	// sample 22
-	153,	// sample 23
-	152,	// sample 24
-	148,	// sample 25
-	135,	// sample 26
-	127,	// sample 27
-	113,	// sample 28
-	105,	// sample 29
-	 99,	// sample 30
-	 97,	// sample 31
-	100,	// sample 32
-	106,	// sample 33
-	114,	// sample 34
-	122,	// sample 35
-	131,	// sample 36
-	135,	// sample 37
-	141,	// sample 38
-	144,	// sample 39
-	144,	// sample 40
-	142,	// sample 41
-	142,	// sample 42
-	141,	// sample 43
-	145,	// sample 44
-	148,	// sample 45
-	143,	// sample 46
-	134,	// sample 47
-	125,	// sample 48
-	117,	// sample 49
-	111,	// sample 50
-	109,	// sample 51
-	107,	// sample 52
-	104,	// sample 53
-	106,	// sample 54
-	111,	// sample 55
-	118,	// sample 56
-	122,	// sample 57
-	125,	// sample 58
-	128,	// sample 59
-	129,	// sample 60
-	134,	// sample 61
-	136,	// sample 62
-	133,	// sample 63
-	131,	// -------- wave 091 (5bh), sample 00
-	178,	// sample 01
-	218,	// sample 02
-	239,	// sample 03
-	247,	// sample 04
-	245,	// sample 05
-	232,	// sample 06
-	216,	// sample 07
-	203,	// sample 08
-	192,	// sample 09
-	186,	// sample 10
-	185,	// sample 11
-	187,	// sample 12
-	190,	// sample 13
-	191,	// sample 14
-	190,	// sample 15
-	182,	// sample 16
-	169,	// sample 17
-	153,	// sample 18
-	131,	// sample 19
-	110,	// sample 20
-	 95,	// sample 21
-	 87,	// sample 22
-	 84,	// sample 23
-	 88,	// sample 24
-	 94,	// sample 25
-	 98,	// sample 26
-	101,	// sample 27
-	101,	// sample 28
-	102,	// sample 29
-	104,	// sample 30
-	104,	// sample 31
-	111,	// sample 32
-	114,	// sample 33
-	121,	// sample 34
-	131,	// sample 35
-	136,	// sample 36
-	145,	// sample 37
-	149,	// sample 38
-	151,	// sample 39
-	148,	// sample 40
-	140,	// sample 41
-	133,	// sample 42
-	121,	// sample 43
-	116,	// sample 44
-	110,	// sample 45
-	108,	// sample 46
-	111,	// sample 47
-	113,	// sample 48
-	111,	// sample 49
-	111,	// sample 50
-	110,	// sample 51
-	111,	// sample 52
-	106,	// sample 53
-	108,	// sample 54
-	109,	// sample 55
-	112,	// sample 56
-	114,	// sample 57
-	111,	// sample 58
-	112,	// sample 59
-	114,	// sample 60
-	117,	// sample 61
-	118,	// sample 62
-	124,	// sample 63
-	132,	// -------- wave 092 (5ch), sample 00
-	176,	// sample 01
-	211,	// sample 02
-	232,	// sample 03
-	235,	// sample 04
-	224,	// sample 05
-	201,	// sample 06
-	176,	// sample 07
-	154,	// sample 08
-	139,	// sample 09
-	137,	// sample 10
-	140,	// sample 11
-	153,	// sample 12
-	160,	// sample 13
-	167,	// sample 14
-	171,	// sample 15
-	168,	// sample 16
-	162,	// sample 17
-	156,	// sample 18
-	150,	// sample 19
-	150,	// sample 20
-	153,	// sample 21
-	160,	// sample 22
-	168,	// sample 23
-	176,	// sample 24
-	181,	// sample 25
-	180,	// sample 26
-	173,	// sample 27
-	160,	// sample 28
-	145,	// sample 29
-	130,	// sample 30
-	120,	// sample 31
-	119,	// sample 32
-	123,	// sample 33
-	133,	// sample 34
-	145,	// sample 35
-	154,	// sample 36
-	158,	// sample 37
-	154,	// sample 38
-	145,	// sample 39
-	132,	// sample 40
-	118,	// sample 41
-	106,	// sample 42
-	104,	// sample 43
-	110,	// sample 44
-	121,	// sample 45
-	138,	// sample 46
-	158,	// sample 47
-	174,	// sample 48
-	184,	// sample 49
-	187,	// sample 50
-	184,	// sample 51
-	173,	// sample 52
-	159,	// sample 53
-	140,	// sample 54
-	123,	// sample 55
-	114,	// sample 56
-	108,	// sample 57
-	105,	// sample 58
-	108,	// sample 59
-	113,	// sample 60
-	117,	// sample 61
-	121,	// sample 62
-	126,	// sample 63
-	129,	// -------- wave 093 (5dh), sample 00
-	152,	// sample 01
-	170,	// sample 02
-	185,	// sample 03
-	199,	// sample 04
-	207,	// sample 05
-	211,	// sample 06
-	211,	// sample 07
-	208,	// sample 08
-	201,	// sample 09
-	193,	// sample 10
-	181,	// sample 11
-	172,	// sample 12
-	162,	// sample 13
-	155,	// sample 14
-	150,	// sample 15
-	146,	// sample 16
-	143,	// sample 17
-	143,	// sample 18
-	144,	// sample 19
-	144,	// sample 20
-	145,	// sample 21
-	142,	// sample 22
-	143,	// sample 23
-	140,	// sample 24
-	133,	// sample 25
-	130,	// sample 26
-	124,	// sample 27
-	116,	// sample 28
-	110,	// sample 29
-	105,	// sample 30
-	100,	// sample 31
-	 99,	// sample 32
-	101,	// sample 33
-	102,	// sample 34
-	107,	// sample 35
-	112,	// sample 36
-	118,	// sample 37
-	126,	// sample 38
-	132,	// sample 39
-	137,	// sample 40
-	140,	// sample 41
-	145,	// sample 42
-	145,	// sample 43
-	146,	// sample 44
-	146,	// sample 45
-	145,	// sample 46
-	146,	// sample 47
-	146,	// sample 48
-	148,	// sample 49
-	152,	// sample 50
-	158,	// sample 51
-	162,	// sample 52
-	171,	// sample 53
-	177,	// sample 54
-	182,	// sample 55
-	187,	// sample 56
-	190,	// sample 57
-	191,	// sample 58
-	186,	// sample 59
-	180,	// sample 60
-	168,	// sample 61
-	157,	// sample 62
-	142,	// sample 63
-	130,	// -------- wave 094 (5eh), sample 00
-	137,	// sample 01
-	144,	// sample 02
-	149,	// sample 03
-	156,	// sample 04
-	160,	// sample 05
-	165,	// sample 06
-	169,	// sample 07
-	174,	// sample 08
-	179,	// sample 09
-	185,	// sample 10
-	189,	// sample 11
-	191,	// sample 12
-	195,	// sample 13
-	198,	// sample 14
-	202,	// sample 15
-	204,	// sample 16
-	206,	// sample 17
-	206,	// sample 18
-	208,	// sample 19
-	209,	// sample 20
-	211,	// sample 21
-	211,	// sample 22
-	213,	// sample 23
-	212,	// sample 24
-	213,	// sample 25
-	213,	// sample 26
-	214,	// sample 27
-	214,	// sample 28
-	213,	// sample 29
-	214,	// sample 30
-	213,	// sample 31
-	213,	// sample 32
-	214,	// sample 33
-	213,	// sample 34
-	213,	// sample 35
-	213,	// sample 36
-	212,	// sample 37
-	212,	// sample 38
-	211,	// sample 39
-	212,	// sample 40
-	210,	// sample 41
-	210,	// sample 42
-	208,	// sample 43
-	207,	// sample 44
-	205,	// sample 45
-	205,	// sample 46
-	203,	// sample 47
-	201,	// sample 48
-	198,	// sample 49
-	195,	// sample 50
-	191,	// sample 51
-	188,	// sample 52
-	185,	// sample 53
-	180,	// sample 54
-	174,	// sample 55
-	170,	// sample 56
-	165,	// sample 57
-	160,	// sample 58
-	156,	// sample 59
-	150,	// sample 60
-	145,	// sample 61
-	138,	// sample 62
-	131,	// sample 63
-	132,	// -------- wave 095 (5fh), sample 00
-	144,	// sample 01
-	156,	// sample 02
-	164,	// sample 03
-	173,	// sample 04
-	180,	// sample 05
-	187,	// sample 06
-	191,	// sample 07
-	195,	// sample 08
-	199,	// sample 09
-	201,	// sample 10
-	204,	// sample 11
-	205,	// sample 12
-	207,	// sample 13
-	209,	// sample 14
-	212,	// sample 15
-	212,	// sample 16
-	212,	// sample 17
-	212,	// sample 18
-	213,	// sample 19
-	213,	// sample 20
-	213,	// sample 21
-	211,	// sample 22
-	214,	// sample 23
-	212,	// sample 24
-	213,	// sample 25
-	213,	// sample 26
-	214,	// sample 27
-	215,	// sample 28
-	217,	// sample 29
-	218,	// sample 30
-	218,	// sample 31
-	218,	// sample 32
-	217,	// sample 33
-	217,	// sample 34
-	215,	// sample 35
-	215,	// sample 36
-	213,	// sample 37
-	213,	// sample 38
-	211,	// sample 39
-	211,	// sample 40
-	210,	// sample 41
-	211,	// sample 42
-	211,	// sample 43
-	210,	// sample 44
-	210,	// sample 45
-	211,	// sample 46
-	211,	// sample 47
-	210,	// sample 48
-	207,	// sample 49
-	206,	// sample 50
-	204,	// sample 51
-	202,	// sample 52
-	199,	// sample 53
-	197,	// sample 54
-	193,	// sample 55
-	190,	// sample 56
-	186,	// sample 57
-	181,	// sample 58
-	176,	// sample 59
-	167,	// sample 60
-	159,	// sample 61
-	147,	// sample 62
-	138,	// sample 63
-	130,	// -------- wave 096 (60h), sample 00
-	141,	// sample 01
-	152,	// sample 02
-	160,	// sample 03
-	168,	// sample 04
-	174,	// sample 05
-	182,	// sample 06
-	187,	// sample 07
-	192,	// sample 08
-	197,	// sample 09
-	200,	// sample 10
-	202,	// sample 11
-	203,	// sample 12
-	203,	// sample 13
-	204,	// sample 14
-	204,	// sample 15
-	203,	// sample 16
-	203,	// sample 17
-	202,	// sample 18
-	201,	// sample 19
-	201,	// sample 20
-	202,	// sample 21
-	203,	// sample 22
-	204,	// sample 23
-	205,	// sample 24
-	207,	// sample 25
-	207,	// sample 26
-	209,	// sample 27
-	212,	// sample 28
-	212,	// sample 29
-	214,	// sample 30
-	213,	// sample 31
-	214,	// sample 32
-	213,	// sample 33
-	212,	// sample 34
-	212,	// sample 35
-	210,	// sample 36
-	208,	// sample 37
-	207,	// sample 38
-	204,	// sample 39
-	204,	// sample 40
-	202,	// sample 41
-	203,	// sample 42
-	199,	// sample 43
-	200,	// sample 44
-	199,	// sample 45
-	201,	// sample 46
-	201,	// sample 47
-	201,	// sample 48
-	201,	// sample 49
-	201,	// sample 50
-	200,	// sample 51
-	200,	// sample 52
-	198,	// sample 53
-	195,	// sample 54
-	191,	// sample 55
-	188,	// sample 56
-	183,	// sample 57
-	177,	// sample 58
-	171,	// sample 59
-	162,	// sample 60
-	155,	// sample 61
-	144,	// sample 62
-	135,	// sample 63
-	131,	// -------- wave 097 (61h), sample 00
-	154,	// sample 01
-	173,	// sample 02
-	187,	// sample 03
-	193,	// sample 04
-	197,	// sample 05
-	194,	// sample 06
-	193,	// sample 07
-	194,	// sample 08
-	198,	// sample 09
-	201,	// sample 10
-	203,	// sample 11
-	206,	// sample 12
-	206,	// sample 13
-	207,	// sample 14
-	205,	// sample 15
-	206,	// sample 16
-	205,	// sample 17
-	206,	// sample 18
-	208,	// sample 19
-	209,	// sample 20
-	211,	// sample 21
-	210,	// sample 22
-	211,	// sample 23
-	210,	// sample 24
-	211,	// sample 25
-	212,	// sample 26
-	213,	// sample 27
-	214,	// sample 28
-	215,	// sample 29
-	216,	// sample 30
-	216,	// sample 31
-	215,	// sample 32
-	216,	// sample 33
-	215,	// sample 34
-	214,	// sample 35
-	213,	// sample 36
-	211,	// sample 37
-	212,	// sample 38
-	209,	// sample 39
-	210,	// sample 40
-	208,	// sample 41
-	210,	// sample 42
-	209,	// sample 43
-	208,	// sample 44
-	206,	// sample 45
-	205,	// sample 46
-	204,	// sample 47
-	203,	// sample 48
-	203,	// sample 49
-	203,	// sample 50
-	205,	// sample 51
-	203,	// sample 52
-	201,	// sample 53
-	197,	// sample 54
-	193,	// sample 55
-	189,	// sample 56
-	187,	// sample 57
-	191,	// sample 58
-	191,	// sample 59
-	187,	// sample 60
-	180,	// sample 61
-	164,	// sample 62
-	145,	// sample 63
-	132,	// -------- wave 098 (62h), sample 00
-	172,	// sample 01
-	204,	// sample 02
-	218,	// sample 03
-	221,	// sample 04
-	214,	// sample 05
-	205,	// sample 06
-	204,	// sample 07
-	205,	// sample 08
-	204,	// sample 09
-	205,	// sample 10
-	202,	// sample 11
-	201,	// sample 12
-	197,	// sample 13
-	197,	// sample 14
-	198,	// sample 15
-	197,	// sample 16
-	200,	// sample 17
-	205,	// sample 18
-	210,	// sample 19
-	214,	// sample 20
-	223,	// sample 21
-	220,	// sample 22
-	221,	// sample 23
-	218,	// sample 24
-	217,	// sample 25
-	215,	// sample 26
-	214,	// sample 27
-	211,	// sample 28
-	207,	// sample 29
-	201,	// sample 30
-	196,	// sample 31
-	196,	// sample 32
-	201,	// sample 33
-	203,	// sample 34
-	204,	// sample 35
-	208,	// sample 36
-	212,	// sample 37
-	217,	// sample 38
-	219,	// sample 39
-	220,	// sample 40
-	217,	// sample 41
-	219,	// sample 42
-	213,	// sample 43
-	212,	// sample 44
-	207,	// sample 45
-	203,	// sample 46
-	201,	// sample 47
-	194,	// sample 48
-	191,	// sample 49
-	195,	// sample 50
-	199,	// sample 51
-	199,	// sample 52
-	199,	// sample 53
-	194,	// sample 54
-	192,	// sample 55
-	195,	// sample 56
-	205,	// sample 57
-	215,	// sample 58
-	221,	// sample 59
-	216,	// sample 60
-	200,	// sample 61
-	178,	// sample 62
-	153,	// sample 63
-	131,	// -------- wave 099 (63h), sample 00
-	158,	// sample 01
-	179,	// sample 02
-	199,	// sample 03
-	214,	// sample 04
-	225,	// sample 05
-	234,	// sample 06
-	239,	// sample 07
-	243,	// sample 08
-	243,	// sample 09
-	246,	// sample 10
-	246,	// sample 11
-	244,	// sample 12
-	242,	// sample 13
-	240,	// sample 14
-	234,	// sample 15
-	229,	// sample 16
-	218,	// sample 17
-	210,	// sample 18
-	200,	// sample 19
-	192,	// sample 20
-	182,	// sample 21
-	170,	// sample 22
-	166,	// sample 23
-	157,	// sample 24
-	150,	// sample 25
-	146,	// sample 26
-	140,	// sample 27
-	136,	// sample 28
-	133,	// sample 29
-	132,	// sample 30
-	125,	// sample 31
-	123,	// sample 32
-	122,	// sample 33
-	121,	// sample 34
-	121,	// sample 35
-	120,	// sample 36
-	116,	// sample 37
-	118,	// sample 38
-	119,	// sample 39
-	119,	// sample 40
-	122,	// sample 41
-	124,	// sample 42
-	126,	// sample 43
-	132,	// sample 44
-	131,	// sample 45
-	134,	// sample 46
-	135,	// sample 47
-	137,	// sample 48
-	136,	// sample 49
-	137,	// sample 50
-	139,	// sample 51
-	139,	// sample 52
-	140,	// sample 53
-	139,	// sample 54
-	138,	// sample 55
-	139,	// sample 56
-	139,	// sample 57
-	140,	// sample 58
-	135,	// sample 59
-	134,	// sample 60
-	133,	// sample 61
-	129,	// sample 62
-	130,	// sample 63
-	131,	// -------- wave 100 (64h), sample 00
-	175,	// sample 01
-	194,	// sample 02
-	190,	// sample 03
-	186,	// sample 04
-	188,	// sample 05
-	189,	// sample 06
-	186,	// sample 07
-	187,	// sample 08
-	189,	// sample 09
-	194,	// sample 10
-	189,	// sample 11
-	188,	// sample 12
-	188,	// sample 13
-	192,	// sample 14
-	191,	// sample 15
-	189,	// sample 16
-	188,	// sample 17
-	187,	// sample 18
-	187,	// sample 19
-	184,	// sample 20
-	189,	// sample 21
-	191,	// sample 22
-	189,	// sample 23
-	187,	// sample 24
-	186,	// sample 25
-	187,	// sample 26
-	187,	// sample 27
-	187,	// sample 28
-	188,	// sample 29
-	193,	// sample 30
-	191,	// sample 31
-	188,	// sample 32
-	191,	// sample 33
-	191,	// sample 34
-	188,	// sample 35
-	185,	// sample 36
-	185,	// sample 37
-	187,	// sample 38
-	185,	// sample 39
-	186,	// sample 40
-	186,	// sample 41
-	190,	// sample 42
-	187,	// sample 43
-	184,	// sample 44
-	185,	// sample 45
-	188,	// sample 46
-	187,	// sample 47
-	187,	// sample 48
-	188,	// sample 49
-	188,	// sample 50
-	187,	// sample 51
-	187,	// sample 52
-	187,	// sample 53
-	190,	// sample 54
-	187,	// sample 55
-	183,	// sample 56
-	184,	// sample 57
-	187,	// sample 58
-	186,	// sample 59
-	181,	// sample 60
-	183,	// sample 61
-	188,	// sample 62
-	169,	// sample 63
-	131,	// -------- wave 101 (65h), sample 00
-	137,	// sample 01
-	144,	// sample 02
-	149,	// sample 03
-	155,	// sample 04
-	159,	// sample 05
-	164,	// sample 06
-	170,	// sample 07
-	174,	// sample 08
-	180,	// sample 09
-	186,	// sample 10
-	191,	// sample 11
-	196,	// sample 12
-	201,	// sample 13
-	205,	// sample 14
-	210,	// sample 15
-	214,	// sample 16
-	218,	// sample 17
-	220,	// sample 18
-	223,	// sample 19
-	226,	// sample 20
-	230,	// sample 21
-	232,	// sample 22
-	235,	// sample 23
-	236,	// sample 24
-	239,	// sample 25
-	240,	// sample 26
-	242,	// sample 27
-	243,	// sample 28
-	244,	// sample 29
-	245,	// sample 30
-	245,	// sample 31
-	245,	// sample 32
-	245,	// sample 33
-	244,	// sample 34
-	243,	// sample 35
-	242,	// sample 36
-	240,	// sample 37
-	239,	// sample 38
-	236,	// sample 39
-	235,	// sample 40
-	232,	// sample 41
-	230,	// sample 42
-	226,	// sample 43
-	223,	// sample 44
-	220,	// sample 45
-	218,	// sample 46
-	214,	// sample 47
-	210,	// sample 48
-	205,	// sample 49
-	201,	// sample 50
-	196,	// sample 51
-	191,	// sample 52
-	186,	// sample 53
-	180,	// sample 54
-	174,	// sample 55
-	170,	// sample 56
-	164,	// sample 57
-	159,	// sample 58
-	155,	// sample 59
-	149,	// sample 60
-	144,	// sample 61
-	137,	// sample 62
-	131,	// sample 63
-	130,	// -------- wave 102 (66h), sample 00
-	163,	// sample 01
-	191,	// sample 02
-	213,	// sample 03
-	230,	// sample 04
-	239,	// sample 05
-	243,	// sample 06
-	241,	// sample 07
-	233,	// sample 08
-	223,	// sample 09
-	206,	// sample 10
-	189,	// sample 11
-	167,	// sample 12
-	146,	// sample 13
-	126,	// sample 14
-	110,	// sample 15
-	 95,	// sample 16
-	 84,	// sample 17
-	 81,	// sample 18
-	 78,	// sample 19
-	 79,	// sample 20
-	 83,	// sample 21
-	 90,	// sample 22
-	 96,	// sample 23
-	101,	// sample 24
-	113,	// sample 25
-	119,	// sample 26
-	126,	// sample 27
-	130,	// sample 28
-	133,	// sample 29
-	130,	// sample 30
-	129,	// sample 31
-	125,	// sample 32
-	122,	// sample 33
-	118,	// sample 34
-	114,	// sample 35
-	112,	// sample 36
-	110,	// sample 37
-	108,	// sample 38
-	110,	// sample 39
-	113,	// sample 40
-	120,	// sample 41
-	127,	// sample 42
-	133,	// sample 43
-	141,	// sample 44
-	149,	// sample 45
-	155,	// sample 46
-	158,	// sample 47
-	160,	// sample 48
-	160,	// sample 49
-	159,	// sample 50
-	158,	// sample 51
-	154,	// sample 52
-	147,	// sample 53
-	139,	// sample 54
-	133,	// sample 55
-	127,	// sample 56
-	123,	// sample 57
-	121,	// sample 58
-	123,	// sample 59
-	125,	// sample 60
-	126,	// sample 61
-	126,	// sample 62
-	129,	// sample 63
-	128,	// -------- wave 103 (67h), sample 00
-	208,	// sample 01
-	235,	// sample 02
-	232,	// sample 03
-	217,	// sample 04
-	220,	// sample 05
-	229,	// sample 06
-	231,	// sample 07
-	212,	// sample 08
-	176,	// sample 09
-	137,	// sample 10
-	120,	// sample 11
-	123,	// sample 12
-	130,	// sample 13
-	128,	// sample 14
-	125,	// sample 15
-	125,	// sample 16
-	130,	// sample 17
-	133,	// sample 18
-	128,	// sample 19
-	125,	// sample 20
-	130,	// sample 21
-	129,	// sample 22
-	128,	// sample 23
-	129,	// sample 24
-	130,	// sample 25
-	131,	// sample 26
-	129,	// sample 27
-	128,	// sample 28
-	130,	// sample 29
-	130,	// sample 30
-	128,	// sample 31
-	126,	// sample 32
-	130,	// sample 33
-	129,	// sample 34
-	127,	// sample 35
-	129,	// sample 36
-	129,	// sample 37
-	131,	// sample 38
-	127,	// sample 39
-	129,	// sample 40
-	134,	// sample 41
-	131,	// sample 42
-	127,	// sample 43
-	125,	// sample 44
-	130,	// sample 45
-	129,	// sample 46
-	127,	// sample 47
-	128,	// sample 48
-	131,	// sample 49
-	133,	// sample 50
-	131,	// sample 51
-	128,	// sample 52
-	129,	// sample 53
-	132,	// sample 54
-	128,	// sample 55
-	130,	// sample 56
-	127,	// sample 57
-	126,	// sample 58
-	126,	// sample 59
-	126,	// sample 60
-	125,	// sample 61
-	132,	// sample 62
-	128,	// sample 63
-	132,	// -------- wave 104 (68h), sample 00
-	219,	// sample 01
-	250,	// sample 02
-	240,	// sample 03
-	233,	// sample 04
-	241,	// sample 05
-	239,	// sample 06
-	231,	// sample 07
-	228,	// sample 08
-	233,	// sample 09
-	239,	// sample 10
-	233,	// sample 11
-	227,	// sample 12
-	226,	// sample 13
-	225,	// sample 14
-	221,	// sample 15
-	217,	// sample 16
-	219,	// sample 17
-	214,	// sample 18
-	211,	// sample 19
-	205,	// sample 20
-	207,	// sample 21
-	206,	// sample 22
-	206,	// sample 23
-	205,	// sample 24
-	204,	// sample 25
-	200,	// sample 26
-	194,	// sample 27
-	191,	// sample 28
-	192,	// sample 29
-	197,	// sample 30
-	192,	// sample 31
-	189,	// sample 32
-	189,	// sample 33
-	186,	// sample 34
-	179,	// sample 35
-	181,	// sample 36
-	175,	// sample 37
-	177,	// sample 38
-	172,	// sample 39
-	168,	// sample 40
-	169,	// sample 41
-	170,	// sample 42
-	165,	// sample 43
-	166,	// sample 44
-	163,	// sample 45
-	164,	// sample 46
-	156,	// sample 47
-	156,	// sample 48
-	156,	// sample 49
-	153,	// sample 50
-	151,	// sample 51
-	151,	// sample 52
-	149,	// sample 53
-	143,	// sample 54
-	141,	// sample 55
-	139,	// sample 56
-	140,	// sample 57
-	141,	// sample 58
-	141,	// sample 59
-	137,	// sample 60
-	136,	// sample 61
-	133,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 105 (69h), sample 00
-	176,	// sample 01
-	206,	// sample 02
-	219,	// sample 03
-	216,	// sample 04
-	206,	// sample 05
-	199,	// sample 06
-	198,	// sample 07
-	208,	// sample 08
-	222,	// sample 09
-	230,	// sample 10
-	235,	// sample 11
-	230,	// sample 12
-	225,	// sample 13
-	218,	// sample 14
-	209,	// sample 15
-	208,	// sample 16
-	202,	// sample 17
-	200,	// sample 18
-	191,	// sample 19
-	185,	// sample 20
-	176,	// sample 21
-	166,	// sample 22
-	160,	// sample 23
-	156,	// sample 24
-	148,	// sample 25
-	143,	// sample 26
-	140,	// sample 27
-	135,	// sample 28
-	135,	// sample 29
-	134,	// sample 30
-	130,	// sample 31
-	126,	// sample 32
-	123,	// sample 33
-	119,	// sample 34
-	120,	// sample 35
-	122,	// sample 36
-	120,	// sample 37
-	121,	// sample 38
-	117,	// sample 39
-	117,	// sample 40
-	115,	// sample 41
-	118,	// sample 42
-	121,	// sample 43
-	125,	// sample 44
-	128,	// sample 45
-	129,	// sample 46
-	131,	// sample 47
-	132,	// sample 48
-	130,	// sample 49
-	133,	// sample 50
-	132,	// sample 51
-	138,	// sample 52
-	138,	// sample 53
-	140,	// sample 54
-	136,	// sample 55
-	136,	// sample 56
-	135,	// sample 57
-	136,	// sample 58
-	135,	// sample 59
-	133,	// sample 60
-	133,	// sample 61
-	128,	// sample 62
-	132,	// sample 63
-	130,	// -------- wave 106 (6ah), sample 00
-	141,	// sample 01
-	150,	// sample 02
-	154,	// sample 03
-	157,	// sample 04
-	155,	// sample 05
-	154,	// sample 06
-	154,	// sample 07
-	156,	// sample 08
-	162,	// sample 09
-	172,	// sample 10
-	181,	// sample 11
-	189,	// sample 12
-	195,	// sample 13
-	199,	// sample 14
-	199,	// sample 15
-	197,	// sample 16
-	194,	// sample 17
-	193,	// sample 18
-	196,	// sample 19
-	200,	// sample 20
-	209,	// sample 21
-	216,	// sample 22
-	223,	// sample 23
-	225,	// sample 24
-	225,	// sample 25
-	222,	// sample 26
-	219,	// sample 27
-	215,	// sample 28
-	213,	// sample 29
-	214,	// sample 30
-	218,	// sample 31
-	223,	// sample 32
-	228,	// sample 33
-	230,	// sample 34
-	230,	// sample 35
-	227,	// sample 36
-	221,	// sample 37
-	214,	// sample 38
-	208,	// sample 39
-	205,	// sample 40
-	204,	// sample 41
-	208,	// sample 42
-	209,	// sample 43
-	212,	// sample 44
-	211,	// sample 45
-	209,	// sample 46
-	202,	// sample 47
-	194,	// sample 48
-	184,	// sample 49
-	177,	// sample 50
-	173,	// sample 51
-	172,	// sample 52
-	173,	// sample 53
-	174,	// sample 54
-	173,	// sample 55
-	171,	// sample 56
-	165,	// sample 57
-	156,	// sample 58
-	148,	// sample 59
-	138,	// sample 60
-	132,	// sample 61
-	126,	// sample 62
-	125,	// sample 63
-	130,	// -------- wave 107 (6bh), sample 00
-	144,	// sample 01
-	154,	// sample 02
-	160,	// sample 03
-	162,	// sample 04
-	163,	// sample 05
-	164,	// sample 06
-	167,	// sample 07
-	172,	// sample 08
-	181,	// sample 09
-	192,	// sample 10
-	203,	// sample 11
-	209,	// sample 12
-	212,	// sample 13
-	210,	// sample 14
-	207,	// sample 15
-	203,	// sample 16
-	202,	// sample 17
-	204,	// sample 18
-	208,	// sample 19
-	213,	// sample 20
-	218,	// sample 21
-	219,	// sample 22
-	216,	// sample 23
-	209,	// sample 24
-	201,	// sample 25
-	192,	// sample 26
-	185,	// sample 27
-	183,	// sample 28
-	185,	// sample 29
-	187,	// sample 30
-	187,	// sample 31
-	184,	// sample 32
-	177,	// sample 33
-	167,	// sample 34
-	157,	// sample 35
-	148,	// sample 36
-	140,	// sample 37
-	139,	// sample 38
-	139,	// sample 39
-	141,	// sample 40
-	142,	// sample 41
-	140,	// sample 42
-	132,	// sample 43
-	124,	// sample 44
-	116,	// sample 45
-	109,	// sample 46
-	106,	// sample 47
-	107,	// sample 48
-	111,	// sample 49
-	116,	// sample 50
-	119,	// sample 51
-	119,	// sample 52
-	116,	// sample 53
-	111,	// sample 54
-	106,	// sample 55
-	102,	// sample 56
-	104,	// sample 57
-	109,	// sample 58
-	118,	// sample 59
-	126,	// sample 60
-	131,	// sample 61
-	132,	// sample 62
-	131,	// sample 63
-	130,	// -------- wave 108 (6ch), sample 00
-	147,	// sample 01
-	159,	// sample 02
-	165,	// sample 03
-	168,	// sample 04
-	172,	// sample 05
-	174,	// sample 06
-	180,	// sample 07
-	190,	// sample 08
-	201,	// sample 09
-	213,	// sample 10
-	221,	// sample 11
-	224,	// sample 12
-	223,	// sample 13
-	220,	// sample 14
-	216,	// sample 15
-	213,	// sample 16
-	215,	// sample 17
-	219,	// sample 18
-	223,	// sample 19
-	223,	// sample 20
-	220,	// sample 21
-	210,	// sample 22
-	199,	// sample 23
-	187,	// sample 24
-	176,	// sample 25
-	171,	// sample 26
-	168,	// sample 27
-	165,	// sample 28
-	161,	// sample 29
-	154,	// sample 30
-	141,	// sample 31
-	126,	// sample 32
-	110,	// sample 33
-	 97,	// sample 34
-	 91,	// sample 35
-	 88,	// sample 36
-	 84,	// sample 37
-	 82,	// sample 38
-	 76,	// sample 39
-	 66,	// sample 40
-	 55,	// sample 41
-	 43,	// sample 42
-	 35,	// sample 43
-	 32,	// sample 44
-	 34,	// sample 45
-	 36,	// sample 46
-	 41,	// sample 47
-	 43,	// sample 48
-	 41,	// sample 49
-	 37,	// sample 50
-	 34,	// sample 51
-	 34,	// sample 52
-	 36,	// sample 53
-	 46,	// sample 54
-	 57,	// sample 55
-	 69,	// sample 56
-	 80,	// sample 57
-	 85,	// sample 58
-	 89,	// sample 59
-	 91,	// sample 60
-	 95,	// sample 61
-	102,	// sample 62
-	115,	// sample 63
-	130,	// -------- wave 109 (6dh), sample 00
-	150,	// sample 01
-	163,	// sample 02
-	171,	// sample 03
-	176,	// sample 04
-	180,	// sample 05
-	184,	// sample 06
-	192,	// sample 07
-	204,	// sample 08
-	215,	// sample 09
-	223,	// sample 10
-	226,	// sample 11
-	223,	// sample 12
-	216,	// sample 13
-	209,	// sample 14
-	203,	// sample 15
-	202,	// sample 16
-	203,	// sample 17
-	201,	// sample 18
-	198,	// sample 19
-	188,	// sample 20
-	172,	// sample 21
-	156,	// sample 22
-	144,	// sample 23
-	134,	// sample 24
-	128,	// sample 25
-	125,	// sample 26
-	121,	// sample 27
-	114,	// sample 28
-	103,	// sample 29
-	 91,	// sample 30
-	 78,	// sample 31
-	 70,	// sample 32
-	 69,	// sample 33
-	 71,	// sample 34
-	 77,	// sample 35
-	 80,	// sample 36
-	 78,	// sample 37
-	 74,	// sample 38
-	 69,	// sample 39
-	 68,	// sample 40
-	 72,	// sample 41
-	 81,	// sample 42
-	 93,	// sample 43
-	102,	// sample 44
-	108,	// sample 45
-	111,	// sample 46
-	109,	// sample 47
-	108,	// sample 48
-	109,	// sample 49
-	117,	// sample 50
-	127,	// sample 51
-	137,	// sample 52
-	143,	// sample 53
-	145,	// sample 54
-	141,	// sample 55
-	134,	// sample 56
-	129,	// sample 57
-	130,	// sample 58
-	134,	// sample 59
-	139,	// sample 60
-	143,	// sample 61
-	142,	// sample 62
-	136,	// sample 63
-	130,	// -------- wave 110 (6eh), sample 00
-	152,	// sample 01
-	167,	// sample 02
-	177,	// sample 03
-	182,	// sample 04
-	187,	// sample 05
-	192,	// sample 06
-	204,	// sample 07
-	216,	// sample 08
-	227,	// sample 09
-	232,	// sample 10
-	229,	// sample 11
-	221,	// sample 12
-	209,	// sample 13
-	201,	// sample 14
-	195,	// sample 15
-	194,	// sample 16
-	189,	// sample 17
-	180,	// sample 18
-	164,	// sample 19
-	145,	// sample 20
-	123,	// sample 21
-	106,	// sample 22
-	 97,	// sample 23
-	 91,	// sample 24
-	 84,	// sample 25
-	 76,	// sample 26
-	 63,	// sample 27
-	 49,	// sample 28
-	 35,	// sample 29
-	 28,	// sample 30
-	 28,	// sample 31
-	 34,	// sample 32
-	 41,	// sample 33
-	 48,	// sample 34
-	 51,	// sample 35
-	 51,	// sample 36
-	 52,	// sample 37
-	 60,	// sample 38
-	 74,	// sample 39
-	 95,	// sample 40
-	113,	// sample 41
-	131,	// sample 42
-	142,	// sample 43
-	150,	// sample 44
-	155,	// sample 45
-	165,	// sample 46
-	179,	// sample 47
-	197,	// sample 48
-	212,	// sample 49
-	222,	// sample 50
-	224,	// sample 51
-	222,	// sample 52
-	216,	// sample 53
-	212,	// sample 54
-	212,	// sample 55
-	215,	// sample 56
-	214,	// sample 57
-	210,	// sample 58
-	197,	// sample 59
-	179,	// sample 60
-	159,	// sample 61
-	143,	// sample 62
-	134,	// sample 63
-	130,	// -------- wave 111 (6fh), sample 00
-	155,	// sample 01
-	171,	// sample 02
-	182,	// sample 03
-	188,	// sample 04
-	193,	// sample 05
-	201,	// sample 06
-	212,	// sample 07
-	223,	// sample 08
-	229,	// sample 09
-	226,	// sample 10
-	216,	// sample 11
-	202,	// sample 12
-	188,	// sample 13
-	179,	// sample 14
-	174,	// sample 15
-	167,	// sample 16
-	155,	// sample 17
-	136,	// sample 18
-	113,	// sample 19
-	 95,	// sample 20
-	 81,	// sample 21
-	 74,	// sample 22
-	 73,	// sample 23
-	 71,	// sample 24
-	 65,	// sample 25
-	 56,	// sample 26
-	 49,	// sample 27
-	 46,	// sample 28
-	 52,	// sample 29
-	 65,	// sample 30
-	 79,	// sample 31
-	 92,	// sample 32
-	 98,	// sample 33
-	100,	// sample 34
-	105,	// sample 35
-	115,	// sample 36
-	128,	// sample 37
-	146,	// sample 38
-	160,	// sample 39
-	167,	// sample 40
-	166,	// sample 41
-	162,	// sample 42
-	161,	// sample 43
-	164,	// sample 44
-	169,	// sample 45
-	174,	// sample 46
-	176,	// sample 47
-	168,	// sample 48
-	155,	// sample 49
-	145,	// sample 50
-	137,	// sample 51
-	135,	// sample 52
-	139,	// sample 53
-	140,	// sample 54
-	136,	// sample 55
-	127,	// sample 56
-	117,	// sample 57
-	112,	// sample 58
-	113,	// sample 59
-	118,	// sample 60
-	127,	// sample 61
-	134,	// sample 62
-	132,	// sample 63
-	130,	// -------- wave 112 (70h), sample 00
-	158,	// sample 01
-	174,	// sample 02
-	186,	// sample 03
-	193,	// sample 04
-	198,	// sample 05
-	208,	// sample 06
-	221,	// sample 07
-	229,	// sample 08
-	230,	// sample 09
-	220,	// sample 10
-	202,	// sample 11
-	185,	// sample 12
-	171,	// sample 13
-	160,	// sample 14
-	151,	// sample 15
-	136,	// sample 16
-	112,	// sample 17
-	 89,	// sample 18
-	 65,	// sample 19
-	 50,	// sample 20
-	 47,	// sample 21
-	 46,	// sample 22
-	 44,	// sample 23
-	 40,	// sample 24
-	 34,	// sample 25
-	 34,	// sample 26
-	 42,	// sample 27
-	 59,	// sample 28
-	 82,	// sample 29
-	103,	// sample 30
-	118,	// sample 31
-	130,	// sample 32
-	143,	// sample 33
-	157,	// sample 34
-	178,	// sample 35
-	201,	// sample 36
-	216,	// sample 37
-	223,	// sample 38
-	223,	// sample 39
-	216,	// sample 40
-	211,	// sample 41
-	210,	// sample 42
-	208,	// sample 43
-	203,	// sample 44
-	187,	// sample 45
-	163,	// sample 46
-	139,	// sample 47
-	116,	// sample 48
-	100,	// sample 49
-	 93,	// sample 50
-	 83,	// sample 51
-	 68,	// sample 52
-	 52,	// sample 53
-	 34,	// sample 54
-	 25,	// sample 55
-	 27,	// sample 56
-	 36,	// sample 57
-	 50,	// sample 58
-	 60,	// sample 59
-	 65,	// sample 60
-	 72,	// sample 61
-	 86,	// sample 62
-	104,	// sample 63
-	130,	// -------- wave 113 (71h), sample 00
-	135,	// sample 01
-	140,	// sample 02
-	145,	// sample 03
-	149,	// sample 04
-	152,	// sample 05
-	157,	// sample 06
-	160,	// sample 07
-	164,	// sample 08
-	168,	// sample 09
-	173,	// sample 10
-	177,	// sample 11
-	180,	// sample 12
-	184,	// sample 13
-	188,	// sample 14
-	192,	// sample 15
-	195,	// sample 16
-	198,	// sample 17
-	199,	// sample 18
-	202,	// sample 19
-	204,	// sample 20
-	207,	// sample 21
-	209,	// sample 22
-	211,	// sample 23
-	213,	// sample 24
-	215,	// sample 25
-	216,	// sample 26
-	217,	// sample 27
-	218,	// sample 28
-	219,	// sample 29
-	219,	// sample 30
-	219,	// sample 31
-	219,	// sample 32
-	219,	// sample 33
-	219,	// sample 34
-	218,	// sample 35
-	217,	// sample 36
-	216,	// sample 37
-	215,	// sample 38
-	213,	// sample 39
-	211,	// sample 40
-	209,	// sample 41
-	207,	// sample 42
-	204,	// sample 43
-	202,	// sample 44
-	199,	// sample 45
-	198,	// sample 46
-	195,	// sample 47
-	192,	// sample 48
-	188,	// sample 49
-	184,	// sample 50
-	180,	// sample 51
-	177,	// sample 52
-	173,	// sample 53
-	168,	// sample 54
-	164,	// sample 55
-	160,	// sample 56
-	157,	// sample 57
-	152,	// sample 58
-	149,	// sample 59
-	145,	// sample 60
-	140,	// sample 61
-	135,	// sample 62
-	130,	// sample 63
-	131,	// -------- wave 114 (72h), sample 00
-	139,	// sample 01
-	147,	// sample 02
-	154,	// sample 03
-	160,	// sample 04
-	165,	// sample 05
-	173,	// sample 06
-	179,	// sample 07
-	185,	// sample 08
-	191,	// sample 09
-	197,	// sample 10
-	203,	// sample 11
-	207,	// sample 12
-	212,	// sample 13
-	216,	// sample 14
-	221,	// sample 15
-	223,	// sample 16
-	226,	// sample 17
-	226,	// sample 18
-	228,	// sample 19
-	229,	// sample 20
-	231,	// sample 21
-	231,	// sample 22
-	232,	// sample 23
-	232,	// sample 24
-	232,	// sample 25
-	230,	// sample 26
-	229,	// sample 27
-	227,	// sample 28
-	226,	// sample 29
-	223,	// sample 30
-	221,	// sample 31
-	218,	// sample 32
-	215,	// sample 33
-	212,	// sample 34
-	209,	// sample 35
-	206,	// sample 36
-	202,	// sample 37
-	198,	// sample 38
-	194,	// sample 39
-	190,	// sample 40
-	187,	// sample 41
-	183,	// sample 42
-	178,	// sample 43
-	175,	// sample 44
-	171,	// sample 45
-	170,	// sample 46
-	166,	// sample 47
-	163,	// sample 48
-	160,	// sample 49
-	157,	// sample 50
-	154,	// sample 51
-	152,	// sample 52
-	149,	// sample 53
-	146,	// sample 54
-	143,	// sample 55
-	141,	// sample 56
-	139,	// sample 57
-	137,	// sample 58
-	136,	// sample 59
-	135,	// sample 60
-	133,	// sample 61
-	130,	// sample 62
-	128,	// sample 63
-	131,	// -------- wave 115 (73h), sample 00
-	140,	// sample 01
-	150,	// sample 02
-	158,	// sample 03
-	166,	// sample 04
-	173,	// sample 05
-	182,	// sample 06
-	189,	// sample 07
-	195,	// sample 08
-	203,	// sample 09
-	209,	// sample 10
-	214,	// sample 11
-	220,	// sample 12
-	223,	// sample 13
-	228,	// sample 14
-	232,	// sample 15
-	234,	// sample 16
-	237,	// sample 17
-	238,	// sample 18
-	239,	// sample 19
-	238,	// sample 20
-	239,	// sample 21
-	239,	// sample 22
-	239,	// sample 23
-	236,	// sample 24
-	234,	// sample 25
-	232,	// sample 26
-	229,	// sample 27
-	225,	// sample 28
-	223,	// sample 29
-	219,	// sample 30
-	214,	// sample 31
-	210,	// sample 32
-	205,	// sample 33
-	201,	// sample 34
-	196,	// sample 35
-	191,	// sample 36
-	187,	// sample 37
-	182,	// sample 38
-	177,	// sample 39
-	173,	// sample 40
-	170,	// sample 41
-	165,	// sample 42
-	160,	// sample 43
-	157,	// sample 44
-	155,	// sample 45
-	152,	// sample 46
-	148,	// sample 47
-	145,	// sample 48
-	143,	// sample 49
-	140,	// sample 50
-	138,	// sample 51
-	136,	// sample 52
-	135,	// sample 53
-	133,	// sample 54
-	131,	// sample 55
-	130,	// sample 56
-	130,	// sample 57
-	128,	// sample 58
-	129,	// sample 59
-	128,	// sample 60
-	129,	// sample 61
-	127,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 116 (74h), sample 00
-	152,	// sample 01
-	169,	// sample 02
-	184,	// sample 03
-	199,	// sample 04
-	211,	// sample 05
-	218,	// sample 06
-	223,	// sample 07
-	224,	// sample 08
-	225,	// sample 09
-	224,	// sample 10
-	221,	// sample 11
-	219,	// sample 12
-	212,	// sample 13
-	210,	// sample 14
-	204,	// sample 15
-	199,	// sample 16
-	194,	// sample 17
-	188,	// sample 18
-	183,	// sample 19
-	179,	// sample 20
-	172,	// sample 21
-	168,	// sample 22
-	163,	// sample 23
-	161,	// sample 24
-	159,	// sample 25
-	154,	// sample 26
-	153,	// sample 27
-	152,	// sample 28
-	151,	// sample 29
-	148,	// sample 30
-	144,	// sample 31
-	143,	// sample 32
-	140,	// sample 33
-	139,	// sample 34
-	139,	// sample 35
-	138,	// sample 36
-	135,	// sample 37
-	136,	// sample 38
-	134,	// sample 39
-	136,	// sample 40
-	137,	// sample 41
-	139,	// sample 42
-	137,	// sample 43
-	139,	// sample 44
-	138,	// sample 45
-	137,	// sample 46
-	138,	// sample 47
-	137,	// sample 48
-	134,	// sample 49
-	138,	// sample 50
-	137,	// sample 51
-	135,	// sample 52
-	136,	// sample 53
-	136,	// sample 54
-	134,	// sample 55
-	136,	// sample 56
-	134,	// sample 57
-	132,	// sample 58
-	133,	// sample 59
-	132,	// sample 60
-	131,	// sample 61
-	128,	// sample 62
-	130,	// sample 63
-	131,	// -------- wave 117 (75h), sample 00
-	156,	// sample 01
-	175,	// sample 02
-	195,	// sample 03
-	211,	// sample 04
-	221,	// sample 05
-	225,	// sample 06
-	229,	// sample 07
-	225,	// sample 08
-	223,	// sample 09
-	220,	// sample 10
-	214,	// sample 11
-	209,	// sample 12
-	204,	// sample 13
-	203,	// sample 14
-	198,	// sample 15
-	195,	// sample 16
-	194,	// sample 17
-	191,	// sample 18
-	186,	// sample 19
-	185,	// sample 20
-	178,	// sample 21
-	173,	// sample 22
-	169,	// sample 23
-	164,	// sample 24
-	160,	// sample 25
-	155,	// sample 26
-	152,	// sample 27
-	148,	// sample 28
-	149,	// sample 29
-	145,	// sample 30
-	141,	// sample 31
-	141,	// sample 32
-	141,	// sample 33
-	138,	// sample 34
-	139,	// sample 35
-	139,	// sample 36
-	135,	// sample 37
-	137,	// sample 38
-	135,	// sample 39
-	136,	// sample 40
-	138,	// sample 41
-	139,	// sample 42
-	138,	// sample 43
-	139,	// sample 44
-	138,	// sample 45
-	137,	// sample 46
-	138,	// sample 47
-	137,	// sample 48
-	136,	// sample 49
-	137,	// sample 50
-	138,	// sample 51
-	136,	// sample 52
-	136,	// sample 53
-	134,	// sample 54
-	134,	// sample 55
-	136,	// sample 56
-	133,	// sample 57
-	133,	// sample 58
-	134,	// sample 59
-	131,	// sample 60
-	132,	// sample 61
-	128,	// sample 62
-	129,	// sample 63
-	132,	// -------- wave 118 (76h), sample 00
-	189,	// sample 01
-	226,	// sample 02
-	241,	// sample 03
-	234,	// sample 04
-	222,	// sample 05
-	209,	// sample 06
-	207,	// sample 07
-	203,	// sample 08
-	198,	// sample 09
-	176,	// sample 10
-	143,	// sample 11
-	107,	// sample 12
-	 71,	// sample 13
-	 53,	// sample 14
-	 51,	// sample 15
-	 64,	// sample 16
-	 88,	// sample 17
-	104,	// sample 18
-	112,	// sample 19
-	112,	// sample 20
-	105,	// sample 21
-	106,	// sample 22
-	110,	// sample 23
-	123,	// sample 24
-	138,	// sample 25
-	145,	// sample 26
-	147,	// sample 27
-	135,	// sample 28
-	124,	// sample 29
-	113,	// sample 30
-	116,	// sample 31
-	123,	// sample 32
-	135,	// sample 33
-	148,	// sample 34
-	157,	// sample 35
-	157,	// sample 36
-	153,	// sample 37
-	147,	// sample 38
-	142,	// sample 39
-	142,	// sample 40
-	143,	// sample 41
-	142,	// sample 42
-	143,	// sample 43
-	136,	// sample 44
-	125,	// sample 45
-	114,	// sample 46
-	104,	// sample 47
-	101,	// sample 48
-	104,	// sample 49
-	109,	// sample 50
-	114,	// sample 51
-	121,	// sample 52
-	122,	// sample 53
-	123,	// sample 54
-	122,	// sample 55
-	126,	// sample 56
-	127,	// sample 57
-	127,	// sample 58
-	130,	// sample 59
-	132,	// sample 60
-	135,	// sample 61
-	137,	// sample 62
-	133,	// sample 63
-	132,	// -------- wave 119 (77h), sample 00
-	197,	// sample 01
-	240,	// sample 02
-	249,	// sample 03
-	234,	// sample 04
-	212,	// sample 05
-	202,	// sample 06
-	206,	// sample 07
-	222,	// sample 08
-	230,	// sample 09
-	221,	// sample 10
-	188,	// sample 11
-	142,	// sample 12
-	 96,	// sample 13
-	 65,	// sample 14
-	 54,	// sample 15
-	 62,	// sample 16
-	 82,	// sample 17
-	101,	// sample 18
-	109,	// sample 19
-	108,	// sample 20
-	 97,	// sample 21
-	 92,	// sample 22
-	 93,	// sample 23
-	106,	// sample 24
-	128,	// sample 25
-	149,	// sample 26
-	154,	// sample 27
-	143,	// sample 28
-	127,	// sample 29
-	113,	// sample 30
-	103,	// sample 31
-	107,	// sample 32
-	119,	// sample 33
-	132,	// sample 34
-	144,	// sample 35
-	150,	// sample 36
-	151,	// sample 37
-	148,	// sample 38
-	148,	// sample 39
-	150,	// sample 40
-	156,	// sample 41
-	163,	// sample 42
-	167,	// sample 43
-	165,	// sample 44
-	157,	// sample 45
-	143,	// sample 46
-	129,	// sample 47
-	116,	// sample 48
-	113,	// sample 49
-	110,	// sample 50
-	111,	// sample 51
-	111,	// sample 52
-	113,	// sample 53
-	112,	// sample 54
-	113,	// sample 55
-	114,	// sample 56
-	118,	// sample 57
-	122,	// sample 58
-	129,	// sample 59
-	131,	// sample 60
-	138,	// sample 61
-	138,	// sample 62
-	133,	// sample 63
-	128,	// -------- wave 120 (78h), sample 00
-	196,	// sample 01
-	229,	// sample 02
-	225,	// sample 03
-	198,	// sample 04
-	168,	// sample 05
-	152,	// sample 06
-	159,	// sample 07
-	173,	// sample 08
-	195,	// sample 09
-	208,	// sample 10
-	200,	// sample 11
-	174,	// sample 12
-	136,	// sample 13
-	103,	// sample 14
-	 85,	// sample 15
-	 77,	// sample 16
-	 88,	// sample 17
-	101,	// sample 18
-	113,	// sample 19
-	120,	// sample 20
-	118,	// sample 21
-	114,	// sample 22
-	111,	// sample 23
-	112,	// sample 24
-	123,	// sample 25
-	126,	// sample 26
-	135,	// sample 27
-	139,	// sample 28
-	144,	// sample 29
-	143,	// sample 30
-	140,	// sample 31
-	135,	// sample 32
-	133,	// sample 33
-	131,	// sample 34
-	127,	// sample 35
-	124,	// sample 36
-	121,	// sample 37
-	123,	// sample 38
-	128,	// sample 39
-	135,	// sample 40
-	143,	// sample 41
-	147,	// sample 42
-	149,	// sample 43
-	146,	// sample 44
-	143,	// sample 45
-	141,	// sample 46
-	142,	// sample 47
-	143,	// sample 48
-	143,	// sample 49
-	142,	// sample 50
-	146,	// sample 51
-	148,	// sample 52
-	139,	// sample 53
-	132,	// sample 54
-	123,	// sample 55
-	121,	// sample 56
-	122,	// sample 57
-	122,	// sample 58
-	125,	// sample 59
-	126,	// sample 60
-	131,	// sample 61
-	135,	// sample 62
-	133,	// sample 63
-	128,	// -------- wave 121 (79h), sample 00
-	195,	// sample 01
-	231,	// sample 02
-	230,	// sample 03
-	202,	// sample 04
-	162,	// sample 05
-	124,	// sample 06
-	110,	// sample 07
-	112,	// sample 08
-	134,	// sample 09
-	161,	// sample 10
-	184,	// sample 11
-	197,	// sample 12
-	193,	// sample 13
-	173,	// sample 14
-	143,	// sample 15
-	117,	// sample 16
-	100,	// sample 17
-	 95,	// sample 18
-	 96,	// sample 19
-	100,	// sample 20
-	109,	// sample 21
-	114,	// sample 22
-	114,	// sample 23
-	113,	// sample 24
-	114,	// sample 25
-	117,	// sample 26
-	118,	// sample 27
-	125,	// sample 28
-	128,	// sample 29
-	131,	// sample 30
-	132,	// sample 31
-	130,	// sample 32
-	128,	// sample 33
-	133,	// sample 34
-	137,	// sample 35
-	144,	// sample 36
-	145,	// sample 37
-	148,	// sample 38
-	143,	// sample 39
-	136,	// sample 40
-	126,	// sample 41
-	124,	// sample 42
-	127,	// sample 43
-	128,	// sample 44
-	129,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	130,	// sample 48
-	129,	// sample 49
-	134,	// sample 50
-	138,	// sample 51
-	141,	// sample 52
-	145,	// sample 53
-	146,	// sample 54
-	146,	// sample 55
-	146,	// sample 56
-	142,	// sample 57
-	139,	// sample 58
-	141,	// sample 59
-	145,	// sample 60
-	141,	// sample 61
-	135,	// sample 62
-	131,	// sample 63
-	128,	// -------- wave 122 (7ah), sample 00
-	194,	// sample 01
-	233,	// sample 02
-	237,	// sample 03
-	216,	// sample 04
-	181,	// sample 05
-	140,	// sample 06
-	113,	// sample 07
-	104,	// sample 08
-	111,	// sample 09
-	136,	// sample 10
-	162,	// sample 11
-	190,	// sample 12
-	202,	// sample 13
-	201,	// sample 14
-	188,	// sample 15
-	167,	// sample 16
-	144,	// sample 17
-	127,	// sample 18
-	119,	// sample 19
-	120,	// sample 20
-	125,	// sample 21
-	134,	// sample 22
-	139,	// sample 23
-	145,	// sample 24
-	143,	// sample 25
-	137,	// sample 26
-	126,	// sample 27
-	119,	// sample 28
-	110,	// sample 29
-	109,	// sample 30
-	109,	// sample 31
-	115,	// sample 32
-	116,	// sample 33
-	116,	// sample 34
-	116,	// sample 35
-	113,	// sample 36
-	114,	// sample 37
-	111,	// sample 38
-	112,	// sample 39
-	116,	// sample 40
-	123,	// sample 41
-	126,	// sample 42
-	127,	// sample 43
-	130,	// sample 44
-	129,	// sample 45
-	123,	// sample 46
-	122,	// sample 47
-	121,	// sample 48
-	118,	// sample 49
-	122,	// sample 50
-	132,	// sample 51
-	137,	// sample 52
-	135,	// sample 53
-	133,	// sample 54
-	131,	// sample 55
-	129,	// sample 56
-	126,	// sample 57
-	126,	// sample 58
-	125,	// sample 59
-	129,	// sample 60
-	132,	// sample 61
-	136,	// sample 62
-	133,	// sample 63
-	133,	// -------- wave 123 (7bh), sample 00
-	183,	// sample 01
-	219,	// sample 02
-	239,	// sample 03
-	238,	// sample 04
-	219,	// sample 05
-	188,	// sample 06
-	154,	// sample 07
-	125,	// sample 08
-	106,	// sample 09
-	105,	// sample 10
-	116,	// sample 11
-	138,	// sample 12
-	164,	// sample 13
-	189,	// sample 14
-	211,	// sample 15
-	220,	// sample 16
-	220,	// sample 17
-	207,	// sample 18
-	188,	// sample 19
-	161,	// sample 20
-	138,	// sample 21
-	119,	// sample 22
-	107,	// sample 23
-	106,	// sample 24
-	107,	// sample 25
-	110,	// sample 26
-	116,	// sample 27
-	118,	// sample 28
-	117,	// sample 29
-	113,	// sample 30
-	110,	// sample 31
-	104,	// sample 32
-	100,	// sample 33
-	 99,	// sample 34
-	 99,	// sample 35
-	100,	// sample 36
-	 98,	// sample 37
-	100,	// sample 38
-	100,	// sample 39
-	102,	// sample 40
-	101,	// sample 41
-	100,	// sample 42
-	103,	// sample 43
-	103,	// sample 44
-	106,	// sample 45
-	113,	// sample 46
-	119,	// sample 47
-	127,	// sample 48
-	134,	// sample 49
-	141,	// sample 50
-	142,	// sample 51
-	143,	// sample 52
-	143,	// sample 53
-	140,	// sample 54
-	137,	// sample 55
-	136,	// sample 56
-	134,	// sample 57
-	131,	// sample 58
-	128,	// sample 59
-	128,	// sample 60
-	128,	// sample 61
-	129,	// sample 62
-	129,	// sample 63
-	131,	// -------- wave 124 (7ch), sample 00
-	160,	// sample 01
-	186,	// sample 02
-	207,	// sample 03
-	218,	// sample 04
-	223,	// sample 05
-	221,	// sample 06
-	207,	// sample 07
-	187,	// sample 08
-	165,	// sample 09
-	142,	// sample 10
-	121,	// sample 11
-	105,	// sample 12
-	 95,	// sample 13
-	 92,	// sample 14
-	 97,	// sample 15
-	104,	// sample 16
-	121,	// sample 17
-	138,	// sample 18
-	156,	// sample 19
-	174,	// sample 20
-	189,	// sample 21
-	200,	// sample 22
-	202,	// sample 23
-	200,	// sample 24
-	191,	// sample 25
-	179,	// sample 26
-	165,	// sample 27
-	147,	// sample 28
-	129,	// sample 29
-	114,	// sample 30
-	101,	// sample 31
-	 93,	// sample 32
-	 87,	// sample 33
-	 85,	// sample 34
-	 86,	// sample 35
-	 91,	// sample 36
-	 96,	// sample 37
-	102,	// sample 38
-	106,	// sample 39
-	113,	// sample 40
-	118,	// sample 41
-	121,	// sample 42
-	122,	// sample 43
-	121,	// sample 44
-	118,	// sample 45
-	115,	// sample 46
-	112,	// sample 47
-	107,	// sample 48
-	103,	// sample 49
-	101,	// sample 50
-	 98,	// sample 51
-	 97,	// sample 52
-	 97,	// sample 53
-	 97,	// sample 54
-	 98,	// sample 55
-	101,	// sample 56
-	106,	// sample 57
-	109,	// sample 58
-	112,	// sample 59
-	116,	// sample 60
-	119,	// sample 61
-	123,	// sample 62
-	126,	// sample 63
-	132,	// -------- wave 125 (7dh), sample 00
-	156,	// sample 01
-	179,	// sample 02
-	199,	// sample 03
-	214,	// sample 04
-	225,	// sample 05
-	229,	// sample 06
-	227,	// sample 07
-	222,	// sample 08
-	209,	// sample 09
-	196,	// sample 10
-	177,	// sample 11
-	160,	// sample 12
-	144,	// sample 13
-	129,	// sample 14
-	117,	// sample 15
-	110,	// sample 16
-	108,	// sample 17
-	109,	// sample 18
-	116,	// sample 19
-	127,	// sample 20
-	139,	// sample 21
-	155,	// sample 22
-	170,	// sample 23
-	186,	// sample 24
-	197,	// sample 25
-	209,	// sample 26
-	215,	// sample 27
-	219,	// sample 28
-	218,	// sample 29
-	213,	// sample 30
-	204,	// sample 31
-	190,	// sample 32
-	177,	// sample 33
-	162,	// sample 34
-	148,	// sample 35
-	133,	// sample 36
-	120,	// sample 37
-	109,	// sample 38
-	101,	// sample 39
-	 97,	// sample 40
-	 97,	// sample 41
-	 97,	// sample 42
-	102,	// sample 43
-	105,	// sample 44
-	112,	// sample 45
-	119,	// sample 46
-	124,	// sample 47
-	130,	// sample 48
-	134,	// sample 49
-	137,	// sample 50
-	138,	// sample 51
-	138,	// sample 52
-	136,	// sample 53
-	134,	// sample 54
-	130,	// sample 55
-	127,	// sample 56
-	125,	// sample 57
-	124,	// sample 58
-	123,	// sample 59
-	122,	// sample 60
-	123,	// sample 61
-	122,	// sample 62
-	128,	// sample 63
-	131,	// -------- wave 126 (7eh), sample 00
-	148,	// sample 01
-	161,	// sample 02
-	177,	// sample 03
-	187,	// sample 04
-	196,	// sample 05
-	202,	// sample 06
-	204,	// sample 07
-	204,	// sample 08
-	199,	// sample 09
-	192,	// sample 10
-	184,	// sample 11
-	173,	// sample 12
-	161,	// sample 13
-	149,	// sample 14
-	138,	// sample 15
-	127,	// sample 16
-	117,	// sample 17
-	111,	// sample 18
-	105,	// sample 19
-	103,	// sample 20
-	105,	// sample 21
-	107,	// sample 22
-	114,	// sample 23
-	122,	// sample 24
-	133,	// sample 25
-	144,	// sample 26
-	155,	// sample 27
-	165,	// sample 28
-	175,	// sample 29
-	186,	// sample 30
-	194,	// sample 31
-	200,	// sample 32
-	203,	// sample 33
-	203,	// sample 34
-	204,	// sample 35
-	201,	// sample 36
-	195,	// sample 37
-	190,	// sample 38
-	181,	// sample 39
-	174,	// sample 40
-	165,	// sample 41
-	159,	// sample 42
-	151,	// sample 43
-	145,	// sample 44
-	138,	// sample 45
-	135,	// sample 46
-	133,	// sample 47
-	131,	// sample 48
-	130,	// sample 49
-	133,	// sample 50
-	132,	// sample 51
-	136,	// sample 52
-	137,	// sample 53
-	140,	// sample 54
-	142,	// sample 55
-	143,	// sample 56
-	143,	// sample 57
-	144,	// sample 58
-	143,	// sample 59
-	141,	// sample 60
-	140,	// sample 61
-	135,	// sample 62
-	132,	// sample 63
-	131,	// -------- wave 127 (7fh), sample 00
-	141,	// sample 01
-	151,	// sample 02
-	160,	// sample 03
-	168,	// sample 04
-	175,	// sample 05
-	181,	// sample 06
-	187,	// sample 07
-	190,	// sample 08
-	193,	// sample 09
-	194,	// sample 10
-	193,	// sample 11
-	191,	// sample 12
-	187,	// sample 13
-	184,	// sample 14
-	179,	// sample 15
-	173,	// sample 16
-	166,	// sample 17
-	160,	// sample 18
-	155,	// sample 19
-	149,	// sample 20
-	145,	// sample 21
-	139,	// sample 22
-	136,	// sample 23
-	133,	// sample 24
-	132,	// sample 25
-	131,	// sample 26
-	132,	// sample 27
-	134,	// sample 28
-	136,	// sample 29
-	139,	// sample 30
-	143,	// sample 31
-	148,	// sample 32
-	153,	// sample 33
-	158,	// sample 34
-	163,	// sample 35
-	167,	// sample 36
-	172,	// sample 37
-	176,	// sample 38
-	180,	// sample 39
-	183,	// sample 40
-	183,	// sample 41
-	185,	// sample 42
-	184,	// sample 43
-	183,	// sample 44
-	181,	// sample 45
-	179,	// sample 46
-	176,	// sample 47
-	173,	// sample 48
-	168,	// sample 49
-	163,	// sample 50
-	160,	// sample 51
-	156,	// sample 52
-	151,	// sample 53
-	147,	// sample 54
-	142,	// sample 55
-	139,	// sample 56
-	136,	// sample 57
-	134,	// sample 58
-	133,	// sample 59
-	131,	// sample 60
-	130,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	130,	// -------- wave 128 (80h), sample 00
-	138,	// sample 01
-	146,	// sample 02
-	154,	// sample 03
-	160,	// sample 04
-	168,	// sample 05
-	173,	// sample 06
-	179,	// sample 07
-	183,	// sample 08
-	187,	// sample 09
-	189,	// sample 10
-	192,	// sample 11
-	192,	// sample 12
-	191,	// sample 13
-	192,	// sample 14
-	190,	// sample 15
-	187,	// sample 16
-	183,	// sample 17
-	179,	// sample 18
-	173,	// sample 19
-	168,	// sample 20
-	163,	// sample 21
-	158,	// sample 22
-	154,	// sample 23
-	147,	// sample 24
-	142,	// sample 25
-	136,	// sample 26
-	132,	// sample 27
-	129,	// sample 28
-	125,	// sample 29
-	123,	// sample 30
-	122,	// sample 31
-	121,	// sample 32
-	120,	// sample 33
-	120,	// sample 34
-	122,	// sample 35
-	124,	// sample 36
-	125,	// sample 37
-	130,	// sample 38
-	133,	// sample 39
-	138,	// sample 40
-	142,	// sample 41
-	147,	// sample 42
-	151,	// sample 43
-	157,	// sample 44
-	160,	// sample 45
-	164,	// sample 46
-	168,	// sample 47
-	172,	// sample 48
-	174,	// sample 49
-	176,	// sample 50
-	177,	// sample 51
-	178,	// sample 52
-	176,	// sample 53
-	176,	// sample 54
-	173,	// sample 55
-	171,	// sample 56
-	166,	// sample 57
-	163,	// sample 58
-	159,	// sample 59
-	153,	// sample 60
-	146,	// sample 61
-	140,	// sample 62
-	133,	// sample 63
-	129,	// -------- wave 129 (81h), sample 00
-	133,	// sample 01
-	137,	// sample 02
-	140,	// sample 03
-	143,	// sample 04
-	147,	// sample 05
-	150,	// sample 06
-	153,	// sample 07
-	156,	// sample 08
-	158,	// sample 09
-	160,	// sample 10
-	161,	// sample 11
-	163,	// sample 12
-	164,	// sample 13
-	165,	// sample 14
-	165,	// sample 15
-	165,	// sample 16
-	165,	// sample 17
-	165,	// sample 18
-	164,	// sample 19
-	162,	// sample 20
-	160,	// sample 21
-	159,	// sample 22
-	157,	// sample 23
-	155,	// sample 24
-	152,	// sample 25
-	149,	// sample 26
-	145,	// sample 27
-	142,	// sample 28
-	138,	// sample 29
-	135,	// sample 30
-	131,	// sample 31
-	127,	// sample 32
-	123,	// sample 33
-	119,	// sample 34
-	116,	// sample 35
-	113,	// sample 36
-	109,	// sample 37
-	106,	// sample 38
-	103,	// sample 39
-	100,	// sample 40
-	 98,	// sample 41
-	 97,	// sample 42
-	 95,	// sample 43
-	 93,	// sample 44
-	 92,	// sample 45
-	 91,	// sample 46
-	 91,	// sample 47
-	 91,	// sample 48
-	 91,	// sample 49
-	 92,	// sample 50
-	 92,	// sample 51
-	 94,	// sample 52
-	 96,	// sample 53
-	 97,	// sample 54
-	 99,	// sample 55
-	101,	// sample 56
-	104,	// sample 57
-	107,	// sample 58
-	111,	// sample 59
-	114,	// sample 60
-	118,	// sample 61
-	121,	// sample 62
-	125,	// sample 63
-	130,	// -------- wave 130 (82h), sample 00
-	200,	// sample 01
-	227,	// sample 02
-	223,	// sample 03
-	211,	// sample 04
-	214,	// sample 05
-	219,	// sample 06
-	222,	// sample 07
-	220,	// sample 08
-	223,	// sample 09
-	231,	// sample 10
-	236,	// sample 11
-	231,	// sample 12
-	219,	// sample 13
-	210,	// sample 14
-	204,	// sample 15
-	197,	// sample 16
-	190,	// sample 17
-	184,	// sample 18
-	183,	// sample 19
-	184,	// sample 20
-	175,	// sample 21
-	166,	// sample 22
-	160,	// sample 23
-	159,	// sample 24
-	153,	// sample 25
-	149,	// sample 26
-	148,	// sample 27
-	142,	// sample 28
-	144,	// sample 29
-	139,	// sample 30
-	131,	// sample 31
-	125,	// sample 32
-	126,	// sample 33
-	121,	// sample 34
-	117,	// sample 35
-	118,	// sample 36
-	116,	// sample 37
-	118,	// sample 38
-	115,	// sample 39
-	113,	// sample 40
-	114,	// sample 41
-	120,	// sample 42
-	121,	// sample 43
-	125,	// sample 44
-	125,	// sample 45
-	128,	// sample 46
-	134,	// sample 47
-	133,	// sample 48
-	132,	// sample 49
-	132,	// sample 50
-	133,	// sample 51
-	139,	// sample 52
-	137,	// sample 53
-	139,	// sample 54
-	138,	// sample 55
-	138,	// sample 56
-	133,	// sample 57
-	136,	// sample 58
-	136,	// sample 59
-	132,	// sample 60
-	137,	// sample 61
-	129,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 131 (83h), sample 00
-	154,	// sample 01
-	172,	// sample 02
-	191,	// sample 03
-	207,	// sample 04
-	222,	// sample 05
-	232,	// sample 06
-	241,	// sample 07
-	246,	// sample 08
-	247,	// sample 09
-	245,	// sample 10
-	240,	// sample 11
-	234,	// sample 12
-	225,	// sample 13
-	215,	// sample 14
-	204,	// sample 15
-	190,	// sample 16
-	176,	// sample 17
-	167,	// sample 18
-	156,	// sample 19
-	145,	// sample 20
-	137,	// sample 21
-	131,	// sample 22
-	127,	// sample 23
-	124,	// sample 24
-	124,	// sample 25
-	123,	// sample 26
-	124,	// sample 27
-	126,	// sample 28
-	130,	// sample 29
-	133,	// sample 30
-	135,	// sample 31
-	138,	// sample 32
-	139,	// sample 33
-	139,	// sample 34
-	138,	// sample 35
-	136,	// sample 36
-	132,	// sample 37
-	129,	// sample 38
-	124,	// sample 39
-	118,	// sample 40
-	114,	// sample 41
-	107,	// sample 42
-	100,	// sample 43
-	 96,	// sample 44
-	 91,	// sample 45
-	 85,	// sample 46
-	 81,	// sample 47
-	 78,	// sample 48
-	 75,	// sample 49
-	 76,	// sample 50
-	 76,	// sample 51
-	 77,	// sample 52
-	 80,	// sample 53
-	 82,	// sample 54
-	 85,	// sample 55
-	 90,	// sample 56
-	 94,	// sample 57
-	 99,	// sample 58
-	104,	// sample 59
-	108,	// sample 60
-	114,	// sample 61
-	119,	// sample 62
-	124,	// sample 63
-	129,	// -------- wave 132 (84h), sample 00
-	187,	// sample 01
-	227,	// sample 02
-	240,	// sample 03
-	230,	// sample 04
-	210,	// sample 05
-	185,	// sample 06
-	173,	// sample 07
-	167,	// sample 08
-	173,	// sample 09
-	181,	// sample 10
-	179,	// sample 11
-	167,	// sample 12
-	150,	// sample 13
-	126,	// sample 14
-	111,	// sample 15
-	103,	// sample 16
-	108,	// sample 17
-	119,	// sample 18
-	127,	// sample 19
-	134,	// sample 20
-	138,	// sample 21
-	140,	// sample 22
-	147,	// sample 23
-	156,	// sample 24
-	166,	// sample 25
-	177,	// sample 26
-	176,	// sample 27
-	170,	// sample 28
-	160,	// sample 29
-	144,	// sample 30
-	130,	// sample 31
-	117,	// sample 32
-	110,	// sample 33
-	107,	// sample 34
-	102,	// sample 35
-	 97,	// sample 36
-	 94,	// sample 37
-	 93,	// sample 38
-	 96,	// sample 39
-	103,	// sample 40
-	116,	// sample 41
-	126,	// sample 42
-	133,	// sample 43
-	137,	// sample 44
-	137,	// sample 45
-	138,	// sample 46
-	138,	// sample 47
-	138,	// sample 48
-	138,	// sample 49
-	137,	// sample 50
-	129,	// sample 51
-	120,	// sample 52
-	104,	// sample 53
-	 93,	// sample 54
-	 85,	// sample 55
-	 82,	// sample 56
-	 85,	// sample 57
-	 91,	// sample 58
-	 97,	// sample 59
-	105,	// sample 60
-	113,	// sample 61
-	117,	// sample 62
-	123,	// sample 63
-	128,	// -------- wave 133 (85h), sample 00
-	199,	// sample 01
-	167,	// sample 02
-	208,	// sample 03
-	128,	// sample 04
-	184,	// sample 05
-	146,	// sample 06
-	152,	// sample 07
-	128,	// sample 08
-	162,	// sample 09
-	100,	// sample 10
-	181,	// sample 11
-	128,	// sample 12
-	116,	// sample 13
-	134,	// sample 14
-	 98,	// sample 15
-	128,	// sample 16
-	130,	// sample 17
-	140,	// sample 18
-	126,	// sample 19
-	128,	// sample 20
-	188,	// sample 21
-	131,	// sample 22
-	165,	// sample 23
-	128,	// sample 24
-	132,	// sample 25
-	134,	// sample 26
-	182,	// sample 27
-	128,	// sample 28
-	169,	// sample 29
-	150,	// sample 30
-	164,	// sample 31
-	128,	// sample 32
-	 94,	// sample 33
-	150,	// sample 34
-	 57,	// sample 35
-	128,	// sample 36
-	124,	// sample 37
-	134,	// sample 38
-	 82,	// sample 39
-	128,	// sample 40
-	 66,	// sample 41
-	131,	// sample 42
-	 87,	// sample 43
-	128,	// sample 44
-	151,	// sample 45
-	140,	// sample 46
-	146,	// sample 47
-	128,	// sample 48
-	115,	// sample 49
-	134,	// sample 50
-	147,	// sample 51
-	128,	// sample 52
-	 82,	// sample 53
-	100,	// sample 54
-	 68,	// sample 55
-	128,	// sample 56
-	102,	// sample 57
-	146,	// sample 58
-	131,	// sample 59
-	128,	// sample 60
-	 94,	// sample 61
-	167,	// sample 62
-	128,	// sample 63
-	129,	// -------- wave 134 (86h), sample 00
-	 73,	// sample 01
-	 84,	// sample 02
-	236,	// sample 03
-	164,	// sample 04
-	168,	// sample 05
-	163,	// sample 06
-	122,	// sample 07
-	101,	// sample 08
-	128,	// sample 09
-	146,	// sample 10
-	130,	// sample 11
-	123,	// sample 12
-	149,	// sample 13
-	160,	// sample 14
-	127,	// sample 15
-	 86,	// sample 16
-	 97,	// sample 17
-	126,	// sample 18
-	145,	// sample 19
-	152,	// sample 20
-	168,	// sample 21
-	189,	// sample 22
-	177,	// sample 23
-	147,	// sample 24
-	145,	// sample 25
-	162,	// sample 26
-	156,	// sample 27
-	 97,	// sample 28
-	 46,	// sample 29
-	 53,	// sample 30
-	119,	// sample 31
-	177,	// sample 32
-	180,	// sample 33
-	146,	// sample 34
-	141,	// sample 35
-	182,	// sample 36
-	198,	// sample 37
-	161,	// sample 38
-	106,	// sample 39
-	 97,	// sample 40
-	128,	// sample 41
-	154,	// sample 42
-	155,	// sample 43
-	160,	// sample 44
-	170,	// sample 45
-	151,	// sample 46
-	100,	// sample 47
-	 83,	// sample 48
-	113,	// sample 49
-	149,	// sample 50
-	151,	// sample 51
-	142,	// sample 52
-	145,	// sample 53
-	160,	// sample 54
-	159,	// sample 55
-	154,	// sample 56
-	166,	// sample 57
-	158,	// sample 58
-	103,	// sample 59
-	 44,	// sample 60
-	 62,	// sample 61
-	144,	// sample 62
-	176,	// sample 63
-	137,	// -------- wave 135 (87h), sample 00
-	 41,	// sample 01
-	 66,	// sample 02
-	 97,	// sample 03
-	191,	// sample 04
-	194,	// sample 05
-	188,	// sample 06
-	116,	// sample 07
-	 81,	// sample 08
-	125,	// sample 09
-	157,	// sample 10
-	130,	// sample 11
-	119,	// sample 12
-	162,	// sample 13
-	180,	// sample 14
-	126,	// sample 15
-	 64,	// sample 16
-	 72,	// sample 17
-	125,	// sample 18
-	152,	// sample 19
-	163,	// sample 20
-	195,	// sample 21
-	223,	// sample 22
-	200,	// sample 23
-	160,	// sample 24
-	152,	// sample 25
-	180,	// sample 26
-	166,	// sample 27
-	 80,	// sample 28
-	196,	// sample 29
-	206,	// sample 30
-	116,	// sample 31
-	209,	// sample 32
-	208,	// sample 33
-	155,	// sample 34
-	151,	// sample 35
-	208,	// sample 36
-	 41,	// sample 37
-	183,	// sample 38
-	 95,	// sample 39
-	 78,	// sample 40
-	128,	// sample 41
-	166,	// sample 42
-	176,	// sample 43
-	183,	// sample 44
-	196,	// sample 45
-	165,	// sample 46
-	 94,	// sample 47
-	 57,	// sample 48
-	102,	// sample 49
-	159,	// sample 50
-	164,	// sample 51
-	142,	// sample 52
-	152,	// sample 53
-	180,	// sample 54
-	178,	// sample 55
-	176,	// sample 56
-	190,	// sample 57
-	177,	// sample 58
-	 86,	// sample 59
-	192,	// sample 60
-	223,	// sample 61
-	154,	// sample 62
-	209,	// sample 63
-	131,	// -------- wave 136 (88h), sample 00
-	142,	// sample 01
-	152,	// sample 02
-	160,	// sample 03
-	170,	// sample 04
-	176,	// sample 05
-	185,	// sample 06
-	193,	// sample 07
-	197,	// sample 08
-	204,	// sample 09
-	208,	// sample 10
-	212,	// sample 11
-	215,	// sample 12
-	219,	// sample 13
-	220,	// sample 14
-	223,	// sample 15
-	224,	// sample 16
-	225,	// sample 17
-	223,	// sample 18
-	225,	// sample 19
-	224,	// sample 20
-	224,	// sample 21
-	223,	// sample 22
-	225,	// sample 23
-	223,	// sample 24
-	223,	// sample 25
-	219,	// sample 26
-	218,	// sample 27
-	216,	// sample 28
-	212,	// sample 29
-	210,	// sample 30
-	207,	// sample 31
-	203,	// sample 32
-	200,	// sample 33
-	197,	// sample 34
-	194,	// sample 35
-	190,	// sample 36
-	188,	// sample 37
-	185,	// sample 38
-	182,	// sample 39
-	181,	// sample 40
-	179,	// sample 41
-	179,	// sample 42
-	176,	// sample 43
-	176,	// sample 44
-	174,	// sample 45
-	176,	// sample 46
-	173,	// sample 47
-	173,	// sample 48
-	170,	// sample 49
-	170,	// sample 50
-	166,	// sample 51
-	164,	// sample 52
-	162,	// sample 53
-	160,	// sample 54
-	157,	// sample 55
-	154,	// sample 56
-	149,	// sample 57
-	147,	// sample 58
-	145,	// sample 59
-	141,	// sample 60
-	138,	// sample 61
-	133,	// sample 62
-	130,	// sample 63
-	131,	// -------- wave 137 (89h), sample 00
-	148,	// sample 01
-	163,	// sample 02
-	178,	// sample 03
-	188,	// sample 04
-	199,	// sample 05
-	206,	// sample 06
-	213,	// sample 07
-	216,	// sample 08
-	217,	// sample 09
-	218,	// sample 10
-	218,	// sample 11
-	219,	// sample 12
-	219,	// sample 13
-	221,	// sample 14
-	220,	// sample 15
-	221,	// sample 16
-	225,	// sample 17
-	224,	// sample 18
-	227,	// sample 19
-	226,	// sample 20
-	228,	// sample 21
-	226,	// sample 22
-	226,	// sample 23
-	223,	// sample 24
-	220,	// sample 25
-	216,	// sample 26
-	208,	// sample 27
-	204,	// sample 28
-	197,	// sample 29
-	193,	// sample 30
-	188,	// sample 31
-	182,	// sample 32
-	178,	// sample 33
-	174,	// sample 34
-	173,	// sample 35
-	170,	// sample 36
-	168,	// sample 37
-	166,	// sample 38
-	164,	// sample 39
-	163,	// sample 40
-	163,	// sample 41
-	163,	// sample 42
-	161,	// sample 43
-	159,	// sample 44
-	158,	// sample 45
-	159,	// sample 46
-	157,	// sample 47
-	157,	// sample 48
-	156,	// sample 49
-	154,	// sample 50
-	152,	// sample 51
-	152,	// sample 52
-	151,	// sample 53
-	150,	// sample 54
-	147,	// sample 55
-	147,	// sample 56
-	144,	// sample 57
-	142,	// sample 58
-	142,	// sample 59
-	139,	// sample 60
-	137,	// sample 61
-	133,	// sample 62
-	131,	// sample 63
-	131,	// -------- wave 138 (8ah), sample 00
-	175,	// sample 01
-	209,	// sample 02
-	220,	// sample 03
-	215,	// sample 04
-	207,	// sample 05
-	196,	// sample 06
-	191,	// sample 07
-	195,	// sample 08
-	202,	// sample 09
-	207,	// sample 10
-	211,	// sample 11
-	210,	// sample 12
-	208,	// sample 13
-	207,	// sample 14
-	207,	// sample 15
-	211,	// sample 16
-	217,	// sample 17
-	220,	// sample 18
-	223,	// sample 19
-	218,	// sample 20
-	209,	// sample 21
-	196,	// sample 22
-	192,	// sample 23
-	182,	// sample 24
-	180,	// sample 25
-	173,	// sample 26
-	165,	// sample 27
-	154,	// sample 28
-	139,	// sample 29
-	127,	// sample 30
-	120,	// sample 31
-	119,	// sample 32
-	122,	// sample 33
-	125,	// sample 34
-	125,	// sample 35
-	125,	// sample 36
-	118,	// sample 37
-	116,	// sample 38
-	111,	// sample 39
-	104,	// sample 40
-	101,	// sample 41
-	 97,	// sample 42
-	 96,	// sample 43
-	 97,	// sample 44
-	 99,	// sample 45
-	100,	// sample 46
-	100,	// sample 47
-	 98,	// sample 48
-	102,	// sample 49
-	107,	// sample 50
-	115,	// sample 51
-	122,	// sample 52
-	130,	// sample 53
-	132,	// sample 54
-	129,	// sample 55
-	126,	// sample 56
-	121,	// sample 57
-	118,	// sample 58
-	117,	// sample 59
-	117,	// sample 60
-	117,	// sample 61
-	118,	// sample 62
-	122,	// sample 63
-	129,	// -------- wave 139 (8bh), sample 00
-	178,	// sample 01
-	215,	// sample 02
-	227,	// sample 03
-	221,	// sample 04
-	209,	// sample 05
-	190,	// sample 06
-	177,	// sample 07
-	177,	// sample 08
-	183,	// sample 09
-	185,	// sample 10
-	184,	// sample 11
-	179,	// sample 12
-	168,	// sample 13
-	160,	// sample 14
-	157,	// sample 15
-	157,	// sample 16
-	158,	// sample 17
-	160,	// sample 18
-	161,	// sample 19
-	157,	// sample 20
-	151,	// sample 21
-	147,	// sample 22
-	147,	// sample 23
-	149,	// sample 24
-	155,	// sample 25
-	160,	// sample 26
-	162,	// sample 27
-	161,	// sample 28
-	158,	// sample 29
-	148,	// sample 30
-	136,	// sample 31
-	125,	// sample 32
-	119,	// sample 33
-	117,	// sample 34
-	120,	// sample 35
-	126,	// sample 36
-	130,	// sample 37
-	131,	// sample 38
-	128,	// sample 39
-	124,	// sample 40
-	117,	// sample 41
-	109,	// sample 42
-	107,	// sample 43
-	106,	// sample 44
-	109,	// sample 45
-	112,	// sample 46
-	117,	// sample 47
-	119,	// sample 48
-	120,	// sample 49
-	119,	// sample 50
-	118,	// sample 51
-	114,	// sample 52
-	116,	// sample 53
-	120,	// sample 54
-	128,	// sample 55
-	135,	// sample 56
-	137,	// sample 57
-	138,	// sample 58
-	128,	// sample 59
-	122,	// sample 60
-	115,	// sample 61
-	117,	// sample 62
-	119,	// sample 63
-	130,	// -------- wave 140 (8ch), sample 00
-	222,	// sample 01
-	246,	// sample 02
-	219,	// sample 03
-	211,	// sample 04
-	223,	// sample 05
-	220,	// sample 06
-	194,	// sample 07
-	178,	// sample 08
-	182,	// sample 09
-	182,	// sample 10
-	161,	// sample 11
-	150,	// sample 12
-	145,	// sample 13
-	125,	// sample 14
-	 91,	// sample 15
-	 66,	// sample 16
-	 79,	// sample 17
-	108,	// sample 18
-	125,	// sample 19
-	134,	// sample 20
-	136,	// sample 21
-	147,	// sample 22
-	164,	// sample 23
-	180,	// sample 24
-	186,	// sample 25
-	173,	// sample 26
-	167,	// sample 27
-	170,	// sample 28
-	165,	// sample 29
-	147,	// sample 30
-	122,	// sample 31
-	110,	// sample 32
-	111,	// sample 33
-	 93,	// sample 34
-	 78,	// sample 35
-	 71,	// sample 36
-	 84,	// sample 37
-	 89,	// sample 38
-	 86,	// sample 39
-	 88,	// sample 40
-	113,	// sample 41
-	132,	// sample 42
-	145,	// sample 43
-	145,	// sample 44
-	142,	// sample 45
-	139,	// sample 46
-	142,	// sample 47
-	146,	// sample 48
-	143,	// sample 49
-	144,	// sample 50
-	139,	// sample 51
-	129,	// sample 52
-	108,	// sample 53
-	 87,	// sample 54
-	 81,	// sample 55
-	 86,	// sample 56
-	 79,	// sample 57
-	 70,	// sample 58
-	 83,	// sample 59
-	107,	// sample 60
-	118,	// sample 61
-	113,	// sample 62
-	112,	// sample 63
-	128,	// -------- wave 141 (8dh), sample 00
-	203,	// sample 01
-	194,	// sample 02
-	198,	// sample 03
-	183,	// sample 04
-	153,	// sample 05
-	143,	// sample 06
-	156,	// sample 07
-	162,	// sample 08
-	167,	// sample 09
-	156,	// sample 10
-	142,	// sample 11
-	125,	// sample 12
-	125,	// sample 13
-	129,	// sample 14
-	122,	// sample 15
-	116,	// sample 16
-	116,	// sample 17
-	103,	// sample 18
-	104,	// sample 19
-	122,	// sample 20
-	137,	// sample 21
-	139,	// sample 22
-	154,	// sample 23
-	162,	// sample 24
-	153,	// sample 25
-	142,	// sample 26
-	145,	// sample 27
-	138,	// sample 28
-	136,	// sample 29
-	150,	// sample 30
-	144,	// sample 31
-	128,	// sample 32
-	112,	// sample 33
-	103,	// sample 34
-	101,	// sample 35
-	112,	// sample 36
-	124,	// sample 37
-	115,	// sample 38
-	 99,	// sample 39
-	103,	// sample 40
-	 94,	// sample 41
-	 89,	// sample 42
-	160,	// sample 43
-	174,	// sample 44
-	150,	// sample 45
-	154,	// sample 46
-	135,	// sample 47
-	116,	// sample 48
-	126,	// sample 49
-	141,	// sample 50
-	144,	// sample 51
-	138,	// sample 52
-	121,	// sample 53
-	104,	// sample 54
-	 93,	// sample 55
-	103,	// sample 56
-	113,	// sample 57
-	115,	// sample 58
-	118,	// sample 59
-	116,	// sample 60
-	106,	// sample 61
-	110,	// sample 62
-	127,	// sample 63
-	128,	// -------- wave 142 (8eh), sample 00
-	207,	// sample 01
-	183,	// sample 02
-	171,	// sample 03
-	174,	// sample 04
-	144,	// sample 05
-	142,	// sample 06
-	137,	// sample 07
-	135,	// sample 08
-	154,	// sample 09
-	157,	// sample 10
-	123,	// sample 11
-	121,	// sample 12
-	137,	// sample 13
-	138,	// sample 14
-	122,	// sample 15
-	128,	// sample 16
-	105,	// sample 17
-	 97,	// sample 18
-	138,	// sample 19
-	126,	// sample 20
-	122,	// sample 21
-	155,	// sample 22
-	137,	// sample 23
-	135,	// sample 24
-	114,	// sample 25
-	159,	// sample 26
-	148,	// sample 27
-	147,	// sample 28
-	133,	// sample 29
-	148,	// sample 30
-	152,	// sample 31
-	128,	// sample 32
-	 96,	// sample 33
-	119,	// sample 34
-	101,	// sample 35
-	 92,	// sample 36
-	145,	// sample 37
-	135,	// sample 38
-	104,	// sample 39
-	135,	// sample 40
-	109,	// sample 41
-	 96,	// sample 42
-	152,	// sample 43
-	167,	// sample 44
-	137,	// sample 45
-	132,	// sample 46
-	140,	// sample 47
-	128,	// sample 48
-	114,	// sample 49
-	127,	// sample 50
-	114,	// sample 51
-	160,	// sample 52
-	132,	// sample 53
-	 99,	// sample 54
-	121,	// sample 55
-	135,	// sample 56
-	122,	// sample 57
-	119,	// sample 58
-	122,	// sample 59
-	114,	// sample 60
-	119,	// sample 61
-	108,	// sample 62
-	107,	// sample 63
-	128,	// -------- wave 143 (8fh), sample 00
-	205,	// sample 01
-	180,	// sample 02
-	160,	// sample 03
-	152,	// sample 04
-	139,	// sample 05
-	141,	// sample 06
-	138,	// sample 07
-	128,	// sample 08
-	141,	// sample 09
-	186,	// sample 10
-	 99,	// sample 11
-	146,	// sample 12
-	124,	// sample 13
-	115,	// sample 14
-	124,	// sample 15
-	128,	// sample 16
-	104,	// sample 17
-	101,	// sample 18
-	132,	// sample 19
-	152,	// sample 20
-	105,	// sample 21
-	162,	// sample 22
-	121,	// sample 23
-	128,	// sample 24
-	113,	// sample 25
-	159,	// sample 26
-	147,	// sample 27
-	114,	// sample 28
-	138,	// sample 29
-	158,	// sample 30
-	149,	// sample 31
-	128,	// sample 32
-	109,	// sample 33
-	 88,	// sample 34
-	128,	// sample 35
-	114,	// sample 36
-	146,	// sample 37
-	123,	// sample 38
-	110,	// sample 39
-	128,	// sample 40
-	116,	// sample 41
-	 78,	// sample 42
-	188,	// sample 43
-	152,	// sample 44
-	145,	// sample 45
-	121,	// sample 46
-	144,	// sample 47
-	128,	// sample 48
-	 97,	// sample 49
-	136,	// sample 50
-	106,	// sample 51
-	146,	// sample 52
-	154,	// sample 53
-	 98,	// sample 54
-	127,	// sample 55
-	128,	// sample 56
-	125,	// sample 57
-	107,	// sample 58
-	111,	// sample 59
-	152,	// sample 60
-	117,	// sample 61
-	107,	// sample 62
-	 97,	// sample 63
-	128,	// -------- wave 144 (90h), sample 00
-	202,	// sample 01
-	169,	// sample 02
-	212,	// sample 03
-	128,	// sample 04
-	183,	// sample 05
-	144,	// sample 06
-	155,	// sample 07
-	128,	// sample 08
-	164,	// sample 09
-	 99,	// sample 10
-	179,	// sample 11
-	128,	// sample 12
-	114,	// sample 13
-	135,	// sample 14
-	103,	// sample 15
-	128,	// sample 16
-	130,	// sample 17
-	141,	// sample 18
-	121,	// sample 19
-	128,	// sample 20
-	185,	// sample 21
-	130,	// sample 22
-	168,	// sample 23
-	128,	// sample 24
-	135,	// sample 25
-	136,	// sample 26
-	178,	// sample 27
-	128,	// sample 28
-	170,	// sample 29
-	155,	// sample 30
-	165,	// sample 31
-	128,	// sample 32
-	 93,	// sample 33
-	155,	// sample 34
-	 55,	// sample 35
-	128,	// sample 36
-	121,	// sample 37
-	136,	// sample 38
-	 79,	// sample 39
-	128,	// sample 40
-	 67,	// sample 41
-	130,	// sample 42
-	 91,	// sample 43
-	128,	// sample 44
-	149,	// sample 45
-	141,	// sample 46
-	142,	// sample 47
-	128,	// sample 48
-	116,	// sample 49
-	135,	// sample 50
-	147,	// sample 51
-	128,	// sample 52
-	 86,	// sample 53
-	 99,	// sample 54
-	 68,	// sample 55
-	128,	// sample 56
-	101,	// sample 57
-	144,	// sample 58
-	131,	// sample 59
-	128,	// sample 60
-	 94,	// sample 61
-	169,	// sample 62
-	129,	// sample 63
-	132,	// -------- wave 145 (91h), sample 00
-	144,	// sample 01
-	157,	// sample 02
-	169,	// sample 03
-	180,	// sample 04
-	192,	// sample 05
-	202,	// sample 06
-	211,	// sample 07
-	218,	// sample 08
-	225,	// sample 09
-	231,	// sample 10
-	236,	// sample 11
-	239,	// sample 12
-	242,	// sample 13
-	244,	// sample 14
-	245,	// sample 15
-	244,	// sample 16
-	243,	// sample 17
-	240,	// sample 18
-	237,	// sample 19
-	233,	// sample 20
-	229,	// sample 21
-	223,	// sample 22
-	220,	// sample 23
-	214,	// sample 24
-	209,	// sample 25
-	206,	// sample 26
-	200,	// sample 27
-	195,	// sample 28
-	190,	// sample 29
-	186,	// sample 30
-	181,	// sample 31
-	177,	// sample 32
-	174,	// sample 33
-	170,	// sample 34
-	167,	// sample 35
-	165,	// sample 36
-	162,	// sample 37
-	161,	// sample 38
-	159,	// sample 39
-	157,	// sample 40
-	155,	// sample 41
-	153,	// sample 42
-	153,	// sample 43
-	151,	// sample 44
-	149,	// sample 45
-	148,	// sample 46
-	145,	// sample 47
-	145,	// sample 48
-	144,	// sample 49
-	142,	// sample 50
-	141,	// sample 51
-	139,	// sample 52
-	138,	// sample 53
-	136,	// sample 54
-	135,	// sample 55
-	135,	// sample 56
-	133,	// sample 57
-	133,	// sample 58
-	131,	// sample 59
-	131,	// sample 60
-	130,	// sample 61
-	128,	// sample 62
-	128,	// sample 63
-	131,	// -------- wave 146 (92h), sample 00
-	143,	// sample 01
-	154,	// sample 02
-	164,	// sample 03
-	173,	// sample 04
-	184,	// sample 05
-	192,	// sample 06
-	199,	// sample 07
-	206,	// sample 08
-	211,	// sample 09
-	215,	// sample 10
-	218,	// sample 11
-	221,	// sample 12
-	223,	// sample 13
-	222,	// sample 14
-	222,	// sample 15
-	222,	// sample 16
-	221,	// sample 17
-	219,	// sample 18
-	218,	// sample 19
-	216,	// sample 20
-	214,	// sample 21
-	214,	// sample 22
-	212,	// sample 23
-	210,	// sample 24
-	212,	// sample 25
-	211,	// sample 26
-	213,	// sample 27
-	214,	// sample 28
-	214,	// sample 29
-	217,	// sample 30
-	219,	// sample 31
-	219,	// sample 32
-	221,	// sample 33
-	222,	// sample 34
-	223,	// sample 35
-	223,	// sample 36
-	223,	// sample 37
-	223,	// sample 38
-	221,	// sample 39
-	219,	// sample 40
-	215,	// sample 41
-	212,	// sample 42
-	206,	// sample 43
-	202,	// sample 44
-	195,	// sample 45
-	189,	// sample 46
-	180,	// sample 47
-	175,	// sample 48
-	168,	// sample 49
-	162,	// sample 50
-	156,	// sample 51
-	150,	// sample 52
-	144,	// sample 53
-	140,	// sample 54
-	135,	// sample 55
-	132,	// sample 56
-	130,	// sample 57
-	127,	// sample 58
-	126,	// sample 59
-	125,	// sample 60
-	125,	// sample 61
-	125,	// sample 62
-	126,	// sample 63
-	132,	// -------- wave 147 (93h), sample 00
-	149,	// sample 01
-	166,	// sample 02
-	182,	// sample 03
-	196,	// sample 04
-	210,	// sample 05
-	220,	// sample 06
-	228,	// sample 07
-	235,	// sample 08
-	238,	// sample 09
-	241,	// sample 10
-	241,	// sample 11
-	238,	// sample 12
-	233,	// sample 13
-	228,	// sample 14
-	222,	// sample 15
-	215,	// sample 16
-	205,	// sample 17
-	197,	// sample 18
-	189,	// sample 19
-	181,	// sample 20
-	176,	// sample 21
-	169,	// sample 22
-	164,	// sample 23
-	160,	// sample 24
-	157,	// sample 25
-	155,	// sample 26
-	156,	// sample 27
-	154,	// sample 28
-	154,	// sample 29
-	154,	// sample 30
-	155,	// sample 31
-	156,	// sample 32
-	157,	// sample 33
-	157,	// sample 34
-	158,	// sample 35
-	157,	// sample 36
-	155,	// sample 37
-	155,	// sample 38
-	152,	// sample 39
-	152,	// sample 40
-	149,	// sample 41
-	149,	// sample 42
-	146,	// sample 43
-	144,	// sample 44
-	142,	// sample 45
-	140,	// sample 46
-	137,	// sample 47
-	135,	// sample 48
-	134,	// sample 49
-	131,	// sample 50
-	131,	// sample 51
-	132,	// sample 52
-	131,	// sample 53
-	131,	// sample 54
-	131,	// sample 55
-	130,	// sample 56
-	131,	// sample 57
-	131,	// sample 58
-	130,	// sample 59
-	130,	// sample 60
-	128,	// sample 61
-	127,	// sample 62
-	128,	// sample 63
-	130,	// -------- wave 148 (94h), sample 00
-	150,	// sample 01
-	168,	// sample 02
-	184,	// sample 03
-	199,	// sample 04
-	212,	// sample 05
-	223,	// sample 06
-	230,	// sample 07
-	234,	// sample 08
-	237,	// sample 09
-	237,	// sample 10
-	235,	// sample 11
-	229,	// sample 12
-	223,	// sample 13
-	218,	// sample 14
-	211,	// sample 15
-	203,	// sample 16
-	193,	// sample 17
-	187,	// sample 18
-	180,	// sample 19
-	174,	// sample 20
-	168,	// sample 21
-	163,	// sample 22
-	160,	// sample 23
-	156,	// sample 24
-	152,	// sample 25
-	149,	// sample 26
-	147,	// sample 27
-	144,	// sample 28
-	140,	// sample 29
-	136,	// sample 30
-	131,	// sample 31
-	127,	// sample 32
-	122,	// sample 33
-	117,	// sample 34
-	112,	// sample 35
-	106,	// sample 36
-	100,	// sample 37
-	 96,	// sample 38
-	 93,	// sample 39
-	 90,	// sample 40
-	 88,	// sample 41
-	 87,	// sample 42
-	 86,	// sample 43
-	 87,	// sample 44
-	 89,	// sample 45
-	 91,	// sample 46
-	 95,	// sample 47
-	 97,	// sample 48
-	102,	// sample 49
-	106,	// sample 50
-	110,	// sample 51
-	115,	// sample 52
-	120,	// sample 53
-	123,	// sample 54
-	126,	// sample 55
-	129,	// sample 56
-	130,	// sample 57
-	132,	// sample 58
-	133,	// sample 59
-	132,	// sample 60
-	133,	// sample 61
-	130,	// sample 62
-	129,	// sample 63
-	131,	// -------- wave 149 (95h), sample 00
-	154,	// sample 01
-	174,	// sample 02
-	193,	// sample 03
-	209,	// sample 04
-	223,	// sample 05
-	234,	// sample 06
-	242,	// sample 07
-	245,	// sample 08
-	248,	// sample 09
-	246,	// sample 10
-	245,	// sample 11
-	238,	// sample 12
-	233,	// sample 13
-	228,	// sample 14
-	223,	// sample 15
-	219,	// sample 16
-	213,	// sample 17
-	211,	// sample 18
-	208,	// sample 19
-	209,	// sample 20
-	209,	// sample 21
-	212,	// sample 22
-	215,	// sample 23
-	217,	// sample 24
-	219,	// sample 25
-	220,	// sample 26
-	221,	// sample 27
-	220,	// sample 28
-	219,	// sample 29
-	215,	// sample 30
-	209,	// sample 31
-	205,	// sample 32
-	197,	// sample 33
-	191,	// sample 34
-	184,	// sample 35
-	178,	// sample 36
-	168,	// sample 37
-	163,	// sample 38
-	159,	// sample 39
-	155,	// sample 40
-	152,	// sample 41
-	149,	// sample 42
-	147,	// sample 43
-	147,	// sample 44
-	147,	// sample 45
-	148,	// sample 46
-	148,	// sample 47
-	149,	// sample 48
-	150,	// sample 49
-	151,	// sample 50
-	151,	// sample 51
-	150,	// sample 52
-	149,	// sample 53
-	148,	// sample 54
-	145,	// sample 55
-	142,	// sample 56
-	141,	// sample 57
-	139,	// sample 58
-	137,	// sample 59
-	134,	// sample 60
-	133,	// sample 61
-	130,	// sample 62
-	129,	// sample 63
-	131,	// -------- wave 150 (96h), sample 00
-	151,	// sample 01
-	168,	// sample 02
-	184,	// sample 03
-	198,	// sample 04
-	208,	// sample 05
-	213,	// sample 06
-	218,	// sample 07
-	216,	// sample 08
-	214,	// sample 09
-	210,	// sample 10
-	203,	// sample 11
-	196,	// sample 12
-	187,	// sample 13
-	181,	// sample 14
-	176,	// sample 15
-	171,	// sample 16
-	169,	// sample 17
-	170,	// sample 18
-	172,	// sample 19
-	176,	// sample 20
-	182,	// sample 21
-	187,	// sample 22
-	193,	// sample 23
-	200,	// sample 24
-	206,	// sample 25
-	210,	// sample 26
-	215,	// sample 27
-	216,	// sample 28
-	219,	// sample 29
-	219,	// sample 30
-	219,	// sample 31
-	219,	// sample 32
-	218,	// sample 33
-	218,	// sample 34
-	219,	// sample 35
-	218,	// sample 36
-	221,	// sample 37
-	222,	// sample 38
-	222,	// sample 39
-	224,	// sample 40
-	224,	// sample 41
-	227,	// sample 42
-	224,	// sample 43
-	223,	// sample 44
-	221,	// sample 45
-	217,	// sample 46
-	211,	// sample 47
-	205,	// sample 48
-	196,	// sample 49
-	188,	// sample 50
-	179,	// sample 51
-	169,	// sample 52
-	160,	// sample 53
-	152,	// sample 54
-	144,	// sample 55
-	137,	// sample 56
-	132,	// sample 57
-	128,	// sample 58
-	125,	// sample 59
-	124,	// sample 60
-	123,	// sample 61
-	124,	// sample 62
-	125,	// sample 63
-	132,	// -------- wave 151 (97h), sample 00
-	162,	// sample 01
-	186,	// sample 02
-	209,	// sample 03
-	225,	// sample 04
-	239,	// sample 05
-	247,	// sample 06
-	249,	// sample 07
-	248,	// sample 08
-	240,	// sample 09
-	234,	// sample 10
-	224,	// sample 11
-	216,	// sample 12
-	206,	// sample 13
-	199,	// sample 14
-	195,	// sample 15
-	189,	// sample 16
-	188,	// sample 17
-	187,	// sample 18
-	188,	// sample 19
-	188,	// sample 20
-	188,	// sample 21
-	187,	// sample 22
-	182,	// sample 23
-	177,	// sample 24
-	172,	// sample 25
-	162,	// sample 26
-	157,	// sample 27
-	149,	// sample 28
-	141,	// sample 29
-	136,	// sample 30
-	131,	// sample 31
-	128,	// sample 32
-	128,	// sample 33
-	127,	// sample 34
-	130,	// sample 35
-	132,	// sample 36
-	135,	// sample 37
-	140,	// sample 38
-	140,	// sample 39
-	144,	// sample 40
-	145,	// sample 41
-	144,	// sample 42
-	143,	// sample 43
-	140,	// sample 44
-	138,	// sample 45
-	134,	// sample 46
-	130,	// sample 47
-	126,	// sample 48
-	125,	// sample 49
-	121,	// sample 50
-	121,	// sample 51
-	120,	// sample 52
-	123,	// sample 53
-	123,	// sample 54
-	124,	// sample 55
-	125,	// sample 56
-	127,	// sample 57
-	128,	// sample 58
-	128,	// sample 59
-	130,	// sample 60
-	128,	// sample 61
-	129,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 152 (98h), sample 00
-	160,	// sample 01
-	186,	// sample 02
-	208,	// sample 03
-	224,	// sample 04
-	236,	// sample 05
-	242,	// sample 06
-	243,	// sample 07
-	238,	// sample 08
-	231,	// sample 09
-	223,	// sample 10
-	215,	// sample 11
-	206,	// sample 12
-	200,	// sample 13
-	195,	// sample 14
-	195,	// sample 15
-	194,	// sample 16
-	194,	// sample 17
-	196,	// sample 18
-	196,	// sample 19
-	195,	// sample 20
-	192,	// sample 21
-	185,	// sample 22
-	178,	// sample 23
-	168,	// sample 24
-	157,	// sample 25
-	145,	// sample 26
-	136,	// sample 27
-	127,	// sample 28
-	120,	// sample 29
-	115,	// sample 30
-	112,	// sample 31
-	111,	// sample 32
-	112,	// sample 33
-	115,	// sample 34
-	116,	// sample 35
-	117,	// sample 36
-	116,	// sample 37
-	113,	// sample 38
-	109,	// sample 39
-	106,	// sample 40
-	 99,	// sample 41
-	 94,	// sample 42
-	 87,	// sample 43
-	 83,	// sample 44
-	 80,	// sample 45
-	 80,	// sample 46
-	 82,	// sample 47
-	 85,	// sample 48
-	 92,	// sample 49
-	 98,	// sample 50
-	105,	// sample 51
-	114,	// sample 52
-	122,	// sample 53
-	128,	// sample 54
-	132,	// sample 55
-	137,	// sample 56
-	138,	// sample 57
-	139,	// sample 58
-	140,	// sample 59
-	138,	// sample 60
-	137,	// sample 61
-	133,	// sample 62
-	130,	// sample 63
-	131,	// -------- wave 153 (99h), sample 00
-	168,	// sample 01
-	197,	// sample 02
-	223,	// sample 03
-	236,	// sample 04
-	243,	// sample 05
-	242,	// sample 06
-	233,	// sample 07
-	223,	// sample 08
-	210,	// sample 09
-	202,	// sample 10
-	197,	// sample 11
-	194,	// sample 12
-	199,	// sample 13
-	202,	// sample 14
-	211,	// sample 15
-	217,	// sample 16
-	220,	// sample 17
-	223,	// sample 18
-	222,	// sample 19
-	217,	// sample 20
-	216,	// sample 21
-	212,	// sample 22
-	208,	// sample 23
-	210,	// sample 24
-	210,	// sample 25
-	216,	// sample 26
-	220,	// sample 27
-	227,	// sample 28
-	231,	// sample 29
-	235,	// sample 30
-	237,	// sample 31
-	236,	// sample 32
-	234,	// sample 33
-	229,	// sample 34
-	223,	// sample 35
-	216,	// sample 36
-	208,	// sample 37
-	202,	// sample 38
-	196,	// sample 39
-	189,	// sample 40
-	184,	// sample 41
-	183,	// sample 42
-	180,	// sample 43
-	178,	// sample 44
-	178,	// sample 45
-	179,	// sample 46
-	179,	// sample 47
-	177,	// sample 48
-	175,	// sample 49
-	172,	// sample 50
-	168,	// sample 51
-	160,	// sample 52
-	153,	// sample 53
-	145,	// sample 54
-	136,	// sample 55
-	132,	// sample 56
-	126,	// sample 57
-	123,	// sample 58
-	119,	// sample 59
-	119,	// sample 60
-	118,	// sample 61
-	121,	// sample 62
-	124,	// sample 63
-	131,	// -------- wave 154 (9ah), sample 00
-	167,	// sample 01
-	197,	// sample 02
-	221,	// sample 03
-	233,	// sample 04
-	234,	// sample 05
-	229,	// sample 06
-	218,	// sample 07
-	205,	// sample 08
-	194,	// sample 09
-	187,	// sample 10
-	184,	// sample 11
-	184,	// sample 12
-	191,	// sample 13
-	196,	// sample 14
-	202,	// sample 15
-	205,	// sample 16
-	204,	// sample 17
-	201,	// sample 18
-	198,	// sample 19
-	193,	// sample 20
-	189,	// sample 21
-	188,	// sample 22
-	190,	// sample 23
-	189,	// sample 24
-	195,	// sample 25
-	199,	// sample 26
-	203,	// sample 27
-	206,	// sample 28
-	210,	// sample 29
-	210,	// sample 30
-	207,	// sample 31
-	205,	// sample 32
-	202,	// sample 33
-	200,	// sample 34
-	198,	// sample 35
-	197,	// sample 36
-	199,	// sample 37
-	202,	// sample 38
-	205,	// sample 39
-	211,	// sample 40
-	215,	// sample 41
-	220,	// sample 42
-	220,	// sample 43
-	222,	// sample 44
-	219,	// sample 45
-	213,	// sample 46
-	204,	// sample 47
-	198,	// sample 48
-	187,	// sample 49
-	178,	// sample 50
-	167,	// sample 51
-	159,	// sample 52
-	149,	// sample 53
-	143,	// sample 54
-	136,	// sample 55
-	131,	// sample 56
-	129,	// sample 57
-	123,	// sample 58
-	122,	// sample 59
-	120,	// sample 60
-	120,	// sample 61
-	120,	// sample 62
-	125,	// sample 63
-	131,	// -------- wave 155 (9bh), sample 00
-	173,	// sample 01
-	210,	// sample 02
-	234,	// sample 03
-	248,	// sample 04
-	252,	// sample 05
-	247,	// sample 06
-	236,	// sample 07
-	226,	// sample 08
-	215,	// sample 09
-	213,	// sample 10
-	213,	// sample 11
-	215,	// sample 12
-	218,	// sample 13
-	217,	// sample 14
-	216,	// sample 15
-	209,	// sample 16
-	201,	// sample 17
-	188,	// sample 18
-	178,	// sample 19
-	171,	// sample 20
-	169,	// sample 21
-	167,	// sample 22
-	168,	// sample 23
-	170,	// sample 24
-	170,	// sample 25
-	167,	// sample 26
-	159,	// sample 27
-	149,	// sample 28
-	139,	// sample 29
-	130,	// sample 30
-	122,	// sample 31
-	115,	// sample 32
-	113,	// sample 33
-	115,	// sample 34
-	118,	// sample 35
-	121,	// sample 36
-	127,	// sample 37
-	128,	// sample 38
-	130,	// sample 39
-	132,	// sample 40
-	133,	// sample 41
-	133,	// sample 42
-	130,	// sample 43
-	128,	// sample 44
-	124,	// sample 45
-	121,	// sample 46
-	118,	// sample 47
-	115,	// sample 48
-	112,	// sample 49
-	111,	// sample 50
-	112,	// sample 51
-	116,	// sample 52
-	119,	// sample 53
-	124,	// sample 54
-	126,	// sample 55
-	132,	// sample 56
-	132,	// sample 57
-	133,	// sample 58
-	133,	// sample 59
-	131,	// sample 60
-	128,	// sample 61
-	128,	// sample 62
-	130,	// sample 63
-	131,	// -------- wave 156 (9ch), sample 00
-	178,	// sample 01
-	213,	// sample 02
-	239,	// sample 03
-	248,	// sample 04
-	245,	// sample 05
-	234,	// sample 06
-	223,	// sample 07
-	214,	// sample 08
-	210,	// sample 09
-	213,	// sample 10
-	219,	// sample 11
-	225,	// sample 12
-	229,	// sample 13
-	229,	// sample 14
-	225,	// sample 15
-	222,	// sample 16
-	216,	// sample 17
-	215,	// sample 18
-	215,	// sample 19
-	218,	// sample 20
-	224,	// sample 21
-	223,	// sample 22
-	221,	// sample 23
-	214,	// sample 24
-	203,	// sample 25
-	191,	// sample 26
-	177,	// sample 27
-	166,	// sample 28
-	160,	// sample 29
-	158,	// sample 30
-	157,	// sample 31
-	157,	// sample 32
-	159,	// sample 33
-	157,	// sample 34
-	156,	// sample 35
-	153,	// sample 36
-	146,	// sample 37
-	141,	// sample 38
-	133,	// sample 39
-	125,	// sample 40
-	117,	// sample 41
-	111,	// sample 42
-	104,	// sample 43
-	 99,	// sample 44
-	 99,	// sample 45
-	100,	// sample 46
-	103,	// sample 47
-	111,	// sample 48
-	118,	// sample 49
-	127,	// sample 50
-	133,	// sample 51
-	141,	// sample 52
-	146,	// sample 53
-	151,	// sample 54
-	154,	// sample 55
-	157,	// sample 56
-	156,	// sample 57
-	156,	// sample 58
-	153,	// sample 59
-	150,	// sample 60
-	147,	// sample 61
-	141,	// sample 62
-	133,	// sample 63
-	131,	// -------- wave 157 (9dh), sample 00
-	179,	// sample 01
-	215,	// sample 02
-	236,	// sample 03
-	240,	// sample 04
-	235,	// sample 05
-	222,	// sample 06
-	210,	// sample 07
-	206,	// sample 08
-	203,	// sample 09
-	207,	// sample 10
-	210,	// sample 11
-	209,	// sample 12
-	207,	// sample 13
-	201,	// sample 14
-	196,	// sample 15
-	196,	// sample 16
-	200,	// sample 17
-	206,	// sample 18
-	213,	// sample 19
-	218,	// sample 20
-	220,	// sample 21
-	215,	// sample 22
-	208,	// sample 23
-	203,	// sample 24
-	202,	// sample 25
-	206,	// sample 26
-	216,	// sample 27
-	226,	// sample 28
-	235,	// sample 29
-	246,	// sample 30
-	250,	// sample 31
-	246,	// sample 32
-	241,	// sample 33
-	236,	// sample 34
-	227,	// sample 35
-	219,	// sample 36
-	209,	// sample 37
-	203,	// sample 38
-	195,	// sample 39
-	190,	// sample 40
-	187,	// sample 41
-	191,	// sample 42
-	191,	// sample 43
-	195,	// sample 44
-	195,	// sample 45
-	195,	// sample 46
-	189,	// sample 47
-	184,	// sample 48
-	179,	// sample 49
-	173,	// sample 50
-	167,	// sample 51
-	160,	// sample 52
-	156,	// sample 53
-	150,	// sample 54
-	142,	// sample 55
-	134,	// sample 56
-	127,	// sample 57
-	118,	// sample 58
-	115,	// sample 59
-	112,	// sample 60
-	113,	// sample 61
-	116,	// sample 62
-	121,	// sample 63
-	131,	// -------- wave 158 (9eh), sample 00
-	181,	// sample 01
-	216,	// sample 02
-	236,	// sample 03
-	239,	// sample 04
-	228,	// sample 05
-	217,	// sample 06
-	206,	// sample 07
-	203,	// sample 08
-	204,	// sample 09
-	206,	// sample 10
-	204,	// sample 11
-	197,	// sample 12
-	194,	// sample 13
-	191,	// sample 14
-	192,	// sample 15
-	197,	// sample 16
-	204,	// sample 17
-	209,	// sample 18
-	209,	// sample 19
-	203,	// sample 20
-	194,	// sample 21
-	186,	// sample 22
-	183,	// sample 23
-	181,	// sample 24
-	187,	// sample 25
-	194,	// sample 26
-	199,	// sample 27
-	205,	// sample 28
-	210,	// sample 29
-	211,	// sample 30
-	206,	// sample 31
-	203,	// sample 32
-	197,	// sample 33
-	193,	// sample 34
-	190,	// sample 35
-	190,	// sample 36
-	194,	// sample 37
-	200,	// sample 38
-	207,	// sample 39
-	215,	// sample 40
-	220,	// sample 41
-	223,	// sample 42
-	219,	// sample 43
-	219,	// sample 44
-	215,	// sample 45
-	209,	// sample 46
-	206,	// sample 47
-	202,	// sample 48
-	195,	// sample 49
-	185,	// sample 50
-	175,	// sample 51
-	162,	// sample 52
-	152,	// sample 53
-	144,	// sample 54
-	137,	// sample 55
-	132,	// sample 56
-	130,	// sample 57
-	126,	// sample 58
-	125,	// sample 59
-	125,	// sample 60
-	123,	// sample 61
-	123,	// sample 62
-	125,	// sample 63
-	130,	// -------- wave 159 (9fh), sample 00
-	185,	// sample 01
-	222,	// sample 02
-	238,	// sample 03
-	238,	// sample 04
-	231,	// sample 05
-	224,	// sample 06
-	222,	// sample 07
-	223,	// sample 08
-	223,	// sample 09
-	217,	// sample 10
-	212,	// sample 11
-	204,	// sample 12
-	202,	// sample 13
-	202,	// sample 14
-	203,	// sample 15
-	200,	// sample 16
-	189,	// sample 17
-	179,	// sample 18
-	169,	// sample 19
-	166,	// sample 20
-	163,	// sample 21
-	165,	// sample 22
-	167,	// sample 23
-	167,	// sample 24
-	162,	// sample 25
-	152,	// sample 26
-	138,	// sample 27
-	122,	// sample 28
-	107,	// sample 29
-	 99,	// sample 30
-	 95,	// sample 31
-	 96,	// sample 32
-	103,	// sample 33
-	107,	// sample 34
-	108,	// sample 35
-	109,	// sample 36
-	104,	// sample 37
-	103,	// sample 38
-	101,	// sample 39
-	 98,	// sample 40
-	 96,	// sample 41
-	 89,	// sample 42
-	 84,	// sample 43
-	 79,	// sample 44
-	 76,	// sample 45
-	 75,	// sample 46
-	 77,	// sample 47
-	 80,	// sample 48
-	 84,	// sample 49
-	 89,	// sample 50
-	 97,	// sample 51
-	104,	// sample 52
-	117,	// sample 53
-	125,	// sample 54
-	130,	// sample 55
-	131,	// sample 56
-	132,	// sample 57
-	135,	// sample 58
-	134,	// sample 59
-	131,	// sample 60
-	132,	// sample 61
-	129,	// sample 62
-	128,	// sample 63
-	132,	// -------- wave 160 (a0h), sample 00
-	195,	// sample 01
-	230,	// sample 02
-	245,	// sample 03
-	243,	// sample 04
-	235,	// sample 05
-	231,	// sample 06
-	230,	// sample 07
-	231,	// sample 08
-	229,	// sample 09
-	223,	// sample 10
-	223,	// sample 11
-	227,	// sample 12
-	228,	// sample 13
-	230,	// sample 14
-	229,	// sample 15
-	224,	// sample 16
-	219,	// sample 17
-	218,	// sample 18
-	223,	// sample 19
-	228,	// sample 20
-	231,	// sample 21
-	229,	// sample 22
-	228,	// sample 23
-	221,	// sample 24
-	211,	// sample 25
-	198,	// sample 26
-	182,	// sample 27
-	174,	// sample 28
-	176,	// sample 29
-	179,	// sample 30
-	185,	// sample 31
-	187,	// sample 32
-	187,	// sample 33
-	183,	// sample 34
-	173,	// sample 35
-	169,	// sample 36
-	160,	// sample 37
-	154,	// sample 38
-	146,	// sample 39
-	138,	// sample 40
-	128,	// sample 41
-	124,	// sample 42
-	118,	// sample 43
-	118,	// sample 44
-	120,	// sample 45
-	126,	// sample 46
-	136,	// sample 47
-	141,	// sample 48
-	144,	// sample 49
-	143,	// sample 50
-	141,	// sample 51
-	142,	// sample 52
-	147,	// sample 53
-	150,	// sample 54
-	154,	// sample 55
-	153,	// sample 56
-	153,	// sample 57
-	154,	// sample 58
-	153,	// sample 59
-	148,	// sample 60
-	145,	// sample 61
-	138,	// sample 62
-	133,	// sample 63
-	131,	// -------- wave 161 (a1h), sample 00
-	189,	// sample 01
-	223,	// sample 02
-	231,	// sample 03
-	225,	// sample 04
-	220,	// sample 05
-	214,	// sample 06
-	215,	// sample 07
-	209,	// sample 08
-	198,	// sample 09
-	195,	// sample 10
-	200,	// sample 11
-	204,	// sample 12
-	203,	// sample 13
-	198,	// sample 14
-	188,	// sample 15
-	186,	// sample 16
-	195,	// sample 17
-	204,	// sample 18
-	212,	// sample 19
-	215,	// sample 20
-	216,	// sample 21
-	209,	// sample 22
-	204,	// sample 23
-	198,	// sample 24
-	198,	// sample 25
-	205,	// sample 26
-	215,	// sample 27
-	228,	// sample 28
-	239,	// sample 29
-	246,	// sample 30
-	247,	// sample 31
-	248,	// sample 32
-	246,	// sample 33
-	242,	// sample 34
-	233,	// sample 35
-	223,	// sample 36
-	212,	// sample 37
-	206,	// sample 38
-	201,	// sample 39
-	200,	// sample 40
-	198,	// sample 41
-	201,	// sample 42
-	199,	// sample 43
-	200,	// sample 44
-	197,	// sample 45
-	195,	// sample 46
-	192,	// sample 47
-	187,	// sample 48
-	184,	// sample 49
-	178,	// sample 50
-	167,	// sample 51
-	158,	// sample 52
-	151,	// sample 53
-	145,	// sample 54
-	139,	// sample 55
-	129,	// sample 56
-	120,	// sample 57
-	114,	// sample 58
-	111,	// sample 59
-	111,	// sample 60
-	113,	// sample 61
-	114,	// sample 62
-	120,	// sample 63
-	133,	// -------- wave 162 (a2h), sample 00
-	190,	// sample 01
-	225,	// sample 02
-	235,	// sample 03
-	233,	// sample 04
-	228,	// sample 05
-	223,	// sample 06
-	223,	// sample 07
-	222,	// sample 08
-	216,	// sample 09
-	215,	// sample 10
-	218,	// sample 11
-	218,	// sample 12
-	213,	// sample 13
-	205,	// sample 14
-	199,	// sample 15
-	204,	// sample 16
-	211,	// sample 17
-	213,	// sample 18
-	207,	// sample 19
-	193,	// sample 20
-	181,	// sample 21
-	172,	// sample 22
-	175,	// sample 23
-	178,	// sample 24
-	182,	// sample 25
-	182,	// sample 26
-	185,	// sample 27
-	185,	// sample 28
-	184,	// sample 29
-	181,	// sample 30
-	171,	// sample 31
-	163,	// sample 32
-	157,	// sample 33
-	148,	// sample 34
-	146,	// sample 35
-	149,	// sample 36
-	157,	// sample 37
-	169,	// sample 38
-	179,	// sample 39
-	184,	// sample 40
-	188,	// sample 41
-	187,	// sample 42
-	187,	// sample 43
-	185,	// sample 44
-	184,	// sample 45
-	178,	// sample 46
-	174,	// sample 47
-	169,	// sample 48
-	162,	// sample 49
-	151,	// sample 50
-	140,	// sample 51
-	127,	// sample 52
-	122,	// sample 53
-	124,	// sample 54
-	125,	// sample 55
-	123,	// sample 56
-	123,	// sample 57
-	123,	// sample 58
-	127,	// sample 59
-	128,	// sample 60
-	129,	// sample 61
-	131,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 163 (a3h), sample 00
-	189,	// sample 01
-	225,	// sample 02
-	241,	// sample 03
-	238,	// sample 04
-	230,	// sample 05
-	223,	// sample 06
-	223,	// sample 07
-	222,	// sample 08
-	221,	// sample 09
-	217,	// sample 10
-	217,	// sample 11
-	212,	// sample 12
-	210,	// sample 13
-	208,	// sample 14
-	209,	// sample 15
-	208,	// sample 16
-	200,	// sample 17
-	191,	// sample 18
-	179,	// sample 19
-	177,	// sample 20
-	176,	// sample 21
-	179,	// sample 22
-	181,	// sample 23
-	176,	// sample 24
-	168,	// sample 25
-	157,	// sample 26
-	145,	// sample 27
-	130,	// sample 28
-	116,	// sample 29
-	106,	// sample 30
-	103,	// sample 31
-	107,	// sample 32
-	116,	// sample 33
-	120,	// sample 34
-	119,	// sample 35
-	118,	// sample 36
-	112,	// sample 37
-	112,	// sample 38
-	110,	// sample 39
-	109,	// sample 40
-	101,	// sample 41
-	 96,	// sample 42
-	 90,	// sample 43
-	 86,	// sample 44
-	 79,	// sample 45
-	 77,	// sample 46
-	 79,	// sample 47
-	 83,	// sample 48
-	 92,	// sample 49
-	 98,	// sample 50
-	105,	// sample 51
-	114,	// sample 52
-	127,	// sample 53
-	134,	// sample 54
-	138,	// sample 55
-	137,	// sample 56
-	134,	// sample 57
-	137,	// sample 58
-	140,	// sample 59
-	137,	// sample 60
-	137,	// sample 61
-	131,	// sample 62
-	127,	// sample 63
-	132,	// -------- wave 164 (a4h), sample 00
-	192,	// sample 01
-	228,	// sample 02
-	243,	// sample 03
-	242,	// sample 04
-	235,	// sample 05
-	229,	// sample 06
-	227,	// sample 07
-	229,	// sample 08
-	229,	// sample 09
-	223,	// sample 10
-	222,	// sample 11
-	223,	// sample 12
-	223,	// sample 13
-	225,	// sample 14
-	224,	// sample 15
-	221,	// sample 16
-	214,	// sample 17
-	213,	// sample 18
-	218,	// sample 19
-	224,	// sample 20
-	231,	// sample 21
-	232,	// sample 22
-	232,	// sample 23
-	223,	// sample 24
-	215,	// sample 25
-	204,	// sample 26
-	191,	// sample 27
-	181,	// sample 28
-	180,	// sample 29
-	181,	// sample 30
-	185,	// sample 31
-	189,	// sample 32
-	191,	// sample 33
-	185,	// sample 34
-	175,	// sample 35
-	171,	// sample 36
-	160,	// sample 37
-	156,	// sample 38
-	150,	// sample 39
-	141,	// sample 40
-	128,	// sample 41
-	122,	// sample 42
-	117,	// sample 43
-	117,	// sample 44
-	120,	// sample 45
-	125,	// sample 46
-	134,	// sample 47
-	136,	// sample 48
-	141,	// sample 49
-	142,	// sample 50
-	142,	// sample 51
-	142,	// sample 52
-	145,	// sample 53
-	145,	// sample 54
-	150,	// sample 55
-	150,	// sample 56
-	149,	// sample 57
-	148,	// sample 58
-	145,	// sample 59
-	140,	// sample 60
-	140,	// sample 61
-	137,	// sample 62
-	133,	// sample 63
-	131,	// -------- wave 165 (a5h), sample 00
-	190,	// sample 01
-	223,	// sample 02
-	231,	// sample 03
-	227,	// sample 04
-	216,	// sample 05
-	210,	// sample 06
-	208,	// sample 07
-	203,	// sample 08
-	194,	// sample 09
-	192,	// sample 10
-	193,	// sample 11
-	194,	// sample 12
-	193,	// sample 13
-	188,	// sample 14
-	180,	// sample 15
-	185,	// sample 16
-	195,	// sample 17
-	203,	// sample 18
-	209,	// sample 19
-	202,	// sample 20
-	193,	// sample 21
-	185,	// sample 22
-	184,	// sample 23
-	183,	// sample 24
-	190,	// sample 25
-	196,	// sample 26
-	202,	// sample 27
-	207,	// sample 28
-	214,	// sample 29
-	216,	// sample 30
-	211,	// sample 31
-	213,	// sample 32
-	210,	// sample 33
-	206,	// sample 34
-	200,	// sample 35
-	197,	// sample 36
-	199,	// sample 37
-	208,	// sample 38
-	215,	// sample 39
-	223,	// sample 40
-	225,	// sample 41
-	230,	// sample 42
-	227,	// sample 43
-	229,	// sample 44
-	226,	// sample 45
-	219,	// sample 46
-	213,	// sample 47
-	205,	// sample 48
-	198,	// sample 49
-	186,	// sample 50
-	174,	// sample 51
-	163,	// sample 52
-	156,	// sample 53
-	150,	// sample 54
-	144,	// sample 55
-	137,	// sample 56
-	134,	// sample 57
-	129,	// sample 58
-	127,	// sample 59
-	125,	// sample 60
-	122,	// sample 61
-	119,	// sample 62
-	122,	// sample 63
-	132,	// -------- wave 166 (a6h), sample 00
-	191,	// sample 01
-	228,	// sample 02
-	242,	// sample 03
-	241,	// sample 04
-	238,	// sample 05
-	233,	// sample 06
-	230,	// sample 07
-	230,	// sample 08
-	222,	// sample 09
-	221,	// sample 10
-	221,	// sample 11
-	216,	// sample 12
-	209,	// sample 13
-	204,	// sample 14
-	200,	// sample 15
-	204,	// sample 16
-	211,	// sample 17
-	206,	// sample 18
-	194,	// sample 19
-	179,	// sample 20
-	171,	// sample 21
-	167,	// sample 22
-	177,	// sample 23
-	179,	// sample 24
-	181,	// sample 25
-	179,	// sample 26
-	177,	// sample 27
-	174,	// sample 28
-	168,	// sample 29
-	158,	// sample 30
-	144,	// sample 31
-	136,	// sample 32
-	130,	// sample 33
-	130,	// sample 34
-	134,	// sample 35
-	139,	// sample 36
-	145,	// sample 37
-	153,	// sample 38
-	159,	// sample 39
-	164,	// sample 40
-	160,	// sample 41
-	161,	// sample 42
-	159,	// sample 43
-	156,	// sample 44
-	155,	// sample 45
-	151,	// sample 46
-	145,	// sample 47
-	141,	// sample 48
-	136,	// sample 49
-	126,	// sample 50
-	122,	// sample 51
-	120,	// sample 52
-	121,	// sample 53
-	122,	// sample 54
-	125,	// sample 55
-	123,	// sample 56
-	124,	// sample 57
-	128,	// sample 58
-	133,	// sample 59
-	133,	// sample 60
-	127,	// sample 61
-	127,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 167 (a7h), sample 00
-	190,	// sample 01
-	227,	// sample 02
-	243,	// sample 03
-	241,	// sample 04
-	234,	// sample 05
-	225,	// sample 06
-	223,	// sample 07
-	223,	// sample 08
-	223,	// sample 09
-	219,	// sample 10
-	220,	// sample 11
-	216,	// sample 12
-	215,	// sample 13
-	216,	// sample 14
-	217,	// sample 15
-	217,	// sample 16
-	211,	// sample 17
-	201,	// sample 18
-	189,	// sample 19
-	187,	// sample 20
-	184,	// sample 21
-	187,	// sample 22
-	189,	// sample 23
-	183,	// sample 24
-	176,	// sample 25
-	165,	// sample 26
-	154,	// sample 27
-	140,	// sample 28
-	127,	// sample 29
-	119,	// sample 30
-	117,	// sample 31
-	121,	// sample 32
-	131,	// sample 33
-	132,	// sample 34
-	130,	// sample 35
-	129,	// sample 36
-	122,	// sample 37
-	120,	// sample 38
-	117,	// sample 39
-	114,	// sample 40
-	107,	// sample 41
-	 99,	// sample 42
-	 96,	// sample 43
-	 91,	// sample 44
-	 84,	// sample 45
-	 82,	// sample 46
-	 83,	// sample 47
-	 87,	// sample 48
-	 97,	// sample 49
-	103,	// sample 50
-	110,	// sample 51
-	117,	// sample 52
-	132,	// sample 53
-	140,	// sample 54
-	145,	// sample 55
-	143,	// sample 56
-	143,	// sample 57
-	147,	// sample 58
-	149,	// sample 59
-	145,	// sample 60
-	143,	// sample 61
-	137,	// sample 62
-	131,	// sample 63
-	131,	// -------- wave 168 (a8h), sample 00
-	194,	// sample 01
-	233,	// sample 02
-	247,	// sample 03
-	245,	// sample 04
-	238,	// sample 05
-	231,	// sample 06
-	229,	// sample 07
-	226,	// sample 08
-	224,	// sample 09
-	219,	// sample 10
-	220,	// sample 11
-	223,	// sample 12
-	224,	// sample 13
-	224,	// sample 14
-	221,	// sample 15
-	214,	// sample 16
-	210,	// sample 17
-	213,	// sample 18
-	222,	// sample 19
-	228,	// sample 20
-	231,	// sample 21
-	231,	// sample 22
-	226,	// sample 23
-	220,	// sample 24
-	212,	// sample 25
-	207,	// sample 26
-	203,	// sample 27
-	204,	// sample 28
-	212,	// sample 29
-	219,	// sample 30
-	223,	// sample 31
-	223,	// sample 32
-	220,	// sample 33
-	217,	// sample 34
-	210,	// sample 35
-	208,	// sample 36
-	201,	// sample 37
-	191,	// sample 38
-	179,	// sample 39
-	170,	// sample 40
-	163,	// sample 41
-	160,	// sample 42
-	160,	// sample 43
-	162,	// sample 44
-	161,	// sample 45
-	164,	// sample 46
-	167,	// sample 47
-	169,	// sample 48
-	164,	// sample 49
-	159,	// sample 50
-	154,	// sample 51
-	154,	// sample 52
-	154,	// sample 53
-	152,	// sample 54
-	150,	// sample 55
-	144,	// sample 56
-	140,	// sample 57
-	139,	// sample 58
-	136,	// sample 59
-	131,	// sample 60
-	131,	// sample 61
-	126,	// sample 62
-	126,	// sample 63
-	131,	// -------- wave 169 (a9h), sample 00
-	192,	// sample 01
-	225,	// sample 02
-	236,	// sample 03
-	232,	// sample 04
-	223,	// sample 05
-	220,	// sample 06
-	216,	// sample 07
-	210,	// sample 08
-	201,	// sample 09
-	197,	// sample 10
-	199,	// sample 11
-	200,	// sample 12
-	199,	// sample 13
-	193,	// sample 14
-	187,	// sample 15
-	191,	// sample 16
-	201,	// sample 17
-	210,	// sample 18
-	213,	// sample 19
-	205,	// sample 20
-	194,	// sample 21
-	186,	// sample 22
-	185,	// sample 23
-	183,	// sample 24
-	188,	// sample 25
-	194,	// sample 26
-	199,	// sample 27
-	205,	// sample 28
-	210,	// sample 29
-	208,	// sample 30
-	203,	// sample 31
-	201,	// sample 32
-	197,	// sample 33
-	193,	// sample 34
-	188,	// sample 35
-	187,	// sample 36
-	193,	// sample 37
-	201,	// sample 38
-	211,	// sample 39
-	219,	// sample 40
-	221,	// sample 41
-	222,	// sample 42
-	220,	// sample 43
-	221,	// sample 44
-	216,	// sample 45
-	210,	// sample 46
-	206,	// sample 47
-	201,	// sample 48
-	193,	// sample 49
-	183,	// sample 50
-	173,	// sample 51
-	160,	// sample 52
-	151,	// sample 53
-	144,	// sample 54
-	138,	// sample 55
-	133,	// sample 56
-	130,	// sample 57
-	129,	// sample 58
-	129,	// sample 59
-	128,	// sample 60
-	125,	// sample 61
-	123,	// sample 62
-	123,	// sample 63
-	132,	// -------- wave 170 (aah), sample 00
-	193,	// sample 01
-	231,	// sample 02
-	247,	// sample 03
-	246,	// sample 04
-	242,	// sample 05
-	234,	// sample 06
-	231,	// sample 07
-	229,	// sample 08
-	221,	// sample 09
-	221,	// sample 10
-	222,	// sample 11
-	219,	// sample 12
-	212,	// sample 13
-	207,	// sample 14
-	203,	// sample 15
-	208,	// sample 16
-	213,	// sample 17
-	207,	// sample 18
-	194,	// sample 19
-	178,	// sample 20
-	170,	// sample 21
-	167,	// sample 22
-	176,	// sample 23
-	179,	// sample 24
-	179,	// sample 25
-	176,	// sample 26
-	173,	// sample 27
-	170,	// sample 28
-	164,	// sample 29
-	155,	// sample 30
-	143,	// sample 31
-	136,	// sample 32
-	131,	// sample 33
-	131,	// sample 34
-	136,	// sample 35
-	139,	// sample 36
-	143,	// sample 37
-	149,	// sample 38
-	155,	// sample 39
-	160,	// sample 40
-	158,	// sample 41
-	161,	// sample 42
-	160,	// sample 43
-	160,	// sample 44
-	160,	// sample 45
-	156,	// sample 46
-	148,	// sample 47
-	145,	// sample 48
-	137,	// sample 49
-	125,	// sample 50
-	121,	// sample 51
-	118,	// sample 52
-	120,	// sample 53
-	123,	// sample 54
-	126,	// sample 55
-	126,	// sample 56
-	128,	// sample 57
-	131,	// sample 58
-	135,	// sample 59
-	134,	// sample 60
-	128,	// sample 61
-	127,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 171 (abh), sample 00
-	188,	// sample 01
-	225,	// sample 02
-	240,	// sample 03
-	241,	// sample 04
-	233,	// sample 05
-	227,	// sample 06
-	227,	// sample 07
-	228,	// sample 08
-	226,	// sample 09
-	221,	// sample 10
-	218,	// sample 11
-	218,	// sample 12
-	220,	// sample 13
-	225,	// sample 14
-	223,	// sample 15
-	222,	// sample 16
-	216,	// sample 17
-	214,	// sample 18
-	217,	// sample 19
-	223,	// sample 20
-	230,	// sample 21
-	230,	// sample 22
-	230,	// sample 23
-	222,	// sample 24
-	213,	// sample 25
-	199,	// sample 26
-	183,	// sample 27
-	170,	// sample 28
-	167,	// sample 29
-	167,	// sample 30
-	172,	// sample 31
-	176,	// sample 32
-	178,	// sample 33
-	173,	// sample 34
-	162,	// sample 35
-	157,	// sample 36
-	148,	// sample 37
-	144,	// sample 38
-	136,	// sample 39
-	127,	// sample 40
-	118,	// sample 41
-	112,	// sample 42
-	108,	// sample 43
-	109,	// sample 44
-	113,	// sample 45
-	115,	// sample 46
-	123,	// sample 47
-	125,	// sample 48
-	133,	// sample 49
-	137,	// sample 50
-	139,	// sample 51
-	142,	// sample 52
-	147,	// sample 53
-	150,	// sample 54
-	154,	// sample 55
-	155,	// sample 56
-	154,	// sample 57
-	155,	// sample 58
-	151,	// sample 59
-	148,	// sample 60
-	148,	// sample 61
-	142,	// sample 62
-	136,	// sample 63
-	131,	// -------- wave 172 (ach), sample 00
-	193,	// sample 01
-	227,	// sample 02
-	241,	// sample 03
-	237,	// sample 04
-	230,	// sample 05
-	227,	// sample 06
-	226,	// sample 07
-	222,	// sample 08
-	214,	// sample 09
-	209,	// sample 10
-	211,	// sample 11
-	214,	// sample 12
-	217,	// sample 13
-	213,	// sample 14
-	206,	// sample 15
-	203,	// sample 16
-	205,	// sample 17
-	213,	// sample 18
-	223,	// sample 19
-	226,	// sample 20
-	230,	// sample 21
-	223,	// sample 22
-	215,	// sample 23
-	208,	// sample 24
-	202,	// sample 25
-	203,	// sample 26
-	205,	// sample 27
-	218,	// sample 28
-	227,	// sample 29
-	236,	// sample 30
-	238,	// sample 31
-	234,	// sample 32
-	231,	// sample 33
-	230,	// sample 34
-	223,	// sample 35
-	217,	// sample 36
-	206,	// sample 37
-	197,	// sample 38
-	187,	// sample 39
-	181,	// sample 40
-	177,	// sample 41
-	180,	// sample 42
-	181,	// sample 43
-	184,	// sample 44
-	186,	// sample 45
-	186,	// sample 46
-	184,	// sample 47
-	179,	// sample 48
-	174,	// sample 49
-	170,	// sample 50
-	168,	// sample 51
-	163,	// sample 52
-	158,	// sample 53
-	150,	// sample 54
-	143,	// sample 55
-	140,	// sample 56
-	131,	// sample 57
-	128,	// sample 58
-	121,	// sample 59
-	118,	// sample 60
-	118,	// sample 61
-	121,	// sample 62
-	124,	// sample 63
-	131,	// -------- wave 173 (adh), sample 00
-	192,	// sample 01
-	224,	// sample 02
-	234,	// sample 03
-	230,	// sample 04
-	223,	// sample 05
-	218,	// sample 06
-	215,	// sample 07
-	211,	// sample 08
-	201,	// sample 09
-	200,	// sample 10
-	202,	// sample 11
-	204,	// sample 12
-	201,	// sample 13
-	197,	// sample 14
-	189,	// sample 15
-	193,	// sample 16
-	204,	// sample 17
-	211,	// sample 18
-	213,	// sample 19
-	204,	// sample 20
-	193,	// sample 21
-	183,	// sample 22
-	181,	// sample 23
-	181,	// sample 24
-	184,	// sample 25
-	189,	// sample 26
-	195,	// sample 27
-	199,	// sample 28
-	202,	// sample 29
-	199,	// sample 30
-	194,	// sample 31
-	191,	// sample 32
-	186,	// sample 33
-	181,	// sample 34
-	176,	// sample 35
-	174,	// sample 36
-	181,	// sample 37
-	192,	// sample 38
-	201,	// sample 39
-	211,	// sample 40
-	212,	// sample 41
-	216,	// sample 42
-	216,	// sample 43
-	216,	// sample 44
-	211,	// sample 45
-	206,	// sample 46
-	202,	// sample 47
-	194,	// sample 48
-	188,	// sample 49
-	177,	// sample 50
-	166,	// sample 51
-	154,	// sample 52
-	145,	// sample 53
-	139,	// sample 54
-	132,	// sample 55
-	126,	// sample 56
-	125,	// sample 57
-	127,	// sample 58
-	128,	// sample 59
-	127,	// sample 60
-	124,	// sample 61
-	124,	// sample 62
-	124,	// sample 63
-	130,	// -------- wave 174 (aeh), sample 00
-	193,	// sample 01
-	231,	// sample 02
-	245,	// sample 03
-	245,	// sample 04
-	236,	// sample 05
-	233,	// sample 06
-	227,	// sample 07
-	226,	// sample 08
-	219,	// sample 09
-	215,	// sample 10
-	215,	// sample 11
-	208,	// sample 12
-	202,	// sample 13
-	200,	// sample 14
-	198,	// sample 15
-	203,	// sample 16
-	203,	// sample 17
-	193,	// sample 18
-	176,	// sample 19
-	162,	// sample 20
-	156,	// sample 21
-	157,	// sample 22
-	160,	// sample 23
-	159,	// sample 24
-	155,	// sample 25
-	148,	// sample 26
-	142,	// sample 27
-	135,	// sample 28
-	124,	// sample 29
-	113,	// sample 30
-	100,	// sample 31
-	 96,	// sample 32
-	 98,	// sample 33
-	103,	// sample 34
-	106,	// sample 35
-	107,	// sample 36
-	107,	// sample 37
-	110,	// sample 38
-	112,	// sample 39
-	111,	// sample 40
-	106,	// sample 41
-	104,	// sample 42
-	102,	// sample 43
-	100,	// sample 44
-	100,	// sample 45
-	 96,	// sample 46
-	 95,	// sample 47
-	 93,	// sample 48
-	 97,	// sample 49
-	 97,	// sample 50
-	 99,	// sample 51
-	102,	// sample 52
-	110,	// sample 53
-	116,	// sample 54
-	124,	// sample 55
-	128,	// sample 56
-	127,	// sample 57
-	126,	// sample 58
-	127,	// sample 59
-	126,	// sample 60
-	126,	// sample 61
-	130,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 175 (afh), sample 00
-	193,	// sample 01
-	231,	// sample 02
-	245,	// sample 03
-	245,	// sample 04
-	236,	// sample 05
-	233,	// sample 06
-	227,	// sample 07
-	226,	// sample 08
-	219,	// sample 09
-	215,	// sample 10
-	215,	// sample 11
-	208,	// sample 12
-	202,	// sample 13
-	200,	// sample 14
-	198,	// sample 15
-	203,	// sample 16
-	203,	// sample 17
-	193,	// sample 18
-	176,	// sample 19
-	162,	// sample 20
-	156,	// sample 21
-	157,	// sample 22
-	160,	// sample 23
-	159,	// sample 24
-	155,	// sample 25
-	148,	// sample 26
-	142,	// sample 27
-	135,	// sample 28
-	124,	// sample 29
-	113,	// sample 30
-	100,	// sample 31
-	 96,	// sample 32
-	 98,	// sample 33
-	103,	// sample 34
-	106,	// sample 35
-	107,	// sample 36
-	107,	// sample 37
-	110,	// sample 38
-	112,	// sample 39
-	111,	// sample 40
-	106,	// sample 41
-	104,	// sample 42
-	102,	// sample 43
-	100,	// sample 44
-	100,	// sample 45
-	 96,	// sample 46
-	 95,	// sample 47
-	 93,	// sample 48
-	 97,	// sample 49
-	 97,	// sample 50
-	 99,	// sample 51
-	102,	// sample 52
-	110,	// sample 53
-	116,	// sample 54
-	124,	// sample 55
-	128,	// sample 56
-	127,	// sample 57
-	126,	// sample 58
-	127,	// sample 59
-	126,	// sample 60
-	126,	// sample 61
-	130,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 176 (b0h), sample 00
-	193,	// sample 01
-	231,	// sample 02
-	245,	// sample 03
-	245,	// sample 04
-	236,	// sample 05
-	233,	// sample 06
-	227,	// sample 07
-	226,	// sample 08
-	219,	// sample 09
-	215,	// sample 10
-	215,	// sample 11
-	208,	// sample 12
-	202,	// sample 13
-	200,	// sample 14
-	198,	// sample 15
-	203,	// sample 16
-	203,	// sample 17
-	193,	// sample 18
-	176,	// sample 19
-	162,	// sample 20
-	156,	// sample 21
-	157,	// sample 22
-	160,	// sample 23
-	159,	// sample 24
-	155,	// sample 25
-	148,	// sample 26
-	142,	// sample 27
-	135,	// sample 28
-	124,	// sample 29
-	113,	// sample 30
-	100,	// sample 31
-	 96,	// sample 32
-	 98,	// sample 33
-	103,	// sample 34
-	106,	// sample 35
-	107,	// sample 36
-	107,	// sample 37
-	110,	// sample 38
-	112,	// sample 39
-	111,	// sample 40
-	106,	// sample 41
-	104,	// sample 42
-	102,	// sample 43
-	100,	// sample 44
-	100,	// sample 45
-	 96,	// sample 46
-	 95,	// sample 47
-	 93,	// sample 48
-	 97,	// sample 49
-	 97,	// sample 50
-	 99,	// sample 51
-	102,	// sample 52
-	110,	// sample 53
-	116,	// sample 54
-	124,	// sample 55
-	128,	// sample 56
-	127,	// sample 57
-	126,	// sample 58
-	127,	// sample 59
-	126,	// sample 60
-	126,	// sample 61
-	130,	// sample 62
-	130,	// sample 63
-	132,	// -------- wave 177 (b1h), sample 00
-	150,	// sample 01
-	166,	// sample 02
-	182,	// sample 03
-	197,	// sample 04
-	211,	// sample 05
-	223,	// sample 06
-	232,	// sample 07
-	241,	// sample 08
-	248,	// sample 09
-	253,	// sample 10
-	  2,	// sample 11
-	  2,	// sample 12
-	252,	// sample 13
-	249,	// sample 14
-	245,	// sample 15
-	238,	// sample 16
-	230,	// sample 17
-	223,	// sample 18
-	215,	// sample 19
-	206,	// sample 20
-	198,	// sample 21
-	189,	// sample 22
-	182,	// sample 23
-	173,	// sample 24
-	168,	// sample 25
-	162,	// sample 26
-	159,	// sample 27
-	156,	// sample 28
-	153,	// sample 29
-	153,	// sample 30
-	152,	// sample 31
-	152,	// sample 32
-	153,	// sample 33
-	153,	// sample 34
-	155,	// sample 35
-	156,	// sample 36
-	157,	// sample 37
-	159,	// sample 38
-	158,	// sample 39
-	160,	// sample 40
-	160,	// sample 41
-	160,	// sample 42
-	157,	// sample 43
-	156,	// sample 44
-	153,	// sample 45
-	151,	// sample 46
-	147,	// sample 47
-	143,	// sample 48
-	141,	// sample 49
-	137,	// sample 50
-	133,	// sample 51
-	130,	// sample 52
-	127,	// sample 53
-	124,	// sample 54
-	122,	// sample 55
-	121,	// sample 56
-	120,	// sample 57
-	120,	// sample 58
-	121,	// sample 59
-	121,	// sample 60
-	122,	// sample 61
-	124,	// sample 62
-	126,	// sample 63
-	132,	// -------- wave 178 (b2h), sample 00
-	150,	// sample 01
-	164,	// sample 02
-	180,	// sample 03
-	194,	// sample 04
-	209,	// sample 05
-	220,	// sample 06
-	229,	// sample 07
-	237,	// sample 08
-	243,	// sample 09
-	248,	// sample 10
-	250,	// sample 11
-	249,	// sample 12
-	248,	// sample 13
-	244,	// sample 14
-	240,	// sample 15
-	233,	// sample 16
-	225,	// sample 17
-	220,	// sample 18
-	211,	// sample 19
-	203,	// sample 20
-	195,	// sample 21
-	185,	// sample 22
-	180,	// sample 23
-	172,	// sample 24
-	166,	// sample 25
-	160,	// sample 26
-	157,	// sample 27
-	155,	// sample 28
-	152,	// sample 29
-	153,	// sample 30
-	152,	// sample 31
-	152,	// sample 32
-	153,	// sample 33
-	153,	// sample 34
-	156,	// sample 35
-	157,	// sample 36
-	157,	// sample 37
-	160,	// sample 38
-	159,	// sample 39
-	160,	// sample 40
-	159,	// sample 41
-	160,	// sample 42
-	157,	// sample 43
-	157,	// sample 44
-	154,	// sample 45
-	150,	// sample 46
-	146,	// sample 47
-	143,	// sample 48
-	139,	// sample 49
-	135,	// sample 50
-	132,	// sample 51
-	128,	// sample 52
-	126,	// sample 53
-	124,	// sample 54
-	122,	// sample 55
-	119,	// sample 56
-	120,	// sample 57
-	119,	// sample 58
-	120,	// sample 59
-	120,	// sample 60
-	122,	// sample 61
-	124,	// sample 62
-	126,	// sample 63
-	132,	// -------- wave 179 (b3h), sample 00
-	153,	// sample 01
-	172,	// sample 02
-	191,	// sample 03
-	209,	// sample 04
-	223,	// sample 05
-	234,	// sample 06
-	243,	// sample 07
-	250,	// sample 08
-	253,	// sample 09
-	  2,	// sample 10
-	251,	// sample 11
-	246,	// sample 12
-	240,	// sample 13
-	231,	// sample 14
-	222,	// sample 15
-	214,	// sample 16
-	203,	// sample 17
-	194,	// sample 18
-	185,	// sample 19
-	177,	// sample 20
-	171,	// sample 21
-	166,	// sample 22
-	164,	// sample 23
-	161,	// sample 24
-	161,	// sample 25
-	160,	// sample 26
-	162,	// sample 27
-	163,	// sample 28
-	165,	// sample 29
-	168,	// sample 30
-	169,	// sample 31
-	171,	// sample 32
-	172,	// sample 33
-	170,	// sample 34
-	170,	// sample 35
-	168,	// sample 36
-	163,	// sample 37
-	161,	// sample 38
-	158,	// sample 39
-	154,	// sample 40
-	149,	// sample 41
-	146,	// sample 42
-	141,	// sample 43
-	138,	// sample 44
-	135,	// sample 45
-	133,	// sample 46
-	130,	// sample 47
-	130,	// sample 48
-	130,	// sample 49
-	131,	// sample 50
-	132,	// sample 51
-	133,	// sample 52
-	136,	// sample 53
-	137,	// sample 54
-	139,	// sample 55
-	137,	// sample 56
-	139,	// sample 57
-	139,	// sample 58
-	137,	// sample 59
-	136,	// sample 60
-	135,	// sample 61
-	133,	// sample 62
-	130,	// sample 63
-	132,	// -------- wave 180 (b4h), sample 00
-	156,	// sample 01
-	179,	// sample 02
-	199,	// sample 03
-	217,	// sample 04
-	231,	// sample 05
-	240,	// sample 06
-	246,	// sample 07
-	247,	// sample 08
-	245,	// sample 09
-	241,	// sample 10
-	234,	// sample 11
-	223,	// sample 12
-	212,	// sample 13
-	202,	// sample 14
-	191,	// sample 15
-	182,	// sample 16
-	173,	// sample 17
-	167,	// sample 18
-	163,	// sample 19
-	162,	// sample 20
-	162,	// sample 21
-	162,	// sample 22
-	167,	// sample 23
-	168,	// sample 24
-	172,	// sample 25
-	175,	// sample 26
-	178,	// sample 27
-	178,	// sample 28
-	178,	// sample 29
-	177,	// sample 30
-	174,	// sample 31
-	171,	// sample 32
-	166,	// sample 33
-	160,	// sample 34
-	157,	// sample 35
-	153,	// sample 36
-	147,	// sample 37
-	143,	// sample 38
-	141,	// sample 39
-	141,	// sample 40
-	140,	// sample 41
-	141,	// sample 42
-	142,	// sample 43
-	143,	// sample 44
-	146,	// sample 45
-	146,	// sample 46
-	146,	// sample 47
-	145,	// sample 48
-	146,	// sample 49
-	143,	// sample 50
-	141,	// sample 51
-	137,	// sample 52
-	135,	// sample 53
-	131,	// sample 54
-	127,	// sample 55
-	123,	// sample 56
-	122,	// sample 57
-	120,	// sample 58
-	120,	// sample 59
-	120,	// sample 60
-	121,	// sample 61
-	121,	// sample 62
-	124,	// sample 63
-	132,	// -------- wave 181 (b5h), sample 00
-	158,	// sample 01
-	180,	// sample 02
-	202,	// sample 03
-	220,	// sample 04
-	234,	// sample 05
-	245,	// sample 06
-	252,	// sample 07
-	253,	// sample 08
-	252,	// sample 09
-	248,	// sample 10
-	241,	// sample 11
-	230,	// sample 12
-	219,	// sample 13
-	208,	// sample 14
-	197,	// sample 15
-	187,	// sample 16
-	179,	// sample 17
-	171,	// sample 18
-	168,	// sample 19
-	166,	// sample 20
-	165,	// sample 21
-	166,	// sample 22
-	169,	// sample 23
-	170,	// sample 24
-	173,	// sample 25
-	176,	// sample 26
-	177,	// sample 27
-	178,	// sample 28
-	177,	// sample 29
-	176,	// sample 30
-	172,	// sample 31
-	169,	// sample 32
-	163,	// sample 33
-	160,	// sample 34
-	154,	// sample 35
-	149,	// sample 36
-	145,	// sample 37
-	142,	// sample 38
-	139,	// sample 39
-	140,	// sample 40
-	139,	// sample 41
-	140,	// sample 42
-	142,	// sample 43
-	144,	// sample 44
-	146,	// sample 45
-	148,	// sample 46
-	147,	// sample 47
-	147,	// sample 48
-	148,	// sample 49
-	146,	// sample 50
-	144,	// sample 51
-	141,	// sample 52
-	138,	// sample 53
-	134,	// sample 54
-	131,	// sample 55
-	126,	// sample 56
-	125,	// sample 57
-	122,	// sample 58
-	121,	// sample 59
-	122,	// sample 60
-	122,	// sample 61
-	122,	// sample 62
-	125,	// sample 63
-	132,	// -------- wave 182 (b6h), sample 00
-	161,	// sample 01
-	189,	// sample 02
-	214,	// sample 03
-	232,	// sample 04
-	247,	// sample 05
-	  2,	// sample 06
-	  6,	// sample 07
-	  2,	// sample 08
-	246,	// sample 09
-	237,	// sample 10
-	224,	// sample 11
-	211,	// sample 12
-	198,	// sample 13
-	187,	// sample 14
-	177,	// sample 15
-	170,	// sample 16
-	167,	// sample 17
-	165,	// sample 18
-	165,	// sample 19
-	169,	// sample 20
-	173,	// sample 21
-	176,	// sample 22
-	180,	// sample 23
-	181,	// sample 24
-	181,	// sample 25
-	179,	// sample 26
-	177,	// sample 27
-	171,	// sample 28
-	166,	// sample 29
-	161,	// sample 30
-	156,	// sample 31
-	152,	// sample 32
-	148,	// sample 33
-	145,	// sample 34
-	145,	// sample 35
-	146,	// sample 36
-	146,	// sample 37
-	148,	// sample 38
-	150,	// sample 39
-	154,	// sample 40
-	154,	// sample 41
-	154,	// sample 42
-	153,	// sample 43
-	151,	// sample 44
-	148,	// sample 45
-	144,	// sample 46
-	138,	// sample 47
-	135,	// sample 48
-	132,	// sample 49
-	128,	// sample 50
-	127,	// sample 51
-	124,	// sample 52
-	127,	// sample 53
-	128,	// sample 54
-	129,	// sample 55
-	131,	// sample 56
-	134,	// sample 57
-	135,	// sample 58
-	136,	// sample 59
-	137,	// sample 60
-	134,	// sample 61
-	132,	// sample 62
-	129,	// sample 63
-	132,	// -------- wave 183 (b7h), sample 00
-	166,	// sample 01
-	196,	// sample 02
-	223,	// sample 03
-	242,	// sample 04
-	  2,	// sample 05
-	  5,	// sample 06
-	  4,	// sample 07
-	246,	// sample 08
-	233,	// sample 09
-	221,	// sample 10
-	205,	// sample 11
-	191,	// sample 12
-	180,	// sample 13
-	172,	// sample 14
-	170,	// sample 15
-	168,	// sample 16
-	171,	// sample 17
-	175,	// sample 18
-	179,	// sample 19
-	184,	// sample 20
-	188,	// sample 21
-	189,	// sample 22
-	188,	// sample 23
-	182,	// sample 24
-	177,	// sample 25
-	170,	// sample 26
-	164,	// sample 27
-	159,	// sample 28
-	155,	// sample 29
-	153,	// sample 30
-	150,	// sample 31
-	152,	// sample 32
-	154,	// sample 33
-	156,	// sample 34
-	158,	// sample 35
-	160,	// sample 36
-	160,	// sample 37
-	159,	// sample 38
-	155,	// sample 39
-	155,	// sample 40
-	149,	// sample 41
-	146,	// sample 42
-	142,	// sample 43
-	138,	// sample 44
-	138,	// sample 45
-	136,	// sample 46
-	136,	// sample 47
-	137,	// sample 48
-	140,	// sample 49
-	139,	// sample 50
-	141,	// sample 51
-	139,	// sample 52
-	141,	// sample 53
-	138,	// sample 54
-	135,	// sample 55
-	132,	// sample 56
-	127,	// sample 57
-	124,	// sample 58
-	123,	// sample 59
-	123,	// sample 60
-	122,	// sample 61
-	121,	// sample 62
-	125,	// sample 63
-	131,	// -------- wave 184 (b8h), sample 00
-	170,	// sample 01
-	204,	// sample 02
-	232,	// sample 03
-	252,	// sample 04
-	 10,	// sample 05
-	  8,	// sample 06
-	  2,	// sample 07
-	239,	// sample 08
-	223,	// sample 09
-	207,	// sample 10
-	190,	// sample 11
-	179,	// sample 12
-	172,	// sample 13
-	169,	// sample 14
-	171,	// sample 15
-	177,	// sample 16
-	181,	// sample 17
-	186,	// sample 18
-	190,	// sample 19
-	191,	// sample 20
-	189,	// sample 21
-	185,	// sample 22
-	179,	// sample 23
-	172,	// sample 24
-	166,	// sample 25
-	160,	// sample 26
-	158,	// sample 27
-	156,	// sample 28
-	157,	// sample 29
-	160,	// sample 30
-	160,	// sample 31
-	160,	// sample 32
-	161,	// sample 33
-	160,	// sample 34
-	157,	// sample 35
-	153,	// sample 36
-	150,	// sample 37
-	145,	// sample 38
-	141,	// sample 39
-	140,	// sample 40
-	137,	// sample 41
-	139,	// sample 42
-	141,	// sample 43
-	143,	// sample 44
-	145,	// sample 45
-	145,	// sample 46
-	145,	// sample 47
-	144,	// sample 48
-	144,	// sample 49
-	138,	// sample 50
-	136,	// sample 51
-	130,	// sample 52
-	129,	// sample 53
-	129,	// sample 54
-	127,	// sample 55
-	129,	// sample 56
-	130,	// sample 57
-	132,	// sample 58
-	135,	// sample 59
-	136,	// sample 60
-	134,	// sample 61
-	131,	// sample 62
-	131,	// sample 63
-	131,	// -------- wave 185 (b9h), sample 00
-	175,	// sample 01
-	211,	// sample 02
-	236,	// sample 03
-	250,	// sample 04
-	  2,	// sample 05
-	246,	// sample 06
-	230,	// sample 07
-	211,	// sample 08
-	196,	// sample 09
-	183,	// sample 10
-	173,	// sample 11
-	172,	// sample 12
-	173,	// sample 13
-	178,	// sample 14
-	182,	// sample 15
-	185,	// sample 16
-	188,	// sample 17
-	186,	// sample 18
-	181,	// sample 19
-	177,	// sample 20
-	171,	// sample 21
-	166,	// sample 22
-	164,	// sample 23
-	165,	// sample 24
-	165,	// sample 25
-	165,	// sample 26
-	166,	// sample 27
-	165,	// sample 28
-	161,	// sample 29
-	159,	// sample 30
-	154,	// sample 31
-	151,	// sample 32
-	147,	// sample 33
-	149,	// sample 34
-	151,	// sample 35
-	150,	// sample 36
-	152,	// sample 37
-	153,	// sample 38
-	152,	// sample 39
-	153,	// sample 40
-	151,	// sample 41
-	147,	// sample 42
-	143,	// sample 43
-	140,	// sample 44
-	139,	// sample 45
-	138,	// sample 46
-	138,	// sample 47
-	140,	// sample 48
-	139,	// sample 49
-	139,	// sample 50
-	137,	// sample 51
-	135,	// sample 52
-	133,	// sample 53
-	130,	// sample 54
-	128,	// sample 55
-	126,	// sample 56
-	128,	// sample 57
-	129,	// sample 58
-	131,	// sample 59
-	131,	// sample 60
-	131,	// sample 61
-	130,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 186 (bah), sample 00
-	178,	// sample 01
-	217,	// sample 02
-	241,	// sample 03
-	252,	// sample 04
-	252,	// sample 05
-	238,	// sample 06
-	220,	// sample 07
-	199,	// sample 08
-	185,	// sample 09
-	174,	// sample 10
-	170,	// sample 11
-	173,	// sample 12
-	175,	// sample 13
-	180,	// sample 14
-	182,	// sample 15
-	182,	// sample 16
-	181,	// sample 17
-	176,	// sample 18
-	173,	// sample 19
-	170,	// sample 20
-	168,	// sample 21
-	171,	// sample 22
-	171,	// sample 23
-	173,	// sample 24
-	173,	// sample 25
-	170,	// sample 26
-	166,	// sample 27
-	162,	// sample 28
-	156,	// sample 29
-	155,	// sample 30
-	152,	// sample 31
-	153,	// sample 32
-	153,	// sample 33
-	158,	// sample 34
-	159,	// sample 35
-	156,	// sample 36
-	154,	// sample 37
-	150,	// sample 38
-	146,	// sample 39
-	145,	// sample 40
-	144,	// sample 41
-	143,	// sample 42
-	146,	// sample 43
-	145,	// sample 44
-	147,	// sample 45
-	145,	// sample 46
-	143,	// sample 47
-	140,	// sample 48
-	135,	// sample 49
-	131,	// sample 50
-	132,	// sample 51
-	131,	// sample 52
-	132,	// sample 53
-	135,	// sample 54
-	136,	// sample 55
-	135,	// sample 56
-	135,	// sample 57
-	134,	// sample 58
-	131,	// sample 59
-	126,	// sample 60
-	125,	// sample 61
-	124,	// sample 62
-	125,	// sample 63
-	130,	// -------- wave 187 (bbh), sample 00
-	181,	// sample 01
-	223,	// sample 02
-	249,	// sample 03
-	  3,	// sample 04
-	250,	// sample 05
-	234,	// sample 06
-	215,	// sample 07
-	195,	// sample 08
-	182,	// sample 09
-	176,	// sample 10
-	178,	// sample 11
-	184,	// sample 12
-	185,	// sample 13
-	189,	// sample 14
-	187,	// sample 15
-	185,	// sample 16
-	179,	// sample 17
-	174,	// sample 18
-	172,	// sample 19
-	168,	// sample 20
-	172,	// sample 21
-	172,	// sample 22
-	173,	// sample 23
-	171,	// sample 24
-	168,	// sample 25
-	162,	// sample 26
-	158,	// sample 27
-	155,	// sample 28
-	156,	// sample 29
-	158,	// sample 30
-	158,	// sample 31
-	160,	// sample 32
-	160,	// sample 33
-	160,	// sample 34
-	158,	// sample 35
-	152,	// sample 36
-	148,	// sample 37
-	146,	// sample 38
-	143,	// sample 39
-	145,	// sample 40
-	147,	// sample 41
-	147,	// sample 42
-	146,	// sample 43
-	144,	// sample 44
-	141,	// sample 45
-	138,	// sample 46
-	135,	// sample 47
-	133,	// sample 48
-	135,	// sample 49
-	136,	// sample 50
-	135,	// sample 51
-	137,	// sample 52
-	137,	// sample 53
-	134,	// sample 54
-	131,	// sample 55
-	131,	// sample 56
-	128,	// sample 57
-	129,	// sample 58
-	129,	// sample 59
-	129,	// sample 60
-	130,	// sample 61
-	130,	// sample 62
-	131,	// sample 63
-	130,	// -------- wave 188 (bch), sample 00
-	188,	// sample 01
-	228,	// sample 02
-	252,	// sample 03
-	253,	// sample 04
-	241,	// sample 05
-	220,	// sample 06
-	200,	// sample 07
-	185,	// sample 08
-	178,	// sample 09
-	179,	// sample 10
-	185,	// sample 11
-	188,	// sample 12
-	186,	// sample 13
-	185,	// sample 14
-	179,	// sample 15
-	175,	// sample 16
-	175,	// sample 17
-	175,	// sample 18
-	180,	// sample 19
-	178,	// sample 20
-	178,	// sample 21
-	175,	// sample 22
-	169,	// sample 23
-	165,	// sample 24
-	161,	// sample 25
-	161,	// sample 26
-	160,	// sample 27
-	161,	// sample 28
-	162,	// sample 29
-	163,	// sample 30
-	158,	// sample 31
-	154,	// sample 32
-	153,	// sample 33
-	151,	// sample 34
-	153,	// sample 35
-	150,	// sample 36
-	151,	// sample 37
-	150,	// sample 38
-	146,	// sample 39
-	145,	// sample 40
-	143,	// sample 41
-	145,	// sample 42
-	145,	// sample 43
-	146,	// sample 44
-	147,	// sample 45
-	146,	// sample 46
-	145,	// sample 47
-	140,	// sample 48
-	139,	// sample 49
-	136,	// sample 50
-	133,	// sample 51
-	136,	// sample 52
-	137,	// sample 53
-	135,	// sample 54
-	134,	// sample 55
-	134,	// sample 56
-	132,	// sample 57
-	133,	// sample 58
-	131,	// sample 59
-	128,	// sample 60
-	130,	// sample 61
-	129,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 189 (bdh), sample 00
-	194,	// sample 01
-	239,	// sample 02
-	  4,	// sample 03
-	246,	// sample 04
-	225,	// sample 05
-	201,	// sample 06
-	187,	// sample 07
-	181,	// sample 08
-	186,	// sample 09
-	189,	// sample 10
-	190,	// sample 11
-	183,	// sample 12
-	174,	// sample 13
-	171,	// sample 14
-	170,	// sample 15
-	173,	// sample 16
-	178,	// sample 17
-	180,	// sample 18
-	177,	// sample 19
-	169,	// sample 20
-	162,	// sample 21
-	160,	// sample 22
-	163,	// sample 23
-	167,	// sample 24
-	168,	// sample 25
-	170,	// sample 26
-	164,	// sample 27
-	157,	// sample 28
-	156,	// sample 29
-	154,	// sample 30
-	157,	// sample 31
-	157,	// sample 32
-	160,	// sample 33
-	156,	// sample 34
-	154,	// sample 35
-	149,	// sample 36
-	147,	// sample 37
-	149,	// sample 38
-	149,	// sample 39
-	150,	// sample 40
-	149,	// sample 41
-	146,	// sample 42
-	142,	// sample 43
-	141,	// sample 44
-	141,	// sample 45
-	143,	// sample 46
-	145,	// sample 47
-	144,	// sample 48
-	140,	// sample 49
-	137,	// sample 50
-	132,	// sample 51
-	136,	// sample 52
-	137,	// sample 53
-	137,	// sample 54
-	136,	// sample 55
-	137,	// sample 56
-	130,	// sample 57
-	127,	// sample 58
-	125,	// sample 59
-	123,	// sample 60
-	129,	// sample 61
-	129,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 190 (beh), sample 00
-	194,	// sample 01
-	235,	// sample 02
-	251,	// sample 03
-	242,	// sample 04
-	223,	// sample 05
-	200,	// sample 06
-	187,	// sample 07
-	183,	// sample 08
-	184,	// sample 09
-	183,	// sample 10
-	186,	// sample 11
-	179,	// sample 12
-	175,	// sample 13
-	177,	// sample 14
-	179,	// sample 15
-	179,	// sample 16
-	180,	// sample 17
-	177,	// sample 18
-	172,	// sample 19
-	170,	// sample 20
-	168,	// sample 21
-	168,	// sample 22
-	167,	// sample 23
-	167,	// sample 24
-	162,	// sample 25
-	161,	// sample 26
-	158,	// sample 27
-	156,	// sample 28
-	158,	// sample 29
-	157,	// sample 30
-	155,	// sample 31
-	154,	// sample 32
-	155,	// sample 33
-	153,	// sample 34
-	153,	// sample 35
-	152,	// sample 36
-	150,	// sample 37
-	152,	// sample 38
-	150,	// sample 39
-	149,	// sample 40
-	149,	// sample 41
-	148,	// sample 42
-	146,	// sample 43
-	145,	// sample 44
-	141,	// sample 45
-	141,	// sample 46
-	142,	// sample 47
-	143,	// sample 48
-	141,	// sample 49
-	136,	// sample 50
-	134,	// sample 51
-	135,	// sample 52
-	134,	// sample 53
-	133,	// sample 54
-	134,	// sample 55
-	138,	// sample 56
-	132,	// sample 57
-	129,	// sample 58
-	128,	// sample 59
-	123,	// sample 60
-	126,	// sample 61
-	127,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 191 (bfh), sample 00
-	211,	// sample 01
-	  4,	// sample 02
-	252,	// sample 03
-	223,	// sample 04
-	194,	// sample 05
-	183,	// sample 06
-	192,	// sample 07
-	197,	// sample 08
-	194,	// sample 09
-	179,	// sample 10
-	172,	// sample 11
-	168,	// sample 12
-	176,	// sample 13
-	181,	// sample 14
-	180,	// sample 15
-	174,	// sample 16
-	172,	// sample 17
-	175,	// sample 18
-	176,	// sample 19
-	175,	// sample 20
-	169,	// sample 21
-	164,	// sample 22
-	168,	// sample 23
-	172,	// sample 24
-	169,	// sample 25
-	170,	// sample 26
-	161,	// sample 27
-	157,	// sample 28
-	159,	// sample 29
-	159,	// sample 30
-	160,	// sample 31
-	156,	// sample 32
-	152,	// sample 33
-	149,	// sample 34
-	153,	// sample 35
-	157,	// sample 36
-	155,	// sample 37
-	154,	// sample 38
-	140,	// sample 39
-	141,	// sample 40
-	146,	// sample 41
-	150,	// sample 42
-	150,	// sample 43
-	146,	// sample 44
-	139,	// sample 45
-	141,	// sample 46
-	142,	// sample 47
-	145,	// sample 48
-	141,	// sample 49
-	137,	// sample 50
-	127,	// sample 51
-	130,	// sample 52
-	134,	// sample 53
-	136,	// sample 54
-	132,	// sample 55
-	133,	// sample 56
-	129,	// sample 57
-	131,	// sample 58
-	134,	// sample 59
-	132,	// sample 60
-	130,	// sample 61
-	125,	// sample 62
-	128,	// sample 63
-	130,	// -------- wave 192 (c0h), sample 00
-	200,	// sample 01
-	237,	// sample 02
-	242,	// sample 03
-	224,	// sample 04
-	208,	// sample 05
-	192,	// sample 06
-	189,	// sample 07
-	185,	// sample 08
-	179,	// sample 09
-	175,	// sample 10
-	181,	// sample 11
-	182,	// sample 12
-	180,	// sample 13
-	177,	// sample 14
-	172,	// sample 15
-	172,	// sample 16
-	175,	// sample 17
-	176,	// sample 18
-	173,	// sample 19
-	169,	// sample 20
-	166,	// sample 21
-	165,	// sample 22
-	166,	// sample 23
-	168,	// sample 24
-	163,	// sample 25
-	162,	// sample 26
-	160,	// sample 27
-	158,	// sample 28
-	160,	// sample 29
-	158,	// sample 30
-	157,	// sample 31
-	157,	// sample 32
-	159,	// sample 33
-	155,	// sample 34
-	151,	// sample 35
-	149,	// sample 36
-	144,	// sample 37
-	149,	// sample 38
-	145,	// sample 39
-	145,	// sample 40
-	142,	// sample 41
-	141,	// sample 42
-	142,	// sample 43
-	144,	// sample 44
-	140,	// sample 45
-	142,	// sample 46
-	143,	// sample 47
-	143,	// sample 48
-	140,	// sample 49
-	137,	// sample 50
-	133,	// sample 51
-	131,	// sample 52
-	130,	// sample 53
-	132,	// sample 54
-	132,	// sample 55
-	134,	// sample 56
-	130,	// sample 57
-	131,	// sample 58
-	131,	// sample 59
-	127,	// sample 60
-	128,	// sample 61
-	127,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 193 (c1h), sample 00
-	217,	// sample 01
-	  4,	// sample 02
-	245,	// sample 03
-	208,	// sample 04
-	178,	// sample 05
-	176,	// sample 06
-	193,	// sample 07
-	203,	// sample 08
-	197,	// sample 09
-	184,	// sample 10
-	172,	// sample 11
-	173,	// sample 12
-	179,	// sample 13
-	177,	// sample 14
-	175,	// sample 15
-	171,	// sample 16
-	173,	// sample 17
-	179,	// sample 18
-	181,	// sample 19
-	177,	// sample 20
-	168,	// sample 21
-	159,	// sample 22
-	161,	// sample 23
-	163,	// sample 24
-	165,	// sample 25
-	164,	// sample 26
-	163,	// sample 27
-	160,	// sample 28
-	157,	// sample 29
-	157,	// sample 30
-	156,	// sample 31
-	155,	// sample 32
-	156,	// sample 33
-	150,	// sample 34
-	152,	// sample 35
-	153,	// sample 36
-	149,	// sample 37
-	152,	// sample 38
-	143,	// sample 39
-	143,	// sample 40
-	143,	// sample 41
-	147,	// sample 42
-	146,	// sample 43
-	143,	// sample 44
-	137,	// sample 45
-	135,	// sample 46
-	134,	// sample 47
-	135,	// sample 48
-	136,	// sample 49
-	138,	// sample 50
-	131,	// sample 51
-	134,	// sample 52
-	137,	// sample 53
-	139,	// sample 54
-	134,	// sample 55
-	131,	// sample 56
-	129,	// sample 57
-	130,	// sample 58
-	132,	// sample 59
-	131,	// sample 60
-	128,	// sample 61
-	126,	// sample 62
-	127,	// sample 63
-	130,	// -------- wave 194 (c2h), sample 00
-	195,	// sample 01
-	227,	// sample 02
-	231,	// sample 03
-	213,	// sample 04
-	197,	// sample 05
-	184,	// sample 06
-	184,	// sample 07
-	185,	// sample 08
-	178,	// sample 09
-	177,	// sample 10
-	178,	// sample 11
-	181,	// sample 12
-	179,	// sample 13
-	176,	// sample 14
-	171,	// sample 15
-	171,	// sample 16
-	174,	// sample 17
-	177,	// sample 18
-	174,	// sample 19
-	172,	// sample 20
-	166,	// sample 21
-	165,	// sample 22
-	168,	// sample 23
-	167,	// sample 24
-	164,	// sample 25
-	160,	// sample 26
-	161,	// sample 27
-	159,	// sample 28
-	159,	// sample 29
-	160,	// sample 30
-	156,	// sample 31
-	155,	// sample 32
-	155,	// sample 33
-	151,	// sample 34
-	147,	// sample 35
-	145,	// sample 36
-	142,	// sample 37
-	150,	// sample 38
-	148,	// sample 39
-	150,	// sample 40
-	146,	// sample 41
-	147,	// sample 42
-	144,	// sample 43
-	145,	// sample 44
-	142,	// sample 45
-	142,	// sample 46
-	142,	// sample 47
-	140,	// sample 48
-	138,	// sample 49
-	138,	// sample 50
-	134,	// sample 51
-	134,	// sample 52
-	133,	// sample 53
-	134,	// sample 54
-	138,	// sample 55
-	135,	// sample 56
-	134,	// sample 57
-	135,	// sample 58
-	134,	// sample 59
-	131,	// sample 60
-	129,	// sample 61
-	129,	// sample 62
-	128,	// sample 63
-	130,	// -------- wave 195 (c3h), sample 00
-	208,	// sample 01
-	252,	// sample 02
-	  4,	// sample 03
-	233,	// sample 04
-	214,	// sample 05
-	199,	// sample 06
-	198,	// sample 07
-	194,	// sample 08
-	192,	// sample 09
-	190,	// sample 10
-	192,	// sample 11
-	191,	// sample 12
-	181,	// sample 13
-	177,	// sample 14
-	169,	// sample 15
-	170,	// sample 16
-	175,	// sample 17
-	180,	// sample 18
-	176,	// sample 19
-	169,	// sample 20
-	163,	// sample 21
-	163,	// sample 22
-	166,	// sample 23
-	165,	// sample 24
-	163,	// sample 25
-	163,	// sample 26
-	160,	// sample 27
-	154,	// sample 28
-	157,	// sample 29
-	154,	// sample 30
-	151,	// sample 31
-	150,	// sample 32
-	153,	// sample 33
-	148,	// sample 34
-	145,	// sample 35
-	142,	// sample 36
-	138,	// sample 37
-	143,	// sample 38
-	141,	// sample 39
-	143,	// sample 40
-	141,	// sample 41
-	138,	// sample 42
-	136,	// sample 43
-	137,	// sample 44
-	137,	// sample 45
-	141,	// sample 46
-	142,	// sample 47
-	141,	// sample 48
-	139,	// sample 49
-	133,	// sample 50
-	127,	// sample 51
-	128,	// sample 52
-	128,	// sample 53
-	131,	// sample 54
-	131,	// sample 55
-	135,	// sample 56
-	129,	// sample 57
-	130,	// sample 58
-	129,	// sample 59
-	126,	// sample 60
-	131,	// sample 61
-	129,	// sample 62
-	130,	// sample 63
-	130,	// -------- wave 196 (c4h), sample 00
-	189,	// sample 01
-	220,	// sample 02
-	223,	// sample 03
-	206,	// sample 04
-	193,	// sample 05
-	184,	// sample 06
-	185,	// sample 07
-	186,	// sample 08
-	177,	// sample 09
-	174,	// sample 10
-	174,	// sample 11
-	177,	// sample 12
-	173,	// sample 13
-	173,	// sample 14
-	168,	// sample 15
-	169,	// sample 16
-	172,	// sample 17
-	174,	// sample 18
-	167,	// sample 19
-	165,	// sample 20
-	160,	// sample 21
-	160,	// sample 22
-	165,	// sample 23
-	163,	// sample 24
-	163,	// sample 25
-	158,	// sample 26
-	160,	// sample 27
-	157,	// sample 28
-	155,	// sample 29
-	156,	// sample 30
-	152,	// sample 31
-	153,	// sample 32
-	155,	// sample 33
-	152,	// sample 34
-	151,	// sample 35
-	148,	// sample 36
-	140,	// sample 37
-	145,	// sample 38
-	142,	// sample 39
-	142,	// sample 40
-	138,	// sample 41
-	138,	// sample 42
-	137,	// sample 43
-	141,	// sample 44
-	140,	// sample 45
-	141,	// sample 46
-	140,	// sample 47
-	138,	// sample 48
-	138,	// sample 49
-	135,	// sample 50
-	133,	// sample 51
-	130,	// sample 52
-	130,	// sample 53
-	130,	// sample 54
-	133,	// sample 55
-	130,	// sample 56
-	129,	// sample 57
-	131,	// sample 58
-	130,	// sample 59
-	129,	// sample 60
-	128,	// sample 61
-	129,	// sample 62
-	128,	// sample 63
-	130,	// -------- wave 197 (c5h), sample 00
-	204,	// sample 01
-	252,	// sample 02
-	 13,	// sample 03
-	251,	// sample 04
-	233,	// sample 05
-	222,	// sample 06
-	215,	// sample 07
-	213,	// sample 08
-	211,	// sample 09
-	210,	// sample 10
-	208,	// sample 11
-	208,	// sample 12
-	203,	// sample 13
-	198,	// sample 14
-	196,	// sample 15
-	195,	// sample 16
-	196,	// sample 17
-	198,	// sample 18
-	191,	// sample 19
-	185,	// sample 20
-	182,	// sample 21
-	181,	// sample 22
-	185,	// sample 23
-	178,	// sample 24
-	178,	// sample 25
-	175,	// sample 26
-	174,	// sample 27
-	169,	// sample 28
-	169,	// sample 29
-	166,	// sample 30
-	164,	// sample 31
-	163,	// sample 32
-	161,	// sample 33
-	161,	// sample 34
-	158,	// sample 35
-	154,	// sample 36
-	155,	// sample 37
-	157,	// sample 38
-	155,	// sample 39
-	153,	// sample 40
-	147,	// sample 41
-	147,	// sample 42
-	145,	// sample 43
-	144,	// sample 44
-	141,	// sample 45
-	140,	// sample 46
-	138,	// sample 47
-	138,	// sample 48
-	136,	// sample 49
-	135,	// sample 50
-	129,	// sample 51
-	130,	// sample 52
-	133,	// sample 53
-	135,	// sample 54
-	133,	// sample 55
-	132,	// sample 56
-	132,	// sample 57
-	133,	// sample 58
-	131,	// sample 59
-	130,	// sample 60
-	131,	// sample 61
-	126,	// sample 62
-	127,	// sample 63
-	130,	// -------- wave 198 (c6h), sample 00
-	184,	// sample 01
-	212,	// sample 02
-	214,	// sample 03
-	196,	// sample 04
-	187,	// sample 05
-	182,	// sample 06
-	183,	// sample 07
-	180,	// sample 08
-	175,	// sample 09
-	170,	// sample 10
-	170,	// sample 11
-	174,	// sample 12
-	171,	// sample 13
-	172,	// sample 14
-	165,	// sample 15
-	166,	// sample 16
-	168,	// sample 17
-	170,	// sample 18
-	162,	// sample 19
-	162,	// sample 20
-	158,	// sample 21
-	159,	// sample 22
-	164,	// sample 23
-	161,	// sample 24
-	158,	// sample 25
-	153,	// sample 26
-	152,	// sample 27
-	146,	// sample 28
-	149,	// sample 29
-	149,	// sample 30
-	148,	// sample 31
-	149,	// sample 32
-	152,	// sample 33
-	150,	// sample 34
-	145,	// sample 35
-	144,	// sample 36
-	138,	// sample 37
-	144,	// sample 38
-	143,	// sample 39
-	146,	// sample 40
-	142,	// sample 41
-	141,	// sample 42
-	138,	// sample 43
-	138,	// sample 44
-	137,	// sample 45
-	137,	// sample 46
-	136,	// sample 47
-	137,	// sample 48
-	136,	// sample 49
-	133,	// sample 50
-	132,	// sample 51
-	129,	// sample 52
-	130,	// sample 53
-	131,	// sample 54
-	135,	// sample 55
-	132,	// sample 56
-	130,	// sample 57
-	131,	// sample 58
-	130,	// sample 59
-	123,	// sample 60
-	125,	// sample 61
-	123,	// sample 62
-	124,	// sample 63
-	130,	// -------- wave 199 (c7h), sample 00
-	198,	// sample 01
-	244,	// sample 02
-	  6,	// sample 03
-	250,	// sample 04
-	233,	// sample 05
-	223,	// sample 06
-	215,	// sample 07
-	209,	// sample 08
-	200,	// sample 09
-	195,	// sample 10
-	192,	// sample 11
-	196,	// sample 12
-	195,	// sample 13
-	195,	// sample 14
-	192,	// sample 15
-	190,	// sample 16
-	191,	// sample 17
-	193,	// sample 18
-	187,	// sample 19
-	182,	// sample 20
-	177,	// sample 21
-	180,	// sample 22
-	176,	// sample 23
-	171,	// sample 24
-	166,	// sample 25
-	162,	// sample 26
-	162,	// sample 27
-	159,	// sample 28
-	161,	// sample 29
-	160,	// sample 30
-	158,	// sample 31
-	157,	// sample 32
-	157,	// sample 33
-	153,	// sample 34
-	151,	// sample 35
-	148,	// sample 36
-	148,	// sample 37
-	153,	// sample 38
-	153,	// sample 39
-	150,	// sample 40
-	145,	// sample 41
-	144,	// sample 42
-	147,	// sample 43
-	144,	// sample 44
-	143,	// sample 45
-	141,	// sample 46
-	137,	// sample 47
-	139,	// sample 48
-	137,	// sample 49
-	139,	// sample 50
-	134,	// sample 51
-	132,	// sample 52
-	131,	// sample 53
-	133,	// sample 54
-	128,	// sample 55
-	125,	// sample 56
-	127,	// sample 57
-	127,	// sample 58
-	130,	// sample 59
-	129,	// sample 60
-	132,	// sample 61
-	125,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 200 (c8h), sample 00
-	177,	// sample 01
-	203,	// sample 02
-	205,	// sample 03
-	192,	// sample 04
-	185,	// sample 05
-	182,	// sample 06
-	184,	// sample 07
-	178,	// sample 08
-	170,	// sample 09
-	166,	// sample 10
-	166,	// sample 11
-	172,	// sample 12
-	171,	// sample 13
-	172,	// sample 14
-	164,	// sample 15
-	161,	// sample 16
-	162,	// sample 17
-	164,	// sample 18
-	160,	// sample 19
-	160,	// sample 20
-	159,	// sample 21
-	159,	// sample 22
-	162,	// sample 23
-	156,	// sample 24
-	153,	// sample 25
-	149,	// sample 26
-	150,	// sample 27
-	149,	// sample 28
-	154,	// sample 29
-	151,	// sample 30
-	146,	// sample 31
-	143,	// sample 32
-	141,	// sample 33
-	140,	// sample 34
-	136,	// sample 35
-	138,	// sample 36
-	133,	// sample 37
-	140,	// sample 38
-	138,	// sample 39
-	141,	// sample 40
-	137,	// sample 41
-	138,	// sample 42
-	136,	// sample 43
-	136,	// sample 44
-	135,	// sample 45
-	133,	// sample 46
-	133,	// sample 47
-	132,	// sample 48
-	132,	// sample 49
-	130,	// sample 50
-	130,	// sample 51
-	128,	// sample 52
-	130,	// sample 53
-	131,	// sample 54
-	133,	// sample 55
-	131,	// sample 56
-	129,	// sample 57
-	132,	// sample 58
-	131,	// sample 59
-	127,	// sample 60
-	130,	// sample 61
-	127,	// sample 62
-	126,	// sample 63
-	131,	// -------- wave 201 (c9h), sample 00
-	205,	// sample 01
-	245,	// sample 02
-	  9,	// sample 03
-	248,	// sample 04
-	230,	// sample 05
-	224,	// sample 06
-	221,	// sample 07
-	216,	// sample 08
-	204,	// sample 09
-	198,	// sample 10
-	194,	// sample 11
-	196,	// sample 12
-	194,	// sample 13
-	193,	// sample 14
-	192,	// sample 15
-	192,	// sample 16
-	191,	// sample 17
-	188,	// sample 18
-	183,	// sample 19
-	178,	// sample 20
-	178,	// sample 21
-	178,	// sample 22
-	178,	// sample 23
-	172,	// sample 24
-	169,	// sample 25
-	160,	// sample 26
-	162,	// sample 27
-	160,	// sample 28
-	160,	// sample 29
-	160,	// sample 30
-	156,	// sample 31
-	152,	// sample 32
-	151,	// sample 33
-	150,	// sample 34
-	145,	// sample 35
-	148,	// sample 36
-	143,	// sample 37
-	142,	// sample 38
-	142,	// sample 39
-	140,	// sample 40
-	140,	// sample 41
-	138,	// sample 42
-	141,	// sample 43
-	140,	// sample 44
-	140,	// sample 45
-	138,	// sample 46
-	138,	// sample 47
-	138,	// sample 48
-	139,	// sample 49
-	138,	// sample 50
-	133,	// sample 51
-	130,	// sample 52
-	130,	// sample 53
-	134,	// sample 54
-	133,	// sample 55
-	135,	// sample 56
-	130,	// sample 57
-	131,	// sample 58
-	126,	// sample 59
-	128,	// sample 60
-	126,	// sample 61
-	127,	// sample 62
-	126,	// sample 63
-	129,	// -------- wave 202 (cah), sample 00
-	176,	// sample 01
-	200,	// sample 02
-	202,	// sample 03
-	190,	// sample 04
-	182,	// sample 05
-	180,	// sample 06
-	183,	// sample 07
-	176,	// sample 08
-	168,	// sample 09
-	164,	// sample 10
-	163,	// sample 11
-	169,	// sample 12
-	167,	// sample 13
-	167,	// sample 14
-	159,	// sample 15
-	155,	// sample 16
-	156,	// sample 17
-	159,	// sample 18
-	155,	// sample 19
-	157,	// sample 20
-	155,	// sample 21
-	157,	// sample 22
-	159,	// sample 23
-	152,	// sample 24
-	148,	// sample 25
-	144,	// sample 26
-	146,	// sample 27
-	143,	// sample 28
-	147,	// sample 29
-	144,	// sample 30
-	140,	// sample 31
-	140,	// sample 32
-	139,	// sample 33
-	139,	// sample 34
-	135,	// sample 35
-	137,	// sample 36
-	131,	// sample 37
-	137,	// sample 38
-	135,	// sample 39
-	137,	// sample 40
-	133,	// sample 41
-	134,	// sample 42
-	134,	// sample 43
-	134,	// sample 44
-	135,	// sample 45
-	133,	// sample 46
-	134,	// sample 47
-	134,	// sample 48
-	134,	// sample 49
-	131,	// sample 50
-	130,	// sample 51
-	128,	// sample 52
-	127,	// sample 53
-	128,	// sample 54
-	131,	// sample 55
-	131,	// sample 56
-	128,	// sample 57
-	132,	// sample 58
-	131,	// sample 59
-	129,	// sample 60
-	132,	// sample 61
-	130,	// sample 62
-	128,	// sample 63
-	131,	// -------- wave 203 (cbh), sample 00
-	213,	// sample 01
-	253,	// sample 02
-	 10,	// sample 03
-	240,	// sample 04
-	218,	// sample 05
-	206,	// sample 06
-	202,	// sample 07
-	199,	// sample 08
-	189,	// sample 09
-	183,	// sample 10
-	181,	// sample 11
-	180,	// sample 12
-	180,	// sample 13
-	176,	// sample 14
-	172,	// sample 15
-	167,	// sample 16
-	168,	// sample 17
-	168,	// sample 18
-	167,	// sample 19
-	165,	// sample 20
-	163,	// sample 21
-	160,	// sample 22
-	160,	// sample 23
-	157,	// sample 24
-	154,	// sample 25
-	151,	// sample 26
-	155,	// sample 27
-	151,	// sample 28
-	151,	// sample 29
-	147,	// sample 30
-	144,	// sample 31
-	143,	// sample 32
-	145,	// sample 33
-	145,	// sample 34
-	143,	// sample 35
-	142,	// sample 36
-	140,	// sample 37
-	141,	// sample 38
-	143,	// sample 39
-	140,	// sample 40
-	138,	// sample 41
-	138,	// sample 42
-	139,	// sample 43
-	138,	// sample 44
-	138,	// sample 45
-	136,	// sample 46
-	136,	// sample 47
-	137,	// sample 48
-	139,	// sample 49
-	138,	// sample 50
-	136,	// sample 51
-	133,	// sample 52
-	128,	// sample 53
-	129,	// sample 54
-	128,	// sample 55
-	131,	// sample 56
-	129,	// sample 57
-	130,	// sample 58
-	129,	// sample 59
-	127,	// sample 60
-	127,	// sample 61
-	128,	// sample 62
-	126,	// sample 63
-	128,	// -------- wave 204 (cch), sample 00
-	170,	// sample 01
-	194,	// sample 02
-	194,	// sample 03
-	184,	// sample 04
-	177,	// sample 05
-	176,	// sample 06
-	180,	// sample 07
-	175,	// sample 08
-	165,	// sample 09
-	159,	// sample 10
-	156,	// sample 11
-	160,	// sample 12
-	162,	// sample 13
-	162,	// sample 14
-	157,	// sample 15
-	155,	// sample 16
-	155,	// sample 17
-	156,	// sample 18
-	150,	// sample 19
-	147,	// sample 20
-	145,	// sample 21
-	148,	// sample 22
-	151,	// sample 23
-	147,	// sample 24
-	145,	// sample 25
-	144,	// sample 26
-	145,	// sample 27
-	140,	// sample 28
-	145,	// sample 29
-	142,	// sample 30
-	138,	// sample 31
-	137,	// sample 32
-	140,	// sample 33
-	141,	// sample 34
-	136,	// sample 35
-	137,	// sample 36
-	133,	// sample 37
-	135,	// sample 38
-	131,	// sample 39
-	131,	// sample 40
-	128,	// sample 41
-	130,	// sample 42
-	131,	// sample 43
-	132,	// sample 44
-	133,	// sample 45
-	131,	// sample 46
-	134,	// sample 47
-	133,	// sample 48
-	131,	// sample 49
-	129,	// sample 50
-	128,	// sample 51
-	126,	// sample 52
-	128,	// sample 53
-	129,	// sample 54
-	129,	// sample 55
-	128,	// sample 56
-	125,	// sample 57
-	129,	// sample 58
-	128,	// sample 59
-	126,	// sample 60
-	130,	// sample 61
-	127,	// sample 62
-	127,	// sample 63
-	131,	// -------- wave 205 (cdh), sample 00
-	210,	// sample 01
-	  3,	// sample 02
-	 10,	// sample 03
-	241,	// sample 04
-	224,	// sample 05
-	217,	// sample 06
-	216,	// sample 07
-	212,	// sample 08
-	200,	// sample 09
-	190,	// sample 10
-	188,	// sample 11
-	189,	// sample 12
-	186,	// sample 13
-	182,	// sample 14
-	177,	// sample 15
-	175,	// sample 16
-	174,	// sample 17
-	171,	// sample 18
-	171,	// sample 19
-	163,	// sample 20
-	161,	// sample 21
-	160,	// sample 22
-	162,	// sample 23
-	164,	// sample 24
-	153,	// sample 25
-	152,	// sample 26
-	147,	// sample 27
-	146,	// sample 28
-	153,	// sample 29
-	153,	// sample 30
-	148,	// sample 31
-	144,	// sample 32
-	144,	// sample 33
-	143,	// sample 34
-	145,	// sample 35
-	142,	// sample 36
-	138,	// sample 37
-	135,	// sample 38
-	132,	// sample 39
-	132,	// sample 40
-	130,	// sample 41
-	135,	// sample 42
-	136,	// sample 43
-	136,	// sample 44
-	134,	// sample 45
-	137,	// sample 46
-	138,	// sample 47
-	141,	// sample 48
-	141,	// sample 49
-	133,	// sample 50
-	129,	// sample 51
-	129,	// sample 52
-	127,	// sample 53
-	129,	// sample 54
-	127,	// sample 55
-	127,	// sample 56
-	125,	// sample 57
-	126,	// sample 58
-	127,	// sample 59
-	127,	// sample 60
-	126,	// sample 61
-	126,	// sample 62
-	128,	// sample 63
-	128,	// -------- wave 206 (ceh), sample 00
-	170,	// sample 01
-	192,	// sample 02
-	191,	// sample 03
-	180,	// sample 04
-	173,	// sample 05
-	172,	// sample 06
-	175,	// sample 07
-	168,	// sample 08
-	159,	// sample 09
-	152,	// sample 10
-	149,	// sample 11
-	153,	// sample 12
-	154,	// sample 13
-	155,	// sample 14
-	149,	// sample 15
-	147,	// sample 16
-	147,	// sample 17
-	148,	// sample 18
-	143,	// sample 19
-	140,	// sample 20
-	139,	// sample 21
-	142,	// sample 22
-	145,	// sample 23
-	141,	// sample 24
-	140,	// sample 25
-	140,	// sample 26
-	141,	// sample 27
-	137,	// sample 28
-	141,	// sample 29
-	139,	// sample 30
-	135,	// sample 31
-	135,	// sample 32
-	138,	// sample 33
-	140,	// sample 34
-	134,	// sample 35
-	136,	// sample 36
-	132,	// sample 37
-	135,	// sample 38
-	130,	// sample 39
-	131,	// sample 40
-	129,	// sample 41
-	130,	// sample 42
-	131,	// sample 43
-	132,	// sample 44
-	133,	// sample 45
-	131,	// sample 46
-	134,	// sample 47
-	133,	// sample 48
-	132,	// sample 49
-	129,	// sample 50
-	127,	// sample 51
-	126,	// sample 52
-	127,	// sample 53
-	129,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	125,	// sample 57
-	128,	// sample 58
-	127,	// sample 59
-	125,	// sample 60
-	130,	// sample 61
-	128,	// sample 62
-	126,	// sample 63
-	130,	// -------- wave 207 (cfh), sample 00
-	212,	// sample 01
-	  4,	// sample 02
-	  2,	// sample 03
-	228,	// sample 04
-	216,	// sample 05
-	216,	// sample 06
-	220,	// sample 07
-	212,	// sample 08
-	190,	// sample 09
-	173,	// sample 10
-	172,	// sample 11
-	176,	// sample 12
-	178,	// sample 13
-	174,	// sample 14
-	167,	// sample 15
-	164,	// sample 16
-	167,	// sample 17
-	167,	// sample 18
-	164,	// sample 19
-	157,	// sample 20
-	151,	// sample 21
-	151,	// sample 22
-	158,	// sample 23
-	159,	// sample 24
-	150,	// sample 25
-	150,	// sample 26
-	147,	// sample 27
-	150,	// sample 28
-	150,	// sample 29
-	145,	// sample 30
-	142,	// sample 31
-	142,	// sample 32
-	147,	// sample 33
-	150,	// sample 34
-	148,	// sample 35
-	141,	// sample 36
-	138,	// sample 37
-	138,	// sample 38
-	133,	// sample 39
-	134,	// sample 40
-	128,	// sample 41
-	130,	// sample 42
-	133,	// sample 43
-	138,	// sample 44
-	139,	// sample 45
-	141,	// sample 46
-	135,	// sample 47
-	134,	// sample 48
-	138,	// sample 49
-	134,	// sample 50
-	127,	// sample 51
-	125,	// sample 52
-	124,	// sample 53
-	125,	// sample 54
-	126,	// sample 55
-	126,	// sample 56
-	122,	// sample 57
-	124,	// sample 58
-	126,	// sample 59
-	125,	// sample 60
-	125,	// sample 61
-	124,	// sample 62
-	129,	// sample 63
-	128,	// -------- wave 208 (d0h), sample 00
-	170,	// sample 01
-	192,	// sample 02
-	191,	// sample 03
-	180,	// sample 04
-	173,	// sample 05
-	172,	// sample 06
-	175,	// sample 07
-	168,	// sample 08
-	159,	// sample 09
-	152,	// sample 10
-	149,	// sample 11
-	153,	// sample 12
-	154,	// sample 13
-	155,	// sample 14
-	149,	// sample 15
-	147,	// sample 16
-	147,	// sample 17
-	148,	// sample 18
-	143,	// sample 19
-	140,	// sample 20
-	139,	// sample 21
-	142,	// sample 22
-	145,	// sample 23
-	141,	// sample 24
-	140,	// sample 25
-	140,	// sample 26
-	141,	// sample 27
-	137,	// sample 28
-	141,	// sample 29
-	139,	// sample 30
-	135,	// sample 31
-	135,	// sample 32
-	138,	// sample 33
-	140,	// sample 34
-	134,	// sample 35
-	136,	// sample 36
-	132,	// sample 37
-	135,	// sample 38
-	130,	// sample 39
-	131,	// sample 40
-	129,	// sample 41
-	130,	// sample 42
-	131,	// sample 43
-	132,	// sample 44
-	133,	// sample 45
-	131,	// sample 46
-	134,	// sample 47
-	133,	// sample 48
-	132,	// sample 49
-	129,	// sample 50
-	127,	// sample 51
-	126,	// sample 52
-	127,	// sample 53
-	129,	// sample 54
-	128,	// sample 55
-	128,	// sample 56
-	125,	// sample 57
-	128,	// sample 58
-	127,	// sample 59
-	125,	// sample 60
-	130,	// sample 61
-	128,	// sample 62
-	126,	// sample 63
-	131,	// -------- wave 209 (d1h), sample 00
-	139,	// sample 01
-	149,	// sample 02
-	158,	// sample 03
-	164,	// sample 04
-	173,	// sample 05
-	179,	// sample 06
-	186,	// sample 07
-	191,	// sample 08
-	195,	// sample 09
-	200,	// sample 10
-	203,	// sample 11
-	205,	// sample 12
-	207,	// sample 13
-	208,	// sample 14
-	208,	// sample 15
-	207,	// sample 16
-	204,	// sample 17
-	202,	// sample 18
-	199,	// sample 19
-	194,	// sample 20
-	191,	// sample 21
-	185,	// sample 22
-	180,	// sample 23
-	175,	// sample 24
-	168,	// sample 25
-	163,	// sample 26
-	159,	// sample 27
-	153,	// sample 28
-	149,	// sample 29
-	144,	// sample 30
-	139,	// sample 31
-	135,	// sample 32
-	132,	// sample 33
-	128,	// sample 34
-	126,	// sample 35
-	124,	// sample 36
-	122,	// sample 37
-	120,	// sample 38
-	120,	// sample 39
-	119,	// sample 40
-	120,	// sample 41
-	121,	// sample 42
-	122,	// sample 43
-	122,	// sample 44
-	124,	// sample 45
-	125,	// sample 46
-	126,	// sample 47
-	127,	// sample 48
-	130,	// sample 49
-	130,	// sample 50
-	131,	// sample 51
-	132,	// sample 52
-	133,	// sample 53
-	134,	// sample 54
-	134,	// sample 55
-	135,	// sample 56
-	134,	// sample 57
-	134,	// sample 58
-	133,	// sample 59
-	133,	// sample 60
-	131,	// sample 61
-	129,	// sample 62
-	129,	// sample 63
-	132,	// -------- wave 210 (d2h), sample 00
-	145,	// sample 01
-	157,	// sample 02
-	168,	// sample 03
-	178,	// sample 04
-	189,	// sample 05
-	198,	// sample 06
-	207,	// sample 07
-	215,	// sample 08
-	222,	// sample 09
-	226,	// sample 10
-	231,	// sample 11
-	234,	// sample 12
-	235,	// sample 13
-	235,	// sample 14
-	235,	// sample 15
-	233,	// sample 16
-	230,	// sample 17
-	226,	// sample 18
-	222,	// sample 19
-	217,	// sample 20
-	211,	// sample 21
-	205,	// sample 22
-	198,	// sample 23
-	191,	// sample 24
-	185,	// sample 25
-	178,	// sample 26
-	172,	// sample 27
-	166,	// sample 28
-	161,	// sample 29
-	158,	// sample 30
-	154,	// sample 31
-	150,	// sample 32
-	149,	// sample 33
-	147,	// sample 34
-	146,	// sample 35
-	147,	// sample 36
-	147,	// sample 37
-	149,	// sample 38
-	151,	// sample 39
-	154,	// sample 40
-	156,	// sample 41
-	160,	// sample 42
-	162,	// sample 43
-	166,	// sample 44
-	169,	// sample 45
-	173,	// sample 46
-	175,	// sample 47
-	178,	// sample 48
-	179,	// sample 49
-	180,	// sample 50
-	182,	// sample 51
-	181,	// sample 52
-	180,	// sample 53
-	177,	// sample 54
-	175,	// sample 55
-	172,	// sample 56
-	168,	// sample 57
-	163,	// sample 58
-	160,	// sample 59
-	153,	// sample 60
-	148,	// sample 61
-	140,	// sample 62
-	134,	// sample 63
-	132,	// -------- wave 211 (d3h), sample 00
-	142,	// sample 01
-	154,	// sample 02
-	164,	// sample 03
-	173,	// sample 04
-	183,	// sample 05
-	191,	// sample 06
-	199,	// sample 07
-	205,	// sample 08
-	211,	// sample 09
-	217,	// sample 10
-	222,	// sample 11
-	223,	// sample 12
-	225,	// sample 13
-	228,	// sample 14
-	229,	// sample 15
-	229,	// sample 16
-	228,	// sample 17
-	228,	// sample 18
-	227,	// sample 19
-	224,	// sample 20
-	224,	// sample 21
-	223,	// sample 22
-	222,	// sample 23
-	220,	// sample 24
-	219,	// sample 25
-	218,	// sample 26
-	219,	// sample 27
-	219,	// sample 28
-	219,	// sample 29
-	220,	// sample 30
-	221,	// sample 31
-	222,	// sample 32
-	224,	// sample 33
-	224,	// sample 34
-	227,	// sample 35
-	229,	// sample 36
-	230,	// sample 37
-	231,	// sample 38
-	233,	// sample 39
-	234,	// sample 40
-	235,	// sample 41
-	235,	// sample 42
-	235,	// sample 43
-	235,	// sample 44
-	233,	// sample 45
-	231,	// sample 46
-	228,	// sample 47
-	226,	// sample 48
-	223,	// sample 49
-	218,	// sample 50
-	213,	// sample 51
-	208,	// sample 52
-	203,	// sample 53
-	197,	// sample 54
-	190,	// sample 55
-	184,	// sample 56
-	177,	// sample 57
-	170,	// sample 58
-	163,	// sample 59
-	157,	// sample 60
-	149,	// sample 61
-	139,	// sample 62
-	133,	// sample 63
-	132,	// -------- wave 212 (d4h), sample 00
-	150,	// sample 01
-	164,	// sample 02
-	179,	// sample 03
-	194,	// sample 04
-	206,	// sample 05
-	216,	// sample 06
-	224,	// sample 07
-	230,	// sample 08
-	233,	// sample 09
-	234,	// sample 10
-	231,	// sample 11
-	227,	// sample 12
-	222,	// sample 13
-	214,	// sample 14
-	204,	// sample 15
-	194,	// sample 16
-	183,	// sample 17
-	172,	// sample 18
-	162,	// sample 19
-	154,	// sample 20
-	145,	// sample 21
-	137,	// sample 22
-	131,	// sample 23
-	126,	// sample 24
-	126,	// sample 25
-	125,	// sample 26
-	127,	// sample 27
-	131,	// sample 28
-	137,	// sample 29
-	145,	// sample 30
-	153,	// sample 31
-	160,	// sample 32
-	171,	// sample 33
-	179,	// sample 34
-	189,	// sample 35
-	198,	// sample 36
-	205,	// sample 37
-	213,	// sample 38
-	217,	// sample 39
-	222,	// sample 40
-	223,	// sample 41
-	224,	// sample 42
-	222,	// sample 43
-	219,	// sample 44
-	215,	// sample 45
-	208,	// sample 46
-	201,	// sample 47
-	193,	// sample 48
-	185,	// sample 49
-	175,	// sample 50
-	167,	// sample 51
-	159,	// sample 52
-	152,	// sample 53
-	145,	// sample 54
-	138,	// sample 55
-	132,	// sample 56
-	129,	// sample 57
-	126,	// sample 58
-	124,	// sample 59
-	123,	// sample 60
-	124,	// sample 61
-	125,	// sample 62
-	126,	// sample 63
-	132,	// -------- wave 213 (d5h), sample 00
-	150,	// sample 01
-	168,	// sample 02
-	185,	// sample 03
-	201,	// sample 04
-	215,	// sample 05
-	226,	// sample 06
-	235,	// sample 07
-	243,	// sample 08
-	248,	// sample 09
-	251,	// sample 10
-	251,	// sample 11
-	248,	// sample 12
-	242,	// sample 13
-	235,	// sample 14
-	226,	// sample 15
-	216,	// sample 16
-	204,	// sample 17
-	191,	// sample 18
-	177,	// sample 19
-	164,	// sample 20
-	152,	// sample 21
-	138,	// sample 22
-	128,	// sample 23
-	116,	// sample 24
-	108,	// sample 25
-	100,	// sample 26
-	 97,	// sample 27
-	 93,	// sample 28
-	 91,	// sample 29
-	 92,	// sample 30
-	 94,	// sample 31
-	 98,	// sample 32
-	103,	// sample 33
-	109,	// sample 34
-	118,	// sample 35
-	127,	// sample 36
-	137,	// sample 37
-	146,	// sample 38
-	156,	// sample 39
-	166,	// sample 40
-	175,	// sample 41
-	185,	// sample 42
-	193,	// sample 43
-	201,	// sample 44
-	207,	// sample 45
-	211,	// sample 46
-	215,	// sample 47
-	217,	// sample 48
-	218,	// sample 49
-	217,	// sample 50
-	216,	// sample 51
-	214,	// sample 52
-	210,	// sample 53
-	205,	// sample 54
-	199,	// sample 55
-	193,	// sample 56
-	186,	// sample 57
-	178,	// sample 58
-	171,	// sample 59
-	162,	// sample 60
-	153,	// sample 61
-	143,	// sample 62
-	135,	// sample 63
-	132,	// -------- wave 214 (d6h), sample 00
-	153,	// sample 01
-	173,	// sample 02
-	191,	// sample 03
-	205,	// sample 04
-	217,	// sample 05
-	224,	// sample 06
-	227,	// sample 07
-	227,	// sample 08
-	223,	// sample 09
-	215,	// sample 10
-	203,	// sample 11
-	191,	// sample 12
-	175,	// sample 13
-	161,	// sample 14
-	146,	// sample 15
-	133,	// sample 16
-	122,	// sample 17
-	115,	// sample 18
-	110,	// sample 19
-	111,	// sample 20
-	115,	// sample 21
-	121,	// sample 22
-	131,	// sample 23
-	143,	// sample 24
-	159,	// sample 25
-	173,	// sample 26
-	190,	// sample 27
-	206,	// sample 28
-	219,	// sample 29
-	230,	// sample 30
-	240,	// sample 31
-	247,	// sample 32
-	248,	// sample 33
-	248,	// sample 34
-	243,	// sample 35
-	235,	// sample 36
-	225,	// sample 37
-	214,	// sample 38
-	199,	// sample 39
-	187,	// sample 40
-	173,	// sample 41
-	161,	// sample 42
-	151,	// sample 43
-	142,	// sample 44
-	135,	// sample 45
-	132,	// sample 46
-	131,	// sample 47
-	133,	// sample 48
-	137,	// sample 49
-	142,	// sample 50
-	150,	// sample 51
-	157,	// sample 52
-	164,	// sample 53
-	170,	// sample 54
-	176,	// sample 55
-	178,	// sample 56
-	179,	// sample 57
-	177,	// sample 58
-	174,	// sample 59
-	168,	// sample 60
-	159,	// sample 61
-	149,	// sample 62
-	138,	// sample 63
-	130,	// -------- wave 215 (d7h), sample 00
-	149,	// sample 01
-	166,	// sample 02
-	179,	// sample 03
-	192,	// sample 04
-	203,	// sample 05
-	209,	// sample 06
-	216,	// sample 07
-	217,	// sample 08
-	216,	// sample 09
-	214,	// sample 10
-	209,	// sample 11
-	203,	// sample 12
-	198,	// sample 13
-	192,	// sample 14
-	187,	// sample 15
-	183,	// sample 16
-	177,	// sample 17
-	177,	// sample 18
-	179,	// sample 19
-	179,	// sample 20
-	183,	// sample 21
-	188,	// sample 22
-	194,	// sample 23
-	199,	// sample 24
-	206,	// sample 25
-	211,	// sample 26
-	217,	// sample 27
-	220,	// sample 28
-	223,	// sample 29
-	224,	// sample 30
-	224,	// sample 31
-	223,	// sample 32
-	223,	// sample 33
-	219,	// sample 34
-	217,	// sample 35
-	213,	// sample 36
-	208,	// sample 37
-	204,	// sample 38
-	201,	// sample 39
-	199,	// sample 40
-	195,	// sample 41
-	193,	// sample 42
-	189,	// sample 43
-	187,	// sample 44
-	184,	// sample 45
-	179,	// sample 46
-	176,	// sample 47
-	171,	// sample 48
-	167,	// sample 49
-	160,	// sample 50
-	154,	// sample 51
-	149,	// sample 52
-	143,	// sample 53
-	137,	// sample 54
-	132,	// sample 55
-	126,	// sample 56
-	123,	// sample 57
-	121,	// sample 58
-	120,	// sample 59
-	121,	// sample 60
-	121,	// sample 61
-	122,	// sample 62
-	124,	// sample 63
-	131,	// -------- wave 216 (d8h), sample 00
-	154,	// sample 01
-	174,	// sample 02
-	192,	// sample 03
-	208,	// sample 04
-	219,	// sample 05
-	227,	// sample 06
-	230,	// sample 07
-	228,	// sample 08
-	223,	// sample 09
-	218,	// sample 10
-	208,	// sample 11
-	198,	// sample 12
-	188,	// sample 13
-	178,	// sample 14
-	171,	// sample 15
-	167,	// sample 16
-	161,	// sample 17
-	164,	// sample 18
-	164,	// sample 19
-	169,	// sample 20
-	177,	// sample 21
-	183,	// sample 22
-	191,	// sample 23
-	196,	// sample 24
-	202,	// sample 25
-	205,	// sample 26
-	204,	// sample 27
-	203,	// sample 28
-	198,	// sample 29
-	192,	// sample 30
-	184,	// sample 31
-	172,	// sample 32
-	162,	// sample 33
-	152,	// sample 34
-	143,	// sample 35
-	135,	// sample 36
-	129,	// sample 37
-	124,	// sample 38
-	122,	// sample 39
-	123,	// sample 40
-	124,	// sample 41
-	126,	// sample 42
-	129,	// sample 43
-	131,	// sample 44
-	133,	// sample 45
-	134,	// sample 46
-	134,	// sample 47
-	130,	// sample 48
-	126,	// sample 49
-	120,	// sample 50
-	111,	// sample 51
-	102,	// sample 52
-	 93,	// sample 53
-	 86,	// sample 54
-	 78,	// sample 55
-	 72,	// sample 56
-	 70,	// sample 57
-	 70,	// sample 58
-	 75,	// sample 59
-	 82,	// sample 60
-	 92,	// sample 61
-	103,	// sample 62
-	115,	// sample 63
-	131,	// -------- wave 217 (d9h), sample 00
-	166,	// sample 01
-	197,	// sample 02
-	222,	// sample 03
-	238,	// sample 04
-	250,	// sample 05
-	248,	// sample 06
-	241,	// sample 07
-	226,	// sample 08
-	206,	// sample 09
-	185,	// sample 10
-	162,	// sample 11
-	144,	// sample 12
-	128,	// sample 13
-	118,	// sample 14
-	116,	// sample 15
-	116,	// sample 16
-	126,	// sample 17
-	138,	// sample 18
-	153,	// sample 19
-	167,	// sample 20
-	180,	// sample 21
-	192,	// sample 22
-	198,	// sample 23
-	200,	// sample 24
-	197,	// sample 25
-	190,	// sample 26
-	180,	// sample 27
-	167,	// sample 28
-	155,	// sample 29
-	142,	// sample 30
-	132,	// sample 31
-	123,	// sample 32
-	117,	// sample 33
-	112,	// sample 34
-	112,	// sample 35
-	111,	// sample 36
-	111,	// sample 37
-	111,	// sample 38
-	106,	// sample 39
-	102,	// sample 40
-	 95,	// sample 41
-	 86,	// sample 42
-	 74,	// sample 43
-	 62,	// sample 44
-	 51,	// sample 45
-	 37,	// sample 46
-	 31,	// sample 47
-	 26,	// sample 48
-	 29,	// sample 49
-	 34,	// sample 50
-	 43,	// sample 51
-	 60,	// sample 52
-	 77,	// sample 53
-	 96,	// sample 54
-	113,	// sample 55
-	133,	// sample 56
-	148,	// sample 57
-	158,	// sample 58
-	164,	// sample 59
-	164,	// sample 60
-	160,	// sample 61
-	152,	// sample 62
-	142,	// sample 63
-	131,	// -------- wave 218 (dah), sample 00
-	164,	// sample 01
-	196,	// sample 02
-	217,	// sample 03
-	228,	// sample 04
-	233,	// sample 05
-	224,	// sample 06
-	211,	// sample 07
-	187,	// sample 08
-	165,	// sample 09
-	143,	// sample 10
-	124,	// sample 11
-	113,	// sample 12
-	109,	// sample 13
-	114,	// sample 14
-	127,	// sample 15
-	145,	// sample 16
-	165,	// sample 17
-	186,	// sample 18
-	203,	// sample 19
-	214,	// sample 20
-	218,	// sample 21
-	215,	// sample 22
-	206,	// sample 23
-	190,	// sample 24
-	171,	// sample 25
-	150,	// sample 26
-	132,	// sample 27
-	117,	// sample 28
-	108,	// sample 29
-	102,	// sample 30
-	100,	// sample 31
-	104,	// sample 32
-	110,	// sample 33
-	116,	// sample 34
-	120,	// sample 35
-	121,	// sample 36
-	119,	// sample 37
-	111,	// sample 38
-	103,	// sample 39
-	 92,	// sample 40
-	 84,	// sample 41
-	 73,	// sample 42
-	 67,	// sample 43
-	 65,	// sample 44
-	 69,	// sample 45
-	 76,	// sample 46
-	 86,	// sample 47
-	 97,	// sample 48
-	110,	// sample 49
-	119,	// sample 50
-	126,	// sample 51
-	128,	// sample 52
-	123,	// sample 53
-	114,	// sample 54
-	104,	// sample 55
-	 91,	// sample 56
-	 80,	// sample 57
-	 71,	// sample 58
-	 68,	// sample 59
-	 70,	// sample 60
-	 80,	// sample 61
-	 94,	// sample 62
-	110,	// sample 63
-	130,	// -------- wave 219 (dbh), sample 00
-	163,	// sample 01
-	191,	// sample 02
-	212,	// sample 03
-	225,	// sample 04
-	230,	// sample 05
-	225,	// sample 06
-	215,	// sample 07
-	199,	// sample 08
-	182,	// sample 09
-	165,	// sample 10
-	154,	// sample 11
-	145,	// sample 12
-	143,	// sample 13
-	144,	// sample 14
-	151,	// sample 15
-	159,	// sample 16
-	163,	// sample 17
-	166,	// sample 18
-	168,	// sample 19
-	166,	// sample 20
-	160,	// sample 21
-	151,	// sample 22
-	142,	// sample 23
-	132,	// sample 24
-	122,	// sample 25
-	116,	// sample 26
-	111,	// sample 27
-	108,	// sample 28
-	105,	// sample 29
-	103,	// sample 30
-	 99,	// sample 31
-	 93,	// sample 32
-	 86,	// sample 33
-	 76,	// sample 34
-	 69,	// sample 35
-	 60,	// sample 36
-	 54,	// sample 37
-	 54,	// sample 38
-	 58,	// sample 39
-	 68,	// sample 40
-	 85,	// sample 41
-	102,	// sample 42
-	123,	// sample 43
-	143,	// sample 44
-	159,	// sample 45
-	173,	// sample 46
-	178,	// sample 47
-	180,	// sample 48
-	179,	// sample 49
-	170,	// sample 50
-	162,	// sample 51
-	154,	// sample 52
-	145,	// sample 53
-	139,	// sample 54
-	135,	// sample 55
-	135,	// sample 56
-	136,	// sample 57
-	138,	// sample 58
-	140,	// sample 59
-	140,	// sample 60
-	139,	// sample 61
-	137,	// sample 62
-	133,	// sample 63
-	132,	// -------- wave 220 (dch), sample 00
-	176,	// sample 01
-	213,	// sample 02
-	239,	// sample 03
-	250,	// sample 04
-	250,	// sample 05
-	236,	// sample 06
-	218,	// sample 07
-	196,	// sample 08
-	178,	// sample 09
-	172,	// sample 10
-	172,	// sample 11
-	181,	// sample 12
-	197,	// sample 13
-	213,	// sample 14
-	225,	// sample 15
-	233,	// sample 16
-	231,	// sample 17
-	221,	// sample 18
-	204,	// sample 19
-	182,	// sample 20
-	160,	// sample 21
-	138,	// sample 22
-	122,	// sample 23
-	111,	// sample 24
-	101,	// sample 25
-	 98,	// sample 26
-	 94,	// sample 27
-	 88,	// sample 28
-	 81,	// sample 29
-	 70,	// sample 30
-	 57,	// sample 31
-	 43,	// sample 32
-	 34,	// sample 33
-	 29,	// sample 34
-	 33,	// sample 35
-	 42,	// sample 36
-	 55,	// sample 37
-	 73,	// sample 38
-	 91,	// sample 39
-	109,	// sample 40
-	118,	// sample 41
-	127,	// sample 42
-	129,	// sample 43
-	128,	// sample 44
-	123,	// sample 45
-	119,	// sample 46
-	117,	// sample 47
-	120,	// sample 48
-	130,	// sample 49
-	141,	// sample 50
-	156,	// sample 51
-	169,	// sample 52
-	182,	// sample 53
-	189,	// sample 54
-	193,	// sample 55
-	193,	// sample 56
-	183,	// sample 57
-	176,	// sample 58
-	162,	// sample 59
-	152,	// sample 60
-	143,	// sample 61
-	136,	// sample 62
-	133,	// sample 63
-	131,	// -------- wave 221 (ddh), sample 00
-	179,	// sample 01
-	216,	// sample 02
-	237,	// sample 03
-	241,	// sample 04
-	226,	// sample 05
-	204,	// sample 06
-	179,	// sample 07
-	161,	// sample 08
-	156,	// sample 09
-	162,	// sample 10
-	180,	// sample 11
-	207,	// sample 12
-	230,	// sample 13
-	246,	// sample 14
-	251,	// sample 15
-	241,	// sample 16
-	222,	// sample 17
-	198,	// sample 18
-	172,	// sample 19
-	156,	// sample 20
-	144,	// sample 21
-	141,	// sample 22
-	144,	// sample 23
-	150,	// sample 24
-	150,	// sample 25
-	144,	// sample 26
-	134,	// sample 27
-	116,	// sample 28
-	 98,	// sample 29
-	 83,	// sample 30
-	 73,	// sample 31
-	 73,	// sample 32
-	 81,	// sample 33
-	 94,	// sample 34
-	107,	// sample 35
-	119,	// sample 36
-	123,	// sample 37
-	117,	// sample 38
-	105,	// sample 39
-	 90,	// sample 40
-	 75,	// sample 41
-	 63,	// sample 42
-	 58,	// sample 43
-	 60,	// sample 44
-	 74,	// sample 45
-	 87,	// sample 46
-	103,	// sample 47
-	115,	// sample 48
-	124,	// sample 49
-	126,	// sample 50
-	119,	// sample 51
-	114,	// sample 52
-	 99,	// sample 53
-	 95,	// sample 54
-	 89,	// sample 55
-	 91,	// sample 56
-	 96,	// sample 57
-	103,	// sample 58
-	114,	// sample 59
-	124,	// sample 60
-	129,	// sample 61
-	134,	// sample 62
-	132,	// sample 63
-	131,	// -------- wave 222 (deh), sample 00
-	169,	// sample 01
-	202,	// sample 02
-	218,	// sample 03
-	218,	// sample 04
-	203,	// sample 05
-	182,	// sample 06
-	162,	// sample 07
-	153,	// sample 08
-	150,	// sample 09
-	158,	// sample 10
-	172,	// sample 11
-	187,	// sample 12
-	196,	// sample 13
-	197,	// sample 14
-	188,	// sample 15
-	171,	// sample 16
-	154,	// sample 17
-	139,	// sample 18
-	128,	// sample 19
-	124,	// sample 20
-	127,	// sample 21
-	127,	// sample 22
-	129,	// sample 23
-	121,	// sample 24
-	111,	// sample 25
-	 97,	// sample 26
-	 85,	// sample 27
-	 78,	// sample 28
-	 79,	// sample 29
-	 89,	// sample 30
-	105,	// sample 31
-	124,	// sample 32
-	140,	// sample 33
-	151,	// sample 34
-	154,	// sample 35
-	150,	// sample 36
-	139,	// sample 37
-	131,	// sample 38
-	122,	// sample 39
-	118,	// sample 40
-	121,	// sample 41
-	124,	// sample 42
-	131,	// sample 43
-	134,	// sample 44
-	135,	// sample 45
-	131,	// sample 46
-	121,	// sample 47
-	110,	// sample 48
-	102,	// sample 49
-	 97,	// sample 50
-	 95,	// sample 51
-	 96,	// sample 52
-	 99,	// sample 53
-	103,	// sample 54
-	103,	// sample 55
-	102,	// sample 56
-	 98,	// sample 57
-	 93,	// sample 58
-	 88,	// sample 59
-	 87,	// sample 60
-	 89,	// sample 61
-	 99,	// sample 62
-	112,	// sample 63
-	131,	// -------- wave 223 (dfh), sample 00
-	184,	// sample 01
-	219,	// sample 02
-	232,	// sample 03
-	221,	// sample 04
-	194,	// sample 05
-	165,	// sample 06
-	148,	// sample 07
-	149,	// sample 08
-	160,	// sample 09
-	181,	// sample 10
-	194,	// sample 11
-	198,	// sample 12
-	184,	// sample 13
-	162,	// sample 14
-	140,	// sample 15
-	118,	// sample 16
-	108,	// sample 17
-	105,	// sample 18
-	100,	// sample 19
-	 97,	// sample 20
-	 90,	// sample 21
-	 79,	// sample 22
-	 73,	// sample 23
-	 72,	// sample 24
-	 83,	// sample 25
-	103,	// sample 26
-	128,	// sample 27
-	149,	// sample 28
-	163,	// sample 29
-	165,	// sample 30
-	158,	// sample 31
-	144,	// sample 32
-	133,	// sample 33
-	128,	// sample 34
-	135,	// sample 35
-	145,	// sample 36
-	160,	// sample 37
-	174,	// sample 38
-	175,	// sample 39
-	172,	// sample 40
-	160,	// sample 41
-	145,	// sample 42
-	132,	// sample 43
-	124,	// sample 44
-	120,	// sample 45
-	120,	// sample 46
-	123,	// sample 47
-	125,	// sample 48
-	123,	// sample 49
-	125,	// sample 50
-	122,	// sample 51
-	125,	// sample 52
-	134,	// sample 53
-	143,	// sample 54
-	155,	// sample 55
-	159,	// sample 56
-	158,	// sample 57
-	149,	// sample 58
-	134,	// sample 59
-	119,	// sample 60
-	110,	// sample 61
-	109,	// sample 62
-	116,	// sample 63
-	130,	// -------- wave 224 (e0h), sample 00
-	189,	// sample 01
-	225,	// sample 02
-	234,	// sample 03
-	220,	// sample 04
-	195,	// sample 05
-	173,	// sample 06
-	167,	// sample 07
-	177,	// sample 08
-	201,	// sample 09
-	215,	// sample 10
-	220,	// sample 11
-	209,	// sample 12
-	185,	// sample 13
-	164,	// sample 14
-	145,	// sample 15
-	134,	// sample 16
-	125,	// sample 17
-	112,	// sample 18
-	 98,	// sample 19
-	 83,	// sample 20
-	 75,	// sample 21
-	 76,	// sample 22
-	 90,	// sample 23
-	110,	// sample 24
-	129,	// sample 25
-	140,	// sample 26
-	140,	// sample 27
-	129,	// sample 28
-	117,	// sample 29
-	113,	// sample 30
-	117,	// sample 31
-	126,	// sample 32
-	141,	// sample 33
-	151,	// sample 34
-	158,	// sample 35
-	155,	// sample 36
-	147,	// sample 37
-	142,	// sample 38
-	135,	// sample 39
-	129,	// sample 40
-	123,	// sample 41
-	118,	// sample 42
-	111,	// sample 43
-	109,	// sample 44
-	109,	// sample 45
-	121,	// sample 46
-	135,	// sample 47
-	151,	// sample 48
-	165,	// sample 49
-	172,	// sample 50
-	171,	// sample 51
-	167,	// sample 52
-	162,	// sample 53
-	160,	// sample 54
-	161,	// sample 55
-	170,	// sample 56
-	175,	// sample 57
-	182,	// sample 58
-	184,	// sample 59
-	177,	// sample 60
-	167,	// sample 61
-	156,	// sample 62
-	142,	// sample 63
-	131,	// -------- wave 225 (e1h), sample 00
-	208,	// sample 01
-	250,	// sample 02
-	251,	// sample 03
-	221,	// sample 04
-	184,	// sample 05
-	169,	// sample 06
-	182,	// sample 07
-	210,	// sample 08
-	227,	// sample 09
-	227,	// sample 10
-	203,	// sample 11
-	171,	// sample 12
-	144,	// sample 13
-	130,	// sample 14
-	127,	// sample 15
-	117,	// sample 16
-	101,	// sample 17
-	 83,	// sample 18
-	 67,	// sample 19
-	 71,	// sample 20
-	 94,	// sample 21
-	126,	// sample 22
-	154,	// sample 23
-	164,	// sample 24
-	158,	// sample 25
-	142,	// sample 26
-	129,	// sample 27
-	128,	// sample 28
-	141,	// sample 29
-	152,	// sample 30
-	160,	// sample 31
-	157,	// sample 32
-	150,	// sample 33
-	136,	// sample 34
-	128,	// sample 35
-	121,	// sample 36
-	114,	// sample 37
-	108,	// sample 38
-	 99,	// sample 39
-	 97,	// sample 40
-	 97,	// sample 41
-	111,	// sample 42
-	130,	// sample 43
-	152,	// sample 44
-	166,	// sample 45
-	173,	// sample 46
-	171,	// sample 47
-	167,	// sample 48
-	157,	// sample 49
-	158,	// sample 50
-	158,	// sample 51
-	166,	// sample 52
-	174,	// sample 53
-	177,	// sample 54
-	175,	// sample 55
-	169,	// sample 56
-	160,	// sample 57
-	146,	// sample 58
-	136,	// sample 59
-	124,	// sample 60
-	120,	// sample 61
-	121,	// sample 62
-	123,	// sample 63
-	129,	// -------- wave 226 (e2h), sample 00
-	212,	// sample 01
-	249,	// sample 02
-	226,	// sample 03
-	176,	// sample 04
-	145,	// sample 05
-	148,	// sample 06
-	179,	// sample 07
-	204,	// sample 08
-	202,	// sample 09
-	177,	// sample 10
-	136,	// sample 11
-	117,	// sample 12
-	109,	// sample 13
-	105,	// sample 14
-	 93,	// sample 15
-	 67,	// sample 16
-	 49,	// sample 17
-	 52,	// sample 18
-	 81,	// sample 19
-	115,	// sample 20
-	139,	// sample 21
-	139,	// sample 22
-	131,	// sample 23
-	121,	// sample 24
-	124,	// sample 25
-	140,	// sample 26
-	160,	// sample 27
-	164,	// sample 28
-	162,	// sample 29
-	152,	// sample 30
-	141,	// sample 31
-	134,	// sample 32
-	133,	// sample 33
-	123,	// sample 34
-	113,	// sample 35
-	102,	// sample 36
-	 96,	// sample 37
-	100,	// sample 38
-	112,	// sample 39
-	128,	// sample 40
-	142,	// sample 41
-	142,	// sample 42
-	141,	// sample 43
-	135,	// sample 44
-	137,	// sample 45
-	140,	// sample 46
-	147,	// sample 47
-	151,	// sample 48
-	151,	// sample 49
-	148,	// sample 50
-	139,	// sample 51
-	133,	// sample 52
-	129,	// sample 53
-	120,	// sample 54
-	109,	// sample 55
-	100,	// sample 56
-	 96,	// sample 57
-	 94,	// sample 58
-	101,	// sample 59
-	111,	// sample 60
-	119,	// sample 61
-	128,	// sample 62
-	129,	// sample 63
-	130,	// -------- wave 227 (e3h), sample 00
-	212,	// sample 01
-	237,	// sample 02
-	204,	// sample 03
-	163,	// sample 04
-	158,	// sample 05
-	188,	// sample 06
-	220,	// sample 07
-	212,	// sample 08
-	177,	// sample 09
-	139,	// sample 10
-	127,	// sample 11
-	125,	// sample 12
-	112,	// sample 13
-	 84,	// sample 14
-	 61,	// sample 15
-	 65,	// sample 16
-	 97,	// sample 17
-	126,	// sample 18
-	130,	// sample 19
-	114,	// sample 20
-	100,	// sample 21
-	105,	// sample 22
-	127,	// sample 23
-	145,	// sample 24
-	144,	// sample 25
-	131,	// sample 26
-	119,	// sample 27
-	115,	// sample 28
-	120,	// sample 29
-	117,	// sample 30
-	104,	// sample 31
-	 98,	// sample 32
-	103,	// sample 33
-	122,	// sample 34
-	143,	// sample 35
-	157,	// sample 36
-	154,	// sample 37
-	149,	// sample 38
-	148,	// sample 39
-	157,	// sample 40
-	168,	// sample 41
-	171,	// sample 42
-	167,	// sample 43
-	153,	// sample 44
-	143,	// sample 45
-	135,	// sample 46
-	129,	// sample 47
-	119,	// sample 48
-	102,	// sample 49
-	 93,	// sample 50
-	 94,	// sample 51
-	103,	// sample 52
-	113,	// sample 53
-	115,	// sample 54
-	106,	// sample 55
-	 99,	// sample 56
-	102,	// sample 57
-	111,	// sample 58
-	126,	// sample 59
-	131,	// sample 60
-	132,	// sample 61
-	128,	// sample 62
-	126,	// sample 63
-	130,	// -------- wave 228 (e4h), sample 00
-	226,	// sample 01
-	245,	// sample 02
-	198,	// sample 03
-	156,	// sample 04
-	167,	// sample 05
-	207,	// sample 06
-	223,	// sample 07
-	186,	// sample 08
-	143,	// sample 09
-	118,	// sample 10
-	119,	// sample 11
-	106,	// sample 12
-	 74,	// sample 13
-	 52,	// sample 14
-	 70,	// sample 15
-	112,	// sample 16
-	139,	// sample 17
-	137,	// sample 18
-	118,	// sample 19
-	116,	// sample 20
-	134,	// sample 21
-	156,	// sample 22
-	152,	// sample 23
-	132,	// sample 24
-	117,	// sample 25
-	117,	// sample 26
-	117,	// sample 27
-	105,	// sample 28
-	 90,	// sample 29
-	 84,	// sample 30
-	 97,	// sample 31
-	123,	// sample 32
-	145,	// sample 33
-	148,	// sample 34
-	146,	// sample 35
-	147,	// sample 36
-	157,	// sample 37
-	165,	// sample 38
-	165,	// sample 39
-	157,	// sample 40
-	148,	// sample 41
-	144,	// sample 42
-	144,	// sample 43
-	127,	// sample 44
-	113,	// sample 45
-	103,	// sample 46
-	104,	// sample 47
-	119,	// sample 48
-	128,	// sample 49
-	128,	// sample 50
-	120,	// sample 51
-	115,	// sample 52
-	120,	// sample 53
-	124,	// sample 54
-	124,	// sample 55
-	121,	// sample 56
-	118,	// sample 57
-	118,	// sample 58
-	121,	// sample 59
-	118,	// sample 60
-	114,	// sample 61
-	111,	// sample 62
-	116,	// sample 63
-	128,	// -------- wave 229 (e5h), sample 00
-	220,	// sample 01
-	220,	// sample 02
-	167,	// sample 03
-	156,	// sample 04
-	188,	// sample 05
-	205,	// sample 06
-	169,	// sample 07
-	131,	// sample 08
-	118,	// sample 09
-	109,	// sample 10
-	 84,	// sample 11
-	 66,	// sample 12
-	 99,	// sample 13
-	141,	// sample 14
-	153,	// sample 15
-	128,	// sample 16
-	119,	// sample 17
-	138,	// sample 18
-	155,	// sample 19
-	147,	// sample 20
-	128,	// sample 21
-	117,	// sample 22
-	116,	// sample 23
-	108,	// sample 24
-	103,	// sample 25
-	113,	// sample 26
-	140,	// sample 27
-	159,	// sample 28
-	151,	// sample 29
-	141,	// sample 30
-	143,	// sample 31
-	156,	// sample 32
-	159,	// sample 33
-	147,	// sample 34
-	133,	// sample 35
-	128,	// sample 36
-	124,	// sample 37
-	114,	// sample 38
-	106,	// sample 39
-	114,	// sample 40
-	122,	// sample 41
-	123,	// sample 42
-	109,	// sample 43
-	104,	// sample 44
-	111,	// sample 45
-	119,	// sample 46
-	116,	// sample 47
-	115,	// sample 48
-	115,	// sample 49
-	119,	// sample 50
-	121,	// sample 51
-	125,	// sample 52
-	129,	// sample 53
-	139,	// sample 54
-	143,	// sample 55
-	136,	// sample 56
-	135,	// sample 57
-	134,	// sample 58
-	136,	// sample 59
-	135,	// sample 60
-	130,	// sample 61
-	127,	// sample 62
-	128,	// sample 63
-	128,	// -------- wave 230 (e6h), sample 00
-	221,	// sample 01
-	221,	// sample 02
-	171,	// sample 03
-	170,	// sample 04
-	202,	// sample 05
-	198,	// sample 06
-	147,	// sample 07
-	115,	// sample 08
-	104,	// sample 09
-	 86,	// sample 10
-	 72,	// sample 11
-	 99,	// sample 12
-	142,	// sample 13
-	146,	// sample 14
-	125,	// sample 15
-	124,	// sample 16
-	156,	// sample 17
-	159,	// sample 18
-	134,	// sample 19
-	117,	// sample 20
-	119,	// sample 21
-	113,	// sample 22
-	107,	// sample 23
-	126,	// sample 24
-	159,	// sample 25
-	164,	// sample 26
-	147,	// sample 27
-	140,	// sample 28
-	160,	// sample 29
-	162,	// sample 30
-	143,	// sample 31
-	123,	// sample 32
-	119,	// sample 33
-	112,	// sample 34
-	103,	// sample 35
-	105,	// sample 36
-	120,	// sample 37
-	123,	// sample 38
-	110,	// sample 39
-	103,	// sample 40
-	119,	// sample 41
-	131,	// sample 42
-	126,	// sample 43
-	120,	// sample 44
-	123,	// sample 45
-	127,	// sample 46
-	130,	// sample 47
-	130,	// sample 48
-	137,	// sample 49
-	141,	// sample 50
-	130,	// sample 51
-	119,	// sample 52
-	120,	// sample 53
-	123,	// sample 54
-	120,	// sample 55
-	112,	// sample 56
-	115,	// sample 57
-	115,	// sample 58
-	119,	// sample 59
-	122,	// sample 60
-	124,	// sample 61
-	127,	// sample 62
-	130,	// sample 63
-	128,	// -------- wave 231 (e7h), sample 00
-	208,	// sample 01
-	216,	// sample 02
-	185,	// sample 03
-	179,	// sample 04
-	195,	// sample 05
-	183,	// sample 06
-	131,	// sample 07
-	 86,	// sample 08
-	 77,	// sample 09
-	 93,	// sample 10
-	114,	// sample 11
-	126,	// sample 12
-	137,	// sample 13
-	143,	// sample 14
-	144,	// sample 15
-	149,	// sample 16
-	147,	// sample 17
-	128,	// sample 18
-	102,	// sample 19
-	101,	// sample 20
-	120,	// sample 21
-	141,	// sample 22
-	152,	// sample 23
-	153,	// sample 24
-	161,	// sample 25
-	163,	// sample 26
-	161,	// sample 27
-	153,	// sample 28
-	137,	// sample 29
-	114,	// sample 30
-	105,	// sample 31
-	108,	// sample 32
-	117,	// sample 33
-	117,	// sample 34
-	115,	// sample 35
-	110,	// sample 36
-	121,	// sample 37
-	127,	// sample 38
-	124,	// sample 39
-	118,	// sample 40
-	114,	// sample 41
-	119,	// sample 42
-	128,	// sample 43
-	137,	// sample 44
-	137,	// sample 45
-	130,	// sample 46
-	126,	// sample 47
-	128,	// sample 48
-	133,	// sample 49
-	124,	// sample 50
-	113,	// sample 51
-	112,	// sample 52
-	117,	// sample 53
-	124,	// sample 54
-	127,	// sample 55
-	123,	// sample 56
-	119,	// sample 57
-	116,	// sample 58
-	119,	// sample 59
-	119,	// sample 60
-	117,	// sample 61
-	115,	// sample 62
-	117,	// sample 63
-	128,	// -------- wave 232 (e8h), sample 00
-	212,	// sample 01
-	218,	// sample 02
-	186,	// sample 03
-	179,	// sample 04
-	190,	// sample 05
-	157,	// sample 06
-	 89,	// sample 07
-	 54,	// sample 08
-	 76,	// sample 09
-	114,	// sample 10
-	124,	// sample 11
-	120,	// sample 12
-	131,	// sample 13
-	148,	// sample 14
-	146,	// sample 15
-	124,	// sample 16
-	103,	// sample 17
-	 99,	// sample 18
-	113,	// sample 19
-	137,	// sample 20
-	151,	// sample 21
-	153,	// sample 22
-	154,	// sample 23
-	160,	// sample 24
-	159,	// sample 25
-	141,	// sample 26
-	110,	// sample 27
-	 99,	// sample 28
-	109,	// sample 29
-	116,	// sample 30
-	110,	// sample 31
-	108,	// sample 32
-	119,	// sample 33
-	132,	// sample 34
-	135,	// sample 35
-	129,	// sample 36
-	126,	// sample 37
-	130,	// sample 38
-	138,	// sample 39
-	145,	// sample 40
-	143,	// sample 41
-	138,	// sample 42
-	136,	// sample 43
-	139,	// sample 44
-	136,	// sample 45
-	123,	// sample 46
-	112,	// sample 47
-	112,	// sample 48
-	119,	// sample 49
-	121,	// sample 50
-	116,	// sample 51
-	119,	// sample 52
-	126,	// sample 53
-	132,	// sample 54
-	129,	// sample 55
-	129,	// sample 56
-	134,	// sample 57
-	140,	// sample 58
-	143,	// sample 59
-	142,	// sample 60
-	142,	// sample 61
-	140,	// sample 62
-	136,	// sample 63
-	128,	// -------- wave 233 (e9h), sample 00
-	212,	// sample 01
-	228,	// sample 02
-	209,	// sample 03
-	193,	// sample 04
-	167,	// sample 05
-	109,	// sample 06
-	 59,	// sample 07
-	 70,	// sample 08
-	118,	// sample 09
-	138,	// sample 10
-	133,	// sample 11
-	145,	// sample 12
-	159,	// sample 13
-	138,	// sample 14
-	 99,	// sample 15
-	 98,	// sample 16
-	137,	// sample 17
-	159,	// sample 18
-	154,	// sample 19
-	156,	// sample 20
-	168,	// sample 21
-	158,	// sample 22
-	118,	// sample 23
-	 90,	// sample 24
-	 98,	// sample 25
-	109,	// sample 26
-	102,	// sample 27
-	101,	// sample 28
-	122,	// sample 29
-	136,	// sample 30
-	125,	// sample 31
-	113,	// sample 32
-	123,	// sample 33
-	138,	// sample 34
-	135,	// sample 35
-	130,	// sample 36
-	135,	// sample 37
-	137,	// sample 38
-	128,	// sample 39
-	114,	// sample 40
-	110,	// sample 41
-	117,	// sample 42
-	120,	// sample 43
-	121,	// sample 44
-	124,	// sample 45
-	131,	// sample 46
-	135,	// sample 47
-	134,	// sample 48
-	134,	// sample 49
-	140,	// sample 50
-	146,	// sample 51
-	150,	// sample 52
-	149,	// sample 53
-	146,	// sample 54
-	138,	// sample 55
-	133,	// sample 56
-	127,	// sample 57
-	121,	// sample 58
-	119,	// sample 59
-	124,	// sample 60
-	128,	// sample 61
-	128,	// sample 62
-	126,	// sample 63
-	128,	// -------- wave 234 (eah), sample 00
-	208,	// sample 01
-	238,	// sample 02
-	223,	// sample 03
-	188,	// sample 04
-	135,	// sample 05
-	 84,	// sample 06
-	 62,	// sample 07
-	 86,	// sample 08
-	125,	// sample 09
-	144,	// sample 10
-	143,	// sample 11
-	140,	// sample 12
-	125,	// sample 13
-	103,	// sample 14
-	103,	// sample 15
-	128,	// sample 16
-	162,	// sample 17
-	172,	// sample 18
-	166,	// sample 19
-	160,	// sample 20
-	145,	// sample 21
-	115,	// sample 22
-	 95,	// sample 23
-	 98,	// sample 24
-	110,	// sample 25
-	112,	// sample 26
-	112,	// sample 27
-	124,	// sample 28
-	129,	// sample 29
-	124,	// sample 30
-	120,	// sample 31
-	133,	// sample 32
-	145,	// sample 33
-	140,	// sample 34
-	130,	// sample 35
-	132,	// sample 36
-	130,	// sample 37
-	118,	// sample 38
-	107,	// sample 39
-	114,	// sample 40
-	124,	// sample 41
-	120,	// sample 42
-	117,	// sample 43
-	125,	// sample 44
-	136,	// sample 45
-	133,	// sample 46
-	134,	// sample 47
-	142,	// sample 48
-	151,	// sample 49
-	140,	// sample 50
-	130,	// sample 51
-	130,	// sample 52
-	134,	// sample 53
-	129,	// sample 54
-	121,	// sample 55
-	129,	// sample 56
-	137,	// sample 57
-	131,	// sample 58
-	125,	// sample 59
-	135,	// sample 60
-	140,	// sample 61
-	133,	// sample 62
-	125,	// sample 63
-	128,	// -------- wave 235 (ebh), sample 00
-	209,	// sample 01
-	238,	// sample 02
-	209,	// sample 03
-	142,	// sample 04
-	 87,	// sample 05
-	 74,	// sample 06
-	 99,	// sample 07
-	136,	// sample 08
-	157,	// sample 09
-	146,	// sample 10
-	123,	// sample 11
-	110,	// sample 12
-	121,	// sample 13
-	145,	// sample 14
-	170,	// sample 15
-	172,	// sample 16
-	150,	// sample 17
-	122,	// sample 18
-	105,	// sample 19
-	101,	// sample 20
-	108,	// sample 21
-	115,	// sample 22
-	119,	// sample 23
-	120,	// sample 24
-	123,	// sample 25
-	132,	// sample 26
-	141,	// sample 27
-	141,	// sample 28
-	134,	// sample 29
-	124,	// sample 30
-	113,	// sample 31
-	111,	// sample 32
-	114,	// sample 33
-	117,	// sample 34
-	120,	// sample 35
-	126,	// sample 36
-	128,	// sample 37
-	134,	// sample 38
-	139,	// sample 39
-	144,	// sample 40
-	143,	// sample 41
-	139,	// sample 42
-	129,	// sample 43
-	125,	// sample 44
-	122,	// sample 45
-	128,	// sample 46
-	128,	// sample 47
-	128,	// sample 48
-	127,	// sample 49
-	129,	// sample 50
-	133,	// sample 51
-	137,	// sample 52
-	139,	// sample 53
-	133,	// sample 54
-	124,	// sample 55
-	120,	// sample 56
-	120,	// sample 57
-	127,	// sample 58
-	132,	// sample 59
-	131,	// sample 60
-	127,	// sample 61
-	123,	// sample 62
-	123,	// sample 63
-	128,	// -------- wave 236 (ech), sample 00
-	222,	// sample 01
-	245,	// sample 02
-	196,	// sample 03
-	114,	// sample 04
-	 67,	// sample 05
-	 81,	// sample 06
-	125,	// sample 07
-	154,	// sample 08
-	147,	// sample 09
-	116,	// sample 10
-	100,	// sample 11
-	121,	// sample 12
-	155,	// sample 13
-	175,	// sample 14
-	166,	// sample 15
-	136,	// sample 16
-	108,	// sample 17
-	 98,	// sample 18
-	105,	// sample 19
-	113,	// sample 20
-	120,	// sample 21
-	122,	// sample 22
-	124,	// sample 23
-	133,	// sample 24
-	144,	// sample 25
-	142,	// sample 26
-	132,	// sample 27
-	121,	// sample 28
-	115,	// sample 29
-	115,	// sample 30
-	120,	// sample 31
-	121,	// sample 32
-	125,	// sample 33
-	127,	// sample 34
-	135,	// sample 35
-	142,	// sample 36
-	149,	// sample 37
-	142,	// sample 38
-	132,	// sample 39
-	127,	// sample 40
-	126,	// sample 41
-	130,	// sample 42
-	131,	// sample 43
-	130,	// sample 44
-	131,	// sample 45
-	131,	// sample 46
-	133,	// sample 47
-	137,	// sample 48
-	134,	// sample 49
-	126,	// sample 50
-	120,	// sample 51
-	118,	// sample 52
-	123,	// sample 53
-	127,	// sample 54
-	126,	// sample 55
-	123,	// sample 56
-	123,	// sample 57
-	123,	// sample 58
-	127,	// sample 59
-	128,	// sample 60
-	125,	// sample 61
-	119,	// sample 62
-	122,	// sample 63
-	128,	// -------- wave 237 (edh), sample 00
-	239,	// sample 01
-	252,	// sample 02
-	170,	// sample 03
-	 85,	// sample 04
-	 63,	// sample 05
-	109,	// sample 06
-	156,	// sample 07
-	156,	// sample 08
-	122,	// sample 09
-	105,	// sample 10
-	129,	// sample 11
-	169,	// sample 12
-	183,	// sample 13
-	154,	// sample 14
-	110,	// sample 15
-	 90,	// sample 16
-	 97,	// sample 17
-	115,	// sample 18
-	122,	// sample 19
-	122,	// sample 20
-	125,	// sample 21
-	135,	// sample 22
-	142,	// sample 23
-	135,	// sample 24
-	120,	// sample 25
-	110,	// sample 26
-	108,	// sample 27
-	119,	// sample 28
-	125,	// sample 29
-	125,	// sample 30
-	130,	// sample 31
-	136,	// sample 32
-	146,	// sample 33
-	151,	// sample 34
-	139,	// sample 35
-	130,	// sample 36
-	120,	// sample 37
-	126,	// sample 38
-	133,	// sample 39
-	135,	// sample 40
-	134,	// sample 41
-	133,	// sample 42
-	136,	// sample 43
-	138,	// sample 44
-	133,	// sample 45
-	126,	// sample 46
-	122,	// sample 47
-	122,	// sample 48
-	127,	// sample 49
-	126,	// sample 50
-	123,	// sample 51
-	124,	// sample 52
-	125,	// sample 53
-	131,	// sample 54
-	133,	// sample 55
-	127,	// sample 56
-	123,	// sample 57
-	123,	// sample 58
-	124,	// sample 59
-	128,	// sample 60
-	128,	// sample 61
-	124,	// sample 62
-	127,	// sample 63
-	128,	// -------- wave 238 (eeh), sample 00
-	207,	// sample 01
-	203,	// sample 02
-	132,	// sample 03
-	 82,	// sample 04
-	 97,	// sample 05
-	138,	// sample 06
-	146,	// sample 07
-	120,	// sample 08
-	110,	// sample 09
-	135,	// sample 10
-	162,	// sample 11
-	161,	// sample 12
-	133,	// sample 13
-	108,	// sample 14
-	106,	// sample 15
-	116,	// sample 16
-	122,	// sample 17
-	124,	// sample 18
-	130,	// sample 19
-	137,	// sample 20
-	139,	// sample 21
-	129,	// sample 22
-	119,	// sample 23
-	117,	// sample 24
-	121,	// sample 25
-	125,	// sample 26
-	128,	// sample 27
-	133,	// sample 28
-	138,	// sample 29
-	144,	// sample 30
-	136,	// sample 31
-	129,	// sample 32
-	126,	// sample 33
-	126,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	133,	// sample 39
-	130,	// sample 40
-	127,	// sample 41
-	124,	// sample 42
-	124,	// sample 43
-	127,	// sample 44
-	124,	// sample 45
-	120,	// sample 46
-	123,	// sample 47
-	126,	// sample 48
-	129,	// sample 49
-	127,	// sample 50
-	127,	// sample 51
-	129,	// sample 52
-	134,	// sample 53
-	132,	// sample 54
-	131,	// sample 55
-	126,	// sample 56
-	128,	// sample 57
-	130,	// sample 58
-	132,	// sample 59
-	128,	// sample 60
-	131,	// sample 61
-	132,	// sample 62
-	134,	// sample 63
-	128,	// -------- wave 239 (efh), sample 00
-	207,	// sample 01
-	203,	// sample 02
-	132,	// sample 03
-	 82,	// sample 04
-	 97,	// sample 05
-	138,	// sample 06
-	146,	// sample 07
-	120,	// sample 08
-	110,	// sample 09
-	135,	// sample 10
-	162,	// sample 11
-	161,	// sample 12
-	133,	// sample 13
-	108,	// sample 14
-	106,	// sample 15
-	116,	// sample 16
-	122,	// sample 17
-	124,	// sample 18
-	130,	// sample 19
-	137,	// sample 20
-	139,	// sample 21
-	129,	// sample 22
-	119,	// sample 23
-	117,	// sample 24
-	121,	// sample 25
-	125,	// sample 26
-	128,	// sample 27
-	133,	// sample 28
-	138,	// sample 29
-	144,	// sample 30
-	136,	// sample 31
-	129,	// sample 32
-	126,	// sample 33
-	126,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	133,	// sample 39
-	130,	// sample 40
-	127,	// sample 41
-	124,	// sample 42
-	124,	// sample 43
-	127,	// sample 44
-	124,	// sample 45
-	120,	// sample 46
-	123,	// sample 47
-	126,	// sample 48
-	129,	// sample 49
-	127,	// sample 50
-	127,	// sample 51
-	129,	// sample 52
-	134,	// sample 53
-	132,	// sample 54
-	131,	// sample 55
-	126,	// sample 56
-	128,	// sample 57
-	130,	// sample 58
-	132,	// sample 59
-	128,	// sample 60
-	131,	// sample 61
-	132,	// sample 62
-	134,	// sample 63
-	128,	// -------- wave 240 (f0h), sample 00
-	207,	// sample 01
-	203,	// sample 02
-	132,	// sample 03
-	 82,	// sample 04
-	 97,	// sample 05
-	138,	// sample 06
-	146,	// sample 07
-	120,	// sample 08
-	110,	// sample 09
-	135,	// sample 10
-	162,	// sample 11
-	161,	// sample 12
-	133,	// sample 13
-	108,	// sample 14
-	106,	// sample 15
-	116,	// sample 16
-	122,	// sample 17
-	124,	// sample 18
-	130,	// sample 19
-	137,	// sample 20
-	139,	// sample 21
-	129,	// sample 22
-	119,	// sample 23
-	117,	// sample 24
-	121,	// sample 25
-	125,	// sample 26
-	128,	// sample 27
-	133,	// sample 28
-	138,	// sample 29
-	144,	// sample 30
-	136,	// sample 31
-	129,	// sample 32
-	126,	// sample 33
-	126,	// sample 34
-	128,	// sample 35
-	128,	// sample 36
-	128,	// sample 37
-	128,	// sample 38
-	133,	// sample 39
-	130,	// sample 40
-	127,	// sample 41
-	124,	// sample 42
-	124,	// sample 43
-	127,	// sample 44
-	124,	// sample 45
-	120,	// sample 46
-	123,	// sample 47
-	126,	// sample 48
-	129,	// sample 49
-	127,	// sample 50
-	127,	// sample 51
-	129,	// sample 52
-	134,	// sample 53
-	132,	// sample 54
-	131,	// sample 55
-	126,	// sample 56
-	128,	// sample 57
-	130,	// sample 58
-	132,	// sample 59
-	128,	// sample 60
-	131,	// sample 61
-	132,	// sample 62
-	134,	// sample 63
-	 26,	// -------- wave 241 (f1h), sample 00
-	 16,	// sample 01
-	 16,	// sample 02
-	206,	// sample 03
-	  2,	// sample 04
-	  0,	// sample 05
-	150,	// sample 06
-	  8,	// sample 07
-	142,	// sample 08
-	  3,	// sample 09
-	255,	// sample 10
-	111,	// sample 11
-	132,	// sample 12
-	 48,	// sample 13
-	 31,	// sample 14
-	 38,	// sample 15
-	250,	// sample 16
-	111,	// sample 17
-	132,	// sample 18
-	151,	// sample 19
-	  8,	// sample 20
-	189,	// sample 21
-	193,	// sample 22
-	 66,	// sample 23
-	127,	// sample 24
-	176,	// sample 25
-	 43,	// sample 26
-	127,	// sample 27
-	176,	// sample 28
-	 42,	// sample 29
-	134,	// sample 30
-	  4,	// sample 31
-	183,	// sample 32
-	176,	// sample 33
-	 43,	// sample 34
-	141,	// sample 35
-	 75,	// sample 36
-	134,	// sample 37
-	223,	// sample 38
-	183,	// sample 39
-	176,	// sample 40
-	113,	// sample 41
-	134,	// sample 42
-	255,	// sample 43
-	183,	// sample 44
-	  2,	// sample 45
-	 41,	// sample 46
-	134,	// sample 47
-	 99,	// sample 48
-	151,	// sample 49
-	 20,	// sample 50
-	134,	// sample 51
-	 30,	// sample 52
-	138,	// sample 53
-	128,	// sample 54
-	151,	// sample 55
-	 66,	// sample 56
-	182,	// sample 57
-	176,	// sample 58
-	112,	// sample 59
-	133,	// sample 60
-	  4,	// sample 61
-	 39,	// sample 62
-	  6,	// sample 63
-	127,	// -------- wave 242 (f2h), sample 00
-	 60,	// sample 01
-	 12,	// sample 02
-	124,	// sample 03
-	  2,	// sample 04
-	107,	// sample 05
-	189,	// sample 06
-	215,	// sample 07
-	  3,	// sample 08
-	189,	// sample 09
-	207,	// sample 10
-	  0,	// sample 11
-	189,	// sample 12
-	196,	// sample 13
-	  0,	// sample 14
-	189,	// sample 15
-	225,	// sample 16
-	 21,	// sample 17
-	189,	// sample 18
-	174,	// sample 19
-	  0,	// sample 20
-	150,	// sample 21
-	 67,	// sample 22
-	133,	// sample 23
-	128,	// sample 24
-	 39,	// sample 25
-	 10,	// sample 26
-	150,	// sample 27
-	 46,	// sample 28
-	 52,	// sample 29
-	  2,	// sample 30
-	141,	// sample 31
-	 67,	// sample 32
-	 53,	// sample 33
-	  2,	// sample 34
-	151,	// sample 35
-	 46,	// sample 36
-	189,	// sample 37
-	236,	// sample 38
-	  0,	// sample 39
-	189,	// sample 40
-	208,	// sample 41
-	  0,	// sample 42
-	189,	// sample 43
-	210,	// sample 44
-	  0,	// sample 45
-	 32,	// sample 46
-	214,	// sample 47
-	 26,	// sample 48
-	 16,	// sample 49
-	190,	// sample 50
-	239,	// sample 51
-	248,	// sample 52
-	191,	// sample 53
-	191,	// sample 54
-	150,	// sample 55
-	134,	// sample 56
-	129,	// sample 57
-	183,	// sample 58
-	176,	// sample 59
-	 81,	// sample 60
-	198,	// sample 61
-	208,	// sample 62
-	247,	// sample 63
-	176,	// -------- wave 243 (f3h), sample 00
-	 80,	// sample 01
-	134,	// sample 02
-	128,	// sample 03
-	183,	// sample 04
-	176,	// sample 05
-	 81,	// sample 06
-	198,	// sample 07
-	146,	// sample 08
-	247,	// sample 09
-	176,	// sample 10
-	 80,	// sample 11
-	134,	// sample 12
-	160,	// sample 13
-	183,	// sample 14
-	176,	// sample 15
-	126,	// sample 16
-	134,	// sample 17
-	113,	// sample 18
-	183,	// sample 19
-	176,	// sample 20
-	114,	// sample 21
-	134,	// sample 22
-	128,	// sample 23
-	183,	// sample 24
-	176,	// sample 25
-	112,	// sample 26
-	134,	// sample 27
-	  0,	// sample 28
-	183,	// sample 29
-	176,	// sample 30
-	 37,	// sample 31
-	141,	// sample 32
-	  2,	// sample 33
-	 32,	// sample 34
-	 45,	// sample 35
-	 79,	// sample 36
-	142,	// sample 37
-	  0,	// sample 38
-	224,	// sample 39
-	141,	// sample 40
-	 27,	// sample 41
-	142,	// sample 42
-	  0,	// sample 43
-	136,	// sample 44
-	141,	// sample 45
-	 22,	// sample 46
-	142,	// sample 47
-	  0,	// sample 48
-	248,	// sample 49
-	141,	// sample 50
-	 17,	// sample 51
-	134,	// sample 52
-	 64,	// sample 53
-	142,	// sample 54
-	  0,	// sample 55
-	152,	// sample 56
-	141,	// sample 57
-	 10,	// sample 58
-	142,	// sample 59
-	  0,	// sample 60
-	232,	// sample 61
-	141,	// sample 62
-	  5,	// sample 63
-	122,	// -------- wave 244 (f4h), sample 00
-	121,	// sample 01
-	121,	// sample 02
-	122,	// sample 03
-	123,	// sample 04
-	123,	// sample 05
-	123,	// sample 06
-	124,	// sample 07
-	124,	// sample 08
-	125,	// sample 09
-	125,	// sample 10
-	125,	// sample 11
-	125,	// sample 12
-	126,	// sample 13
-	126,	// sample 14
-	126,	// sample 15
-	126,	// sample 16
-	125,	// sample 17
-	126,	// sample 18
-	126,	// sample 19
-	127,	// sample 20
-	127,	// sample 21
-	127,	// sample 22
-	127,	// sample 23
-	127,	// sample 24
-	126,	// sample 25
-	125,	// sample 26
-	125,	// sample 27
-	124,	// sample 28
-	124,	// sample 29
-	123,	// sample 30
-	123,	// sample 31
-	123,	// sample 32
-	123,	// sample 33
-	124,	// sample 34
-	124,	// sample 35
-	125,	// sample 36
-	125,	// sample 37
-	125,	// sample 38
-	125,	// sample 39
-	125,	// sample 40
-	124,	// sample 41
-	123,	// sample 42
-	125,	// sample 43
-	125,	// sample 44
-	120,	// sample 45
-	119,	// sample 46
-	123,	// sample 47
-	125,	// sample 48
-	121,	// sample 49
-	119,	// sample 50
-	124,	// sample 51
-	127,	// sample 52
-	118,	// sample 53
-	113,	// sample 54
-	119,	// sample 55
-	125,	// sample 56
-	117,	// sample 57
-	104,	// sample 58
-	113,	// sample 59
-	120,	// sample 60
-	119,	// sample 61
-	117,	// sample 62
-	119,	// sample 63
-	115,	// -------- wave 245 (f5h), sample 00
-	101,	// sample 01
-	 94,	// sample 02
-	 86,	// sample 03
-	 91,	// sample 04
-	109,	// sample 05
-	120,	// sample 06
-	129,	// sample 07
-	130,	// sample 08
-	121,	// sample 09
-	131,	// sample 10
-	148,	// sample 11
-	150,	// sample 12
-	141,	// sample 13
-	131,	// sample 14
-	136,	// sample 15
-	169,	// sample 16
-	181,	// sample 17
-	160,	// sample 18
-	134,	// sample 19
-	123,	// sample 20
-	103,	// sample 21
-	 84,	// sample 22
-	 71,	// sample 23
-	 75,	// sample 24
-	 72,	// sample 25
-	 84,	// sample 26
-	104,	// sample 27
-	108,	// sample 28
-	107,	// sample 29
-	134,	// sample 30
-	181,	// sample 31
-	197,	// sample 32
-	183,	// sample 33
-	184,	// sample 34
-	204,	// sample 35
-	212,	// sample 36
-	203,	// sample 37
-	201,	// sample 38
-	186,	// sample 39
-	161,	// sample 40
-	155,	// sample 41
-	169,	// sample 42
-	168,	// sample 43
-	151,	// sample 44
-	120,	// sample 45
-	106,	// sample 46
-	 97,	// sample 47
-	100,	// sample 48
-	 84,	// sample 49
-	 74,	// sample 50
-	 96,	// sample 51
-	111,	// sample 52
-	117,	// sample 53
-	104,	// sample 54
-	 90,	// sample 55
-	 63,	// sample 56
-	 46,	// sample 57
-	 52,	// sample 58
-	 73,	// sample 59
-	 79,	// sample 60
-	 65,	// sample 61
-	 45,	// sample 62
-	 37,	// sample 63
-	 24,	// -------- wave 246 (f6h), sample 00
-	 14,	// sample 01
-	 23,	// sample 02
-	  8,	// sample 03
-	  7,	// sample 04
-	 43,	// sample 05
-	 73,	// sample 06
-	 76,	// sample 07
-	 62,	// sample 08
-	 77,	// sample 09
-	110,	// sample 10
-	141,	// sample 11
-	168,	// sample 12
-	189,	// sample 13
-	213,	// sample 14
-	222,	// sample 15
-	218,	// sample 16
-	226,	// sample 17
-	225,	// sample 18
-	225,	// sample 19
-	223,	// sample 20
-	223,	// sample 21
-	212,	// sample 22
-	164,	// sample 23
-	134,	// sample 24
-	147,	// sample 25
-	156,	// sample 26
-	133,	// sample 27
-	 97,	// sample 28
-	 91,	// sample 29
-	118,	// sample 30
-	122,	// sample 31
-	106,	// sample 32
-	 84,	// sample 33
-	 75,	// sample 34
-	103,	// sample 35
-	145,	// sample 36
-	188,	// sample 37
-	192,	// sample 38
-	160,	// sample 39
-	152,	// sample 40
-	166,	// sample 41
-	198,	// sample 42
-	203,	// sample 43
-	197,	// sample 44
-	181,	// sample 45
-	145,	// sample 46
-	120,	// sample 47
-	118,	// sample 48
-	126,	// sample 49
-	130,	// sample 50
-	141,	// sample 51
-	162,	// sample 52
-	139,	// sample 53
-	 89,	// sample 54
-	 53,	// sample 55
-	 45,	// sample 56
-	 49,	// sample 57
-	 35,	// sample 58
-	 23,	// sample 59
-	 49,	// sample 60
-	 42,	// sample 61
-	  4,	// sample 62
-	  0,	// sample 63
-	  0,	// -------- wave 247 (f7h), sample 00
-	  0,	// sample 01
-	  0,	// sample 02
-	  0,	// sample 03
-	 19,	// sample 04
-	 62,	// sample 05
-	 53,	// sample 06
-	 21,	// sample 07
-	 31,	// sample 08
-	 70,	// sample 09
-	121,	// sample 10
-	172,	// sample 11
-	219,	// sample 12
-	228,	// sample 13
-	228,	// sample 14
-	227,	// sample 15
-	220,	// sample 16
-	223,	// sample 17
-	225,	// sample 18
-	224,	// sample 19
-	223,	// sample 20
-	218,	// sample 21
-	190,	// sample 22
-	140,	// sample 23
-	 89,	// sample 24
-	 62,	// sample 25
-	 71,	// sample 26
-	 69,	// sample 27
-	 50,	// sample 28
-	 51,	// sample 29
-	 73,	// sample 30
-	 83,	// sample 31
-	 40,	// sample 32
-	  1,	// sample 33
-	 29,	// sample 34
-	103,	// sample 35
-	183,	// sample 36
-	201,	// sample 37
-	198,	// sample 38
-	219,	// sample 39
-	224,	// sample 40
-	224,	// sample 41
-	222,	// sample 42
-	221,	// sample 43
-	221,	// sample 44
-	220,	// sample 45
-	212,	// sample 46
-	191,	// sample 47
-	168,	// sample 48
-	144,	// sample 49
-	129,	// sample 50
-	155,	// sample 51
-	178,	// sample 52
-	143,	// sample 53
-	 89,	// sample 54
-	 57,	// sample 55
-	 50,	// sample 56
-	 46,	// sample 57
-	 45,	// sample 58
-	 53,	// sample 59
-	 47,	// sample 60
-	 28,	// sample 61
-	  6,	// sample 62
-	  0,	// sample 63
-	  0,	// -------- wave 248 (f8h), sample 00
-	  0,	// sample 01
-	  0,	// sample 02
-	  0,	// sample 03
-	 24,	// sample 04
-	 51,	// sample 05
-	 48,	// sample 06
-	 39,	// sample 07
-	 58,	// sample 08
-	 98,	// sample 09
-	145,	// sample 10
-	185,	// sample 11
-	215,	// sample 12
-	230,	// sample 13
-	229,	// sample 14
-	217,	// sample 15
-	201,	// sample 16
-	223,	// sample 17
-	226,	// sample 18
-	225,	// sample 19
-	224,	// sample 20
-	211,	// sample 21
-	181,	// sample 22
-	139,	// sample 23
-	 86,	// sample 24
-	 64,	// sample 25
-	 61,	// sample 26
-	 47,	// sample 27
-	 45,	// sample 28
-	 61,	// sample 29
-	 91,	// sample 30
-	 77,	// sample 31
-	 24,	// sample 32
-	 29,	// sample 33
-	 99,	// sample 34
-	169,	// sample 35
-	184,	// sample 36
-	187,	// sample 37
-	220,	// sample 38
-	225,	// sample 39
-	225,	// sample 40
-	224,	// sample 41
-	223,	// sample 42
-	222,	// sample 43
-	222,	// sample 44
-	216,	// sample 45
-	187,	// sample 46
-	163,	// sample 47
-	147,	// sample 48
-	146,	// sample 49
-	162,	// sample 50
-	170,	// sample 51
-	162,	// sample 52
-	136,	// sample 53
-	 96,	// sample 54
-	 64,	// sample 55
-	 76,	// sample 56
-	 99,	// sample 57
-	102,	// sample 58
-	 88,	// sample 59
-	 80,	// sample 60
-	 72,	// sample 61
-	 42,	// sample 62
-	  7,	// sample 63
-	  0,	// -------- wave 249 (f9h), sample 00
-	  0,	// sample 01
-	  0,	// sample 02
-	  0,	// sample 03
-	 27,	// sample 04
-	 30,	// sample 05
-	  5,	// sample 06
-	  2,	// sample 07
-	 23,	// sample 08
-	 55,	// sample 09
-	 93,	// sample 10
-	141,	// sample 11
-	199,	// sample 12
-	214,	// sample 13
-	197,	// sample 14
-	182,	// sample 15
-	209,	// sample 16
-	228,	// sample 17
-	227,	// sample 18
-	227,	// sample 19
-	225,	// sample 20
-	224,	// sample 21
-	209,	// sample 22
-	166,	// sample 23
-	128,	// sample 24
-	102,	// sample 25
-	 70,	// sample 26
-	 60,	// sample 27
-	 82,	// sample 28
-	115,	// sample 29
-	 83,	// sample 30
-	 24,	// sample 31
-	  8,	// sample 32
-	 39,	// sample 33
-	 79,	// sample 34
-	107,	// sample 35
-	117,	// sample 36
-	147,	// sample 37
-	172,	// sample 38
-	182,	// sample 39
-	188,	// sample 40
-	213,	// sample 41
-	225,	// sample 42
-	224,	// sample 43
-	224,	// sample 44
-	208,	// sample 45
-	175,	// sample 46
-	173,	// sample 47
-	186,	// sample 48
-	183,	// sample 49
-	187,	// sample 50
-	201,	// sample 51
-	197,	// sample 52
-	155,	// sample 53
-	109,	// sample 54
-	111,	// sample 55
-	130,	// sample 56
-	128,	// sample 57
-	112,	// sample 58
-	104,	// sample 59
-	105,	// sample 60
-	 72,	// sample 61
-	 23,	// sample 62
-	  0,	// sample 63
-	  0,	// -------- wave 250 (fah), sample 00
-	  0,	// sample 01
-	  0,	// sample 02
-	  3,	// sample 03
-	  9,	// sample 04
-	  0,	// sample 05
-	  0,	// sample 06
-	  0,	// sample 07
-	  7,	// sample 08
-	 38,	// sample 09
-	 85,	// sample 10
-	142,	// sample 11
-	180,	// sample 12
-	190,	// sample 13
-	190,	// sample 14
-	205,	// sample 15
-	228,	// sample 16
-	228,	// sample 17
-	227,	// sample 18
-	227,	// sample 19
-	225,	// sample 20
-	225,	// sample 21
-	224,	// sample 22
-	192,	// sample 23
-	140,	// sample 24
-	 79,	// sample 25
-	 68,	// sample 26
-	102,	// sample 27
-	112,	// sample 28
-	 84,	// sample 29
-	 40,	// sample 30
-	 18,	// sample 31
-	 21,	// sample 32
-	 42,	// sample 33
-	 73,	// sample 34
-	107,	// sample 35
-	127,	// sample 36
-	137,	// sample 37
-	162,	// sample 38
-	185,	// sample 39
-	191,	// sample 40
-	202,	// sample 41
-	225,	// sample 42
-	225,	// sample 43
-	210,	// sample 44
-	172,	// sample 45
-	168,	// sample 46
-	172,	// sample 47
-	154,	// sample 48
-	153,	// sample 49
-	172,	// sample 50
-	178,	// sample 51
-	147,	// sample 52
-	100,	// sample 53
-	 89,	// sample 54
-	 99,	// sample 55
-	102,	// sample 56
-	101,	// sample 57
-	 92,	// sample 58
-	106,	// sample 59
-	109,	// sample 60
-	 80,	// sample 61
-	 23,	// sample 62
-	  0,	// sample 63
-	  0,	// -------- wave 251 (fbh), sample 00
-	  0,	// sample 01
-	  3,	// sample 02
-	 15,	// sample 03
-	 17,	// sample 04
-	  9,	// sample 05
-	  2,	// sample 06
-	  0,	// sample 07
-	 13,	// sample 08
-	 60,	// sample 09
-	108,	// sample 10
-	139,	// sample 11
-	162,	// sample 12
-	179,	// sample 13
-	185,	// sample 14
-	211,	// sample 15
-	230,	// sample 16
-	230,	// sample 17
-	229,	// sample 18
-	229,	// sample 19
-	228,	// sample 20
-	227,	// sample 21
-	226,	// sample 22
-	185,	// sample 23
-	118,	// sample 24
-	107,	// sample 25
-	143,	// sample 26
-	153,	// sample 27
-	127,	// sample 28
-	 96,	// sample 29
-	 78,	// sample 30
-	 57,	// sample 31
-	 43,	// sample 32
-	 67,	// sample 33
-	106,	// sample 34
-	119,	// sample 35
-	128,	// sample 36
-	154,	// sample 37
-	178,	// sample 38
-	179,	// sample 39
-	186,	// sample 40
-	220,	// sample 41
-	226,	// sample 42
-	219,	// sample 43
-	190,	// sample 44
-	160,	// sample 45
-	151,	// sample 46
-	139,	// sample 47
-	140,	// sample 48
-	151,	// sample 49
-	157,	// sample 50
-	152,	// sample 51
-	117,	// sample 52
-	 91,	// sample 53
-	 88,	// sample 54
-	105,	// sample 55
-	108,	// sample 56
-	 96,	// sample 57
-	112,	// sample 58
-	138,	// sample 59
-	127,	// sample 60
-	 72,	// sample 61
-	 23,	// sample 62
-	 11,	// sample 63
-	 17,	// -------- wave 252 (fch), sample 00
-	 15,	// sample 01
-	 19,	// sample 02
-	 35,	// sample 03
-	 41,	// sample 04
-	 14,	// sample 05
-	  0,	// sample 06
-	  0,	// sample 07
-	 19,	// sample 08
-	 66,	// sample 09
-	 97,	// sample 10
-	113,	// sample 11
-	142,	// sample 12
-	164,	// sample 13
-	169,	// sample 14
-	206,	// sample 15
-	230,	// sample 16
-	230,	// sample 17
-	230,	// sample 18
-	229,	// sample 19
-	228,	// sample 20
-	227,	// sample 21
-	226,	// sample 22
-	156,	// sample 23
-	127,	// sample 24
-	153,	// sample 25
-	163,	// sample 26
-	146,	// sample 27
-	129,	// sample 28
-	108,	// sample 29
-	 80,	// sample 30
-	 52,	// sample 31
-	 53,	// sample 32
-	 78,	// sample 33
-	 96,	// sample 34
-	124,	// sample 35
-	135,	// sample 36
-	151,	// sample 37
-	167,	// sample 38
-	181,	// sample 39
-	202,	// sample 40
-	215,	// sample 41
-	225,	// sample 42
-	219,	// sample 43
-	188,	// sample 44
-	155,	// sample 45
-	148,	// sample 46
-	154,	// sample 47
-	155,	// sample 48
-	152,	// sample 49
-	155,	// sample 50
-	136,	// sample 51
-	105,	// sample 52
-	 87,	// sample 53
-	 82,	// sample 54
-	 83,	// sample 55
-	 79,	// sample 56
-	 82,	// sample 57
-	103,	// sample 58
-	114,	// sample 59
-	 84,	// sample 60
-	 32,	// sample 61
-	  9,	// sample 62
-	  6,	// sample 63
-	  6,	// -------- wave 253 (fdh), sample 00
-	  8,	// sample 01
-	 27,	// sample 02
-	 44,	// sample 03
-	 38,	// sample 04
-	  9,	// sample 05
-	  0,	// sample 06
-	  3,	// sample 07
-	 44,	// sample 08
-	 76,	// sample 09
-	104,	// sample 10
-	131,	// sample 11
-	146,	// sample 12
-	155,	// sample 13
-	191,	// sample 14
-	227,	// sample 15
-	233,	// sample 16
-	232,	// sample 17
-	232,	// sample 18
-	231,	// sample 19
-	229,	// sample 20
-	229,	// sample 21
-	206,	// sample 22
-	159,	// sample 23
-	152,	// sample 24
-	158,	// sample 25
-	161,	// sample 26
-	149,	// sample 27
-	115,	// sample 28
-	 94,	// sample 29
-	 73,	// sample 30
-	 46,	// sample 31
-	 38,	// sample 32
-	 64,	// sample 33
-	102,	// sample 34
-	111,	// sample 35
-	113,	// sample 36
-	138,	// sample 37
-	166,	// sample 38
-	177,	// sample 39
-	188,	// sample 40
-	217,	// sample 41
-	226,	// sample 42
-	217,	// sample 43
-	185,	// sample 44
-	160,	// sample 45
-	165,	// sample 46
-	174,	// sample 47
-	168,	// sample 48
-	162,	// sample 49
-	161,	// sample 50
-	151,	// sample 51
-	127,	// sample 52
-	107,	// sample 53
-	 98,	// sample 54
-	 93,	// sample 55
-	 94,	// sample 56
-	108,	// sample 57
-	119,	// sample 58
-	115,	// sample 59
-	 78,	// sample 60
-	 32,	// sample 61
-	  9,	// sample 62
-	  4,	// sample 63
-	  2,	// -------- wave 254 (feh), sample 00
-	 13,	// sample 01
-	 42,	// sample 02
-	 51,	// sample 03
-	 23,	// sample 04
-	  0,	// sample 05
-	  0,	// sample 06
-	  7,	// sample 07
-	 50,	// sample 08
-	 89,	// sample 09
-	103,	// sample 10
-	112,	// sample 11
-	132,	// sample 12
-	175,	// sample 13
-	213,	// sample 14
-	230,	// sample 15
-	232,	// sample 16
-	231,	// sample 17
-	230,	// sample 18
-	229,	// sample 19
-	228,	// sample 20
-	228,	// sample 21
-	190,	// sample 22
-	144,	// sample 23
-	148,	// sample 24
-	164,	// sample 25
-	151,	// sample 26
-	123,	// sample 27
-	111,	// sample 28
-	 96,	// sample 29
-	 55,	// sample 30
-	 26,	// sample 31
-	 41,	// sample 32
-	 81,	// sample 33
-	 94,	// sample 34
-	 91,	// sample 35
-	113,	// sample 36
-	141,	// sample 37
-	159,	// sample 38
-	167,	// sample 39
-	192,	// sample 40
-	222,	// sample 41
-	226,	// sample 42
-	200,	// sample 43
-	167,	// sample 44
-	161,	// sample 45
-	174,	// sample 46
-	174,	// sample 47
-	162,	// sample 48
-	155,	// sample 49
-	157,	// sample 50
-	154,	// sample 51
-	123,	// sample 52
-	 93,	// sample 53
-	 86,	// sample 54
-	 95,	// sample 55
-	101,	// sample 56
-	112,	// sample 57
-	119,	// sample 58
-	107,	// sample 59
-	 75,	// sample 60
-	 32,	// sample 61
-	  8,	// sample 62
-	  3,	// sample 63
-	 21,	// -------- wave 255 (ffh), sample 00
-	 38,	// sample 01
-	 53,	// sample 02
-	 54,	// sample 03
-	 27,	// sample 04
-	  3,	// sample 05
-	  0,	// sample 06
-	 29,	// sample 07
-	 80,	// sample 08
-	 90,	// sample 09
-	 80,	// sample 10
-	101,	// sample 11
-	156,	// sample 12
-	187,	// sample 13
-	190,	// sample 14
-	212,	// sample 15
-	231,	// sample 16
-	231,	// sample 17
-	230,	// sample 18
-	229,	// sample 19
-	228,	// sample 20
-	212,	// sample 21
-	174,	// sample 22
-	162,	// sample 23
-	167,	// sample 24
-	163,	// sample 25
-	146,	// sample 26
-	143,	// sample 27
-	122,	// sample 28
-	 80,	// sample 29
-	 47,	// sample 30
-	 43,	// sample 31
-	 67,	// sample 32
-	 88,	// sample 33
-	 92,	// sample 34
-	101,	// sample 35
-	122,	// sample 36
-	145,	// sample 37
-	157,	// sample 38
-	176,	// sample 39
-	209,	// sample 40
-	225,	// sample 41
-	216,	// sample 42
-	182,	// sample 43
-	162,	// sample 44
-	173,	// sample 45
-	180,	// sample 46
-	161,	// sample 47
-	149,	// sample 48
-	159,	// sample 49
-	164,	// sample 50
-	145,	// sample 51
-	108,	// sample 52
-	 87,	// sample 53
-	 89,	// sample 54
-	103,	// sample 55
-	101,	// sample 56
-	104,	// sample 57
-	122,	// sample 58
-	 99,	// sample 59
-	 50,	// sample 60
-	  8,	// sample 61
-	  1,	// sample 62
-	 10,	// sample 63
-};
-
-
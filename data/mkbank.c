@@ -0,0 +1,119 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ppg_data.h"
+#include "ppg_bank.h"
+
+/**
+	\file mkbank.c
+	\author Jacek Wieczorek
+
+	\brief Builds a wavetable bank file (see ppg_bank.h) from ppg_rom.bin
+
+	Usage: mkbank ROM BANK
+*/
+
+//! Number of samples in a single waveform
+#define WAVEFORM_SIZE 64
+
+//! Rounds up to a multiple of PPG_BANK_ALIGNMENT
+#define BANK_ALIGN( x ) ( ( ( x ) + PPG_BANK_ALIGNMENT - 1 ) / PPG_BANK_ALIGNMENT * PPG_BANK_ALIGNMENT )
+
+//! Offsets of the blocks in the bank
+#define BANK_INDEX_OFFSET sizeof( struct ppg_bank_header )
+#define BANK_WAVETABLES_OFFSET ( BANK_INDEX_OFFSET + PPG_ROM_WAVETABLE_COUNT * sizeof( uint32_t ) )
+#define BANK_WAVEFORMS_OFFSET BANK_ALIGN( BANK_WAVETABLES_OFFSET + PPG_ROM_WAVETABLE_SIZE )
+#define BANK_SIZE ( BANK_WAVEFORMS_OFFSET + PPG_ROM_WAVEFORMS_SIZE )
+
+//! Returns length of a wavetable definition in the ROM format
+static unsigned int wavetable_length( const uint8_t *data, unsigned int wavetable_size )
+{
+	const uint8_t *p = data + 1;
+	unsigned int pos;
+	do
+	{
+		pos = p[1];
+		p += 2;
+	}
+	while ( pos < wavetable_size - 1 );
+
+	return p - data;
+}
+
+int main( int argc, char **argv )
+{
+	static uint8_t rom[PPG_ROM_SIZE + 1];
+	static uint8_t bank[BANK_SIZE];
+
+	if ( argc != 3 )
+	{
+		fprintf( stderr, "Usage: %s ROM BANK\n", argv[0] );
+		return 1;
+	}
+
+	FILE *f = fopen( argv[1], "rb" );
+	if ( f == NULL )
+	{
+		perror( "could not open ROM" );
+		return 1;
+	}
+
+	// Reading one more byte than expected detects oversized files
+	size_t size = fread( rom, 1, sizeof( rom ), f );
+	fclose( f );
+	if ( size != PPG_ROM_SIZE )
+	{
+		fprintf( stderr, "invalid ROM size (%zu bytes, expected %d)\n", size, PPG_ROM_SIZE );
+		return 1;
+	}
+
+	struct ppg_bank_header h =
+	{
+		.magic = PPG_BANK_MAGIC,
+		.version = PPG_BANK_VERSION,
+		.header_size = sizeof( struct ppg_bank_header ),
+		.file_size = BANK_SIZE,
+		.wavetable_count = PPG_ROM_WAVETABLE_COUNT,
+		.wavetable_size = PPG_ROM_WAVETABLE_SLOTS,
+		.index_offset = BANK_INDEX_OFFSET,
+		.wavetables_offset = BANK_WAVETABLES_OFFSET,
+		.wavetables_length = PPG_ROM_WAVETABLE_SIZE,
+		.waveform_count = PPG_ROM_WAVEFORMS_SIZE / WAVEFORM_SIZE,
+		.waveform_size = WAVEFORM_SIZE,
+		.waveforms_offset = BANK_WAVEFORMS_OFFSET,
+	};
+	memcpy( bank, &h, sizeof( h ) );
+
+	// The whole definition block is copied, the index points at each wavetable in it
+	const uint8_t *wavetables = rom + PPG_ROM_WAVETABLE_OFFSET;
+	unsigned int offset = 0;
+	for ( unsigned int i = 0; i < PPG_ROM_WAVETABLE_COUNT; i++ )
+	{
+		uint32_t entry = BANK_WAVETABLES_OFFSET + offset;
+		memcpy( bank + BANK_INDEX_OFFSET + i * sizeof( uint32_t ), &entry, sizeof( entry ) );
+		offset += wavetable_length( wavetables + offset, PPG_ROM_WAVETABLE_SLOTS );
+		if ( offset > PPG_ROM_WAVETABLE_SIZE )
+		{
+			fprintf( stderr, "wavetable %u exceeds the ROM wavetable data\n", i );
+			return 1;
+		}
+	}
+	memcpy( bank + BANK_WAVETABLES_OFFSET, wavetables, PPG_ROM_WAVETABLE_SIZE );
+	memcpy( bank + BANK_WAVEFORMS_OFFSET, rom + PPG_ROM_WAVEFORMS_OFFSET, PPG_ROM_WAVEFORMS_SIZE );
+
+	f = fopen( argv[2], "wb" );
+	if ( f == NULL )
+	{
+		perror( "could not create bank" );
+		return 1;
+	}
+
+	if ( fwrite( bank, 1, sizeof( bank ), f ) != sizeof( bank ) || fclose( f ) )
+	{
+		perror( "could not write bank" );
+		return 1;
+	}
+
+	return 0;
+}
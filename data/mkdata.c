@@ -0,0 +1,100 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ppg_data.h"
+
+/**
+	\file mkdata.c
+	\author Jacek Wieczorek
+
+	\brief Generates C arrays with the ROM data from ppg_rom.bin
+
+	The output goes to stdout. With -p, the arrays are placed in AVR program memory
+	(for avr/ppg_data_avr.c), otherwise they're plain constant arrays (for ppg_data.c).
+*/
+
+//! Number of bytes per line of output
+#define BYTES_PER_LINE 16
+
+//! Number of samples in a single waveform
+#define WAVEFORM_SIZE 64
+
+/**
+	Writes a single array. Each line is commented with its address, or, if waveform_size is not 0,
+	with waveform and sample numbers.
+*/
+static void write_array( const char *name, const uint8_t *data, unsigned int size, unsigned int waveform_size, int progmem )
+{
+	printf( "\nconst uint8_t %s[]%s = {\n", name, progmem ? " PROGMEM" : "" );
+	for ( unsigned int i = 0; i < size; i += BYTES_PER_LINE )
+	{
+		putchar( '\t' );
+		for ( unsigned int j = i; j < i + BYTES_PER_LINE && j < size; j++ )
+			printf( "0x%02x,", data[j] );
+		if ( waveform_size )
+			printf( " // wave %03u, sample %02u\n", i / waveform_size, i % waveform_size );
+		else
+			printf( " // 0x%04x\n", i );
+	}
+	printf( "};\n" );
+}
+
+int main( int argc, char **argv )
+{
+	static uint8_t rom[PPG_ROM_SIZE + 1];
+	int progmem = 0;
+
+	// Command line options
+	int opt;
+	while ( ( opt = getopt( argc, argv, "p" ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			// AVR program memory
+			case 'p':
+				progmem = 1;
+				break;
+
+			default:
+				fprintf( stderr, "Usage: %s [-p] ROM\n", argv[0] );
+				fprintf( stderr, "\t-p - place the arrays in AVR program memory\n" );
+				return 1;
+		}
+	}
+
+	if ( optind != argc - 1 )
+	{
+		fprintf( stderr, "Usage: %s [-p] ROM\n", argv[0] );
+		return 1;
+	}
+
+	FILE *f = fopen( argv[optind], "rb" );
+	if ( f == NULL )
+	{
+		perror( "could not open ROM" );
+		return 1;
+	}
+
+	// Reading one more byte than expected detects oversized files
+	size_t size = fread( rom, 1, sizeof( rom ), f );
+	fclose( f );
+	if ( size != PPG_ROM_SIZE )
+	{
+		fprintf( stderr, "invalid ROM size (%zu bytes, expected %d)\n", size, PPG_ROM_SIZE );
+		return 1;
+	}
+
+	printf( "// Generated by mkdata from %s - do not edit\n", argv[optind] );
+	printf( "#include <inttypes.h>\n" );
+	if ( progmem )
+		printf( "#include <avr/pgmspace.h>\n#include \"ppg_data_avr.h\"\n" );
+	else
+		printf( "#include \"ppg_data.h\"\n" );
+
+	write_array( "ppg_wavetable", rom + PPG_ROM_WAVETABLE_OFFSET, PPG_ROM_WAVETABLE_SIZE, 0, progmem );
+	write_array( "ppg_waveforms", rom + PPG_ROM_WAVEFORMS_OFFSET, PPG_ROM_WAVEFORMS_SIZE, WAVEFORM_SIZE, progmem );
+
+	return 0;
+}
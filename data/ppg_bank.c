@@ -0,0 +1,131 @@
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ppg_bank.h"
+
+//! Checks if a block of given length at given offset fits in the file
+static int ppg_bank_fits( const struct ppg_bank_header *h, uint64_t offset, uint64_t length )
+{
+	return offset <= h->file_size && length <= h->file_size - offset;
+}
+
+//! Checks the header and the index of a mapped bank
+static int ppg_bank_validate( const struct ppg_bank *bank )
+{
+	const struct ppg_bank_header *h = bank->header;
+
+	if ( bank->map_size < sizeof( struct ppg_bank_header ) ) return EINVAL;
+	if ( memcmp( h->magic, PPG_BANK_MAGIC, sizeof( h->magic ) ) ) return EINVAL;
+	if ( h->version != PPG_BANK_VERSION ) return ENOTSUP;
+	if ( h->header_size != sizeof( struct ppg_bank_header ) || h->file_size != bank->map_size ) return EINVAL;
+
+	// The index has to be aligned, because it's used in place too
+	if ( h->index_offset % sizeof( uint32_t ) ) return EINVAL;
+	if ( !ppg_bank_fits( h, h->index_offset, (uint64_t) h->wavetable_count * sizeof( uint32_t ) ) ) return EINVAL;
+	if ( !ppg_bank_fits( h, h->wavetables_offset, h->wavetables_length ) ) return EINVAL;
+
+	if ( h->waveforms_offset % PPG_BANK_ALIGNMENT ) return EINVAL;
+	if ( !ppg_bank_fits( h, h->waveforms_offset, (uint64_t) h->waveform_count * h->waveform_size ) ) return EINVAL;
+
+	return 0;
+}
+
+/**
+	Maps a bank file into memory. Returns 0 on success. On failure, errno is set (EINVAL for
+	malformed files, ENOTSUP for unsupported versions) and -1 is returned.
+*/
+int ppg_bank_open( struct ppg_bank *bank, const char *path )
+{
+	memset( bank, 0, sizeof( *bank ) );
+
+	int fd = open( path, O_RDONLY );
+	if ( fd < 0 ) return -1;
+
+	struct stat st;
+	if ( fstat( fd, &st ) )
+	{
+		close( fd );
+		return -1;
+	}
+
+	if ( st.st_size < (off_t) sizeof( struct ppg_bank_header ) || st.st_size > UINT32_MAX )
+	{
+		close( fd );
+		errno = EINVAL;
+		return -1;
+	}
+
+	// The mapping stays valid after the file is closed
+	void *map = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	close( fd );
+	if ( map == MAP_FAILED ) return -1;
+
+	bank->map = map;
+	bank->map_size = st.st_size;
+	bank->header = map;
+
+	int err = ppg_bank_validate( bank );
+	if ( err )
+	{
+		ppg_bank_close( bank );
+		errno = err;
+		return -1;
+	}
+
+	bank->index = (const uint32_t *)( (const uint8_t *) map + bank->header->index_offset );
+	bank->waveforms = (const uint8_t *) map + bank->header->waveforms_offset;
+	return 0;
+}
+
+//! Unmaps a bank
+void ppg_bank_close( struct ppg_bank *bank )
+{
+	if ( bank->map != NULL )
+		munmap( (void *) bank->map, bank->map_size );
+	memset( bank, 0, sizeof( *bank ) );
+}
+
+/**
+	Returns a pointer to index-th wavetable definition in the mapped bank, which can be passed
+	directly to load_wavetable(). The definition is checked first, so that loading it never reads
+	past the definition block, writes past the wavetable or refers to a missing waveform. Slot 0 has
+	to hold a key-wave and the positions have to be strictly increasing, which is what load_wavetable()
+	relies on. Returns NULL if the index is out of range or the definition is malformed.
+*/
+const uint8_t *ppg_bank_get_wavetable( const struct ppg_bank *bank, unsigned int index )
+{
+	const struct ppg_bank_header *h = bank->header;
+	if ( index >= h->wavetable_count || h->wavetable_size == 0 ) return NULL;
+
+	uint32_t offset = bank->index[index];
+	if ( offset < h->wavetables_offset || offset - h->wavetables_offset >= h->wavetables_length ) return NULL;
+
+	const uint8_t *data = (const uint8_t *) bank->map + offset;
+	const uint8_t *end = (const uint8_t *) bank->map + h->wavetables_offset + h->wavetables_length;
+
+	// The first byte, then waveform/position pairs up to the last slot
+	const uint8_t *p = data + 1;
+	unsigned int pos, next_pos = 0;
+	do
+	{
+		if ( end - p < 2 ) return NULL;
+		unsigned int waveform = p[0];
+		pos = p[1];
+
+		if ( waveform >= h->waveform_count ) return NULL;
+		if ( pos >= h->wavetable_size ) return NULL;
+
+		// The first key-wave has to be in slot 0, each next one further to the right
+		if ( p == data + 1 ? pos != 0 : pos < next_pos ) return NULL;
+
+		next_pos = pos + 1;
+		p += 2;
+	}
+	while ( pos < h->wavetable_size - 1 );
+
+	return data;
+}
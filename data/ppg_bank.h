@@ -0,0 +1,75 @@
+#ifndef PPG_BANK_H
+#define PPG_BANK_H
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error bank files are little-endian and are used in place
+#endif
+
+/**
+	\file ppg_bank.h
+	\author Jacek Wieczorek
+
+	\brief Wavetable bank files
+
+	A bank holds the same kind of data as the ROM (wavetable definitions and 64-sample waveforms),
+	but can be loaded at runtime. The file is meant to be mapped into memory with ppg_bank_open()
+	and used in place - the definitions can be passed straight to load_wavetable().
+
+	All values are little-endian and all offsets are counted from the beginning of the file:
+
+	- struct ppg_bank_header
+	- wavetable index - wavetable_count 32-bit offsets of wavetable definitions
+	- wavetable definitions - in the ROM format, wavetables_length bytes in total
+	- waveforms - waveform_count * waveform_size bytes, aligned to PPG_BANK_ALIGNMENT
+
+	Only the header and the index are checked when the bank is opened, so this takes the same time
+	regardless of the bank size. Each definition is checked when it's requested (see ppg_bank_get_wavetable()).
+*/
+
+//! Magic bytes at the beginning of each bank file
+#define PPG_BANK_MAGIC "PPGBANK"
+
+//! Current version of the format
+#define PPG_BANK_VERSION 1
+
+//! Alignment of the waveform block (enough for any SIMD load)
+#define PPG_BANK_ALIGNMENT 64
+
+//! Bank file header
+struct ppg_bank_header
+{
+	char magic[8];               //!< PPG_BANK_MAGIC
+	uint32_t version;            //!< PPG_BANK_VERSION
+	uint32_t header_size;        //!< sizeof( struct ppg_bank_header )
+	uint32_t file_size;          //!< Total size of the file
+
+	uint32_t wavetable_count;    //!< Number of wavetables
+	uint32_t wavetable_size;     //!< Number of slots in each wavetable
+	uint32_t index_offset;       //!< Offset of the wavetable index
+	uint32_t wavetables_offset;  //!< Offset of the wavetable definitions
+	uint32_t wavetables_length;  //!< Total length of the wavetable definitions
+
+	uint32_t waveform_count;     //!< Number of waveforms
+	uint32_t waveform_size;      //!< Number of samples in each waveform
+	uint32_t waveforms_offset;   //!< Offset of the waveforms (aligned to PPG_BANK_ALIGNMENT)
+	uint32_t reserved;
+};
+
+//! A bank mapped into memory
+struct ppg_bank
+{
+	const void *map;
+	size_t map_size;
+	const struct ppg_bank_header *header;
+	const uint32_t *index;
+	const uint8_t *waveforms;
+};
+
+int ppg_bank_open( struct ppg_bank *bank, const char *path );
+void ppg_bank_close( struct ppg_bank *bank );
+const uint8_t *ppg_bank_get_wavetable( const struct ppg_bank *bank, unsigned int index );
+
+#endif
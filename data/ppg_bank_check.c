@@ -0,0 +1,171 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <errno.h>
+
+#include "ppg_bank.h"
+
+/**
+	\file ppg_bank_check.c
+	\author Jacek Wieczorek
+
+	\brief Checks that ppg_bank_open() and ppg_bank_get_wavetable() accept a valid bank and reject
+	malformed ones.
+
+	Every wavetable of the given bank (ppg.bank built by mkbank) has to load. Then the bank is damaged
+	in various ways, written to a temporary file and opened again - either opening it or getting the
+	damaged wavetable has to fail. Returns non-zero on failure.
+*/
+
+//! Temporary file the damaged banks are written to
+#define CHECK_BANK_PATH "ppg_bank_check.tmp"
+
+//! The valid bank and a copy that gets damaged
+static uint8_t *bank_data, *bad_data;
+static size_t bank_size;
+
+//! Reads a 32-bit header field or index entry
+static uint32_t get_u32( const uint8_t *data, size_t offset )
+{
+	uint32_t x;
+	memcpy( &x, data + offset, sizeof( x ) );
+	return x;
+}
+
+//! Writes a 32-bit header field or index entry
+static void set_u32( uint8_t *data, size_t offset, uint32_t x )
+{
+	memcpy( data + offset, &x, sizeof( x ) );
+}
+
+//! Returns offset of n-th wavetable definition in the bank
+static uint32_t wavetable_offset( unsigned int n )
+{
+	return get_u32( bank_data, get_u32( bank_data, offsetof( struct ppg_bank_header, index_offset ) ) + n * sizeof( uint32_t ) );
+}
+
+/**
+	Writes size bytes of the damaged bank to a file and checks that it's rejected - either by ppg_bank_open()
+	with open_errno, or (if open_errno is 0) by ppg_bank_get_wavetable() for given wavetable.
+	Returns 0 if the bank was rejected as expected.
+*/
+static int check_bad_bank( const char *name, size_t size, int open_errno, unsigned int wavetable )
+{
+	FILE *f = fopen( CHECK_BANK_PATH, "wb" );
+	if ( f == NULL || fwrite( bad_data, 1, size, f ) != size || fclose( f ) )
+	{
+		perror( "could not write temporary bank" );
+		exit( 1 );
+	}
+
+	struct ppg_bank bank;
+	int ok;
+	if ( ppg_bank_open( &bank, CHECK_BANK_PATH ) )
+		ok = open_errno != 0 && errno == open_errno;
+	else
+	{
+		ok = open_errno == 0 && ppg_bank_get_wavetable( &bank, wavetable ) == NULL;
+		ppg_bank_close( &bank );
+	}
+
+	if ( !ok )
+		fprintf( stderr, "not rejected: %s\n", name );
+
+	// Start the next case from the valid bank
+	memcpy( bad_data, bank_data, bank_size );
+	return !ok;
+}
+
+int main( int argc, char **argv )
+{
+	if ( argc != 2 )
+	{
+		fprintf( stderr, "Usage: %s BANK\n", argv[0] );
+		return 1;
+	}
+
+	// The valid bank has to be accepted as a whole
+	struct ppg_bank bank;
+	if ( ppg_bank_open( &bank, argv[1] ) )
+	{
+		perror( "could not open wavetable bank" );
+		return 1;
+	}
+
+	unsigned int failures = 0;
+	unsigned int count = bank.header->wavetable_count;
+	for ( unsigned int i = 0; i < count; i++ )
+	{
+		if ( ppg_bank_get_wavetable( &bank, i ) == NULL )
+		{
+			fprintf( stderr, "valid wavetable %u rejected\n", i );
+			failures++;
+		}
+	}
+
+	bank_size = bank.map_size;
+	bank_data = malloc( bank_size );
+	bad_data = malloc( bank_size );
+	memcpy( bank_data, bank.map, bank_size );
+	memcpy( bad_data, bank_data, bank_size );
+	ppg_bank_close( &bank );
+
+	const struct ppg_bank_header *h = (const struct ppg_bank_header *) bank_data;
+	uint32_t wt0 = wavetable_offset( 0 );
+	unsigned int cases = 0;
+
+	// Header
+	cases++; failures += check_bad_bank( "truncated header", sizeof( struct ppg_bank_header ) - 1, EINVAL, 0 );
+	cases++; failures += check_bad_bank( "truncated file", bank_size - 1, EINVAL, 0 );
+
+	bad_data[0] = 'X';
+	cases++; failures += check_bad_bank( "bad magic", bank_size, EINVAL, 0 );
+
+	set_u32( bad_data, offsetof( struct ppg_bank_header, version ), PPG_BANK_VERSION + 1 );
+	cases++; failures += check_bad_bank( "unsupported version", bank_size, ENOTSUP, 0 );
+
+	set_u32( bad_data, offsetof( struct ppg_bank_header, waveforms_offset ), h->waveforms_offset + 4 );
+	cases++; failures += check_bad_bank( "misaligned waveforms", bank_size, EINVAL, 0 );
+
+	set_u32( bad_data, offsetof( struct ppg_bank_header, waveform_count ), h->waveform_count + 1 );
+	cases++; failures += check_bad_bank( "waveforms past the end", bank_size, EINVAL, 0 );
+
+	set_u32( bad_data, offsetof( struct ppg_bank_header, wavetable_count ), 0x40000000 );
+	cases++; failures += check_bad_bank( "index past the end", bank_size, EINVAL, 0 );
+
+	// Index
+	set_u32( bad_data, h->index_offset, h->wavetables_offset + h->wavetables_length );
+	cases++; failures += check_bad_bank( "index entry past the definitions", bank_size, 0, 0 );
+
+	set_u32( bad_data, h->index_offset, h->wavetables_offset - 1 );
+	cases++; failures += check_bad_bank( "index entry before the definitions", bank_size, 0, 0 );
+
+	cases++; failures += check_bad_bank( "wavetable index out of range", bank_size, 0, count );
+
+	// Definitions (the first byte is ignored, then waveform/position pairs)
+	bad_data[wt0 + 2] = 5;
+	cases++; failures += check_bad_bank( "no key-wave in slot 0", bank_size, 0, 0 );
+
+	bad_data[wt0 + 4] = 0;
+	cases++; failures += check_bad_bank( "positions not increasing", bank_size, 0, 0 );
+
+	bad_data[wt0 + 4] = h->wavetable_size;
+	cases++; failures += check_bad_bank( "position past the last slot", bank_size, 0, 0 );
+
+	set_u32( bad_data, offsetof( struct ppg_bank_header, waveform_count ), 16 );
+	cases++; failures += check_bad_bank( "missing waveform", bank_size, 0, 0 );
+
+	// The last wavetable runs past the shortened definition block
+	uint32_t last = wavetable_offset( count - 1 );
+	set_u32( bad_data, offsetof( struct ppg_bank_header, wavetables_length ), last - h->wavetables_offset + 3 );
+	cases++; failures += check_bad_bank( "definition past the end of the block", bank_size, 0, count - 1 );
+
+	remove( CHECK_BANK_PATH );
+	free( bank_data );
+	free( bad_data );
+
+	printf( "%u wavetables loaded, %u malformed banks checked, %u failures\n", count, cases, failures );
+	return failures != 0;
+}
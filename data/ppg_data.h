@@ -1,9 +1,32 @@
 #ifndef PPG_DATA_H
 #define PPG_DATA_H
 
+/**
+	\file ppg_data.h
+	\author Jacek Wieczorek
+
+	\brief PPG Wave ROM data
+
+	The data lives in ppg_rom.bin, which is the only copy of it. ppg_data.c and avr/ppg_data_avr.c
+	are generated from it at build time (see mkdata.c), or ppg_rom.S can link the blob directly.
+*/
+
+//! Layout of ppg_rom.bin - wavetable definitions followed by 256 waveforms of 64 samples
+#define PPG_ROM_WAVETABLE_OFFSET 0
+#define PPG_ROM_WAVETABLE_SIZE 768
+#define PPG_ROM_WAVEFORMS_OFFSET 768
+#define PPG_ROM_WAVEFORMS_SIZE 16384
+#define PPG_ROM_SIZE ( PPG_ROM_WAVEFORMS_OFFSET + PPG_ROM_WAVEFORMS_SIZE )
+
+//! Number of wavetables defined in the ROM and number of slots in each of them
+#define PPG_ROM_WAVETABLE_COUNT 29
+#define PPG_ROM_WAVETABLE_SLOTS 61
+
+#ifndef __ASSEMBLER__
 #include <inttypes.h>
 
 extern const uint8_t ppg_wavetable[];
 extern const uint8_t ppg_waveforms[];
+#endif
 
 #endif
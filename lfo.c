@@ -0,0 +1,127 @@
+#include <inttypes.h>
+#include <math.h>
+#include "lfo.h"
+
+//! Sine lookup table size (has to be a power of 2)
+#define LFO_SINE_TABLE_BITS 8
+#define LFO_SINE_TABLE_SIZE ( 1 << LFO_SINE_TABLE_BITS )
+
+//! One cycle of sine with an additional guard point for interpolation
+static float lfo_sine_table[LFO_SINE_TABLE_SIZE + 1];
+
+const char *lfo_shape_names[LFO_SHAPE_COUNT] =
+{
+	[LFO_SINE] = "sine",
+	[LFO_TRIANGLE] = "triangle",
+	[LFO_SAW] = "saw",
+	[LFO_SQUARE] = "square",
+	[LFO_SAMPLE_HOLD] = "sh",
+};
+
+//! Linearly interpolated sine from the lookup table
+static inline float lfo_sine( uint32_t phase )
+{
+	unsigned int index = phase >> ( 32 - LFO_SINE_TABLE_BITS );
+	float frac = ( phase << LFO_SINE_TABLE_BITS ) / 4294967296.f;
+	return lfo_sine_table[index] + ( lfo_sine_table[index + 1] - lfo_sine_table[index] ) * frac;
+}
+
+//! Xorshift random number generator for sample & hold
+static inline uint32_t lfo_random( uint32_t *state )
+{
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+//! Advances LFO phase by one control period and returns the new control point (-1 to 1)
+static float lfo_step( struct lfo *lfo )
+{
+	uint32_t prev_phase = lfo->phase;
+	lfo->phase += lfo->phase_step;
+	float x = lfo->phase / 4294967296.f;
+
+	switch ( lfo->shape )
+	{
+		case LFO_SINE:
+			return lfo_sine( lfo->phase );
+
+		case LFO_TRIANGLE:
+			return x < 0.5f ? 4.f * x - 1.f : 3.f - 4.f * x;
+
+		case LFO_SAW:
+			return 2.f * x - 1.f;
+
+		case LFO_SQUARE:
+			return x < 0.5f ? 1.f : -1.f;
+
+		case LFO_SAMPLE_HOLD:
+			// New value each time the phase wraps around
+			if ( lfo->phase < prev_phase )
+				lfo->held = lfo_random( &lfo->random ) / 2147483648.f - 1.f;
+			return lfo->held;
+
+		default:
+			return 0;
+	}
+}
+
+/**
+	Initializes an LFO. Frequency is in Hz. The control period is the number of samples between
+	two consecutive evaluations of the LFO waveform.
+*/
+void lfo_init( struct lfo *lfo, enum lfo_shape shape, float frequency, unsigned int sampling_freq, unsigned int control_period )
+{
+	// The sine table is only computed once
+	static int sine_table_ready = 0;
+	if ( !sine_table_ready )
+	{
+		for ( unsigned int i = 0; i <= LFO_SINE_TABLE_SIZE; i++ )
+			lfo_sine_table[i] = sin( 2 * M_PI * i / LFO_SINE_TABLE_SIZE );
+		sine_table_ready = 1;
+	}
+
+	if ( control_period == 0 ) control_period = 1;
+
+	lfo->shape = shape;
+	lfo->phase = 0;
+	lfo->phase_step = (double) frequency * control_period / sampling_freq * 4294967296.0;
+	lfo->random = 0x12345678;
+	lfo->held = 0;
+	lfo->value = 0;
+	lfo->target = 0;
+	lfo->ramp_step = 0;
+	lfo->control_period = control_period;
+	lfo->countdown = 0;
+}
+
+//! Renders n samples of LFO output (-1 to 1)
+void lfo_render( struct lfo *lfo, float *out, unsigned int n )
+{
+	float value = lfo->value;
+
+	for ( unsigned int i = 0; i < n; )
+	{
+		// Compute next control point and start ramping towards it
+		if ( lfo->countdown == 0 )
+		{
+			lfo->target = lfo_step( lfo );
+			lfo->ramp_step = ( lfo->target - value ) / lfo->control_period;
+			lfo->countdown = lfo->control_period;
+		}
+
+		unsigned int len = n - i < lfo->countdown ? n - i : lfo->countdown;
+		float ramp_step = lfo->ramp_step;
+		for ( unsigned int j = 0; j < len; j++ )
+			out[i + j] = value + ( j + 1 ) * ramp_step;
+
+		// Land exactly on the control point, so rounding errors don't accumulate
+		lfo->countdown -= len;
+		value = lfo->countdown ? value + len * ramp_step : lfo->target;
+		i += len;
+	}
+
+	lfo->value = value;
+}
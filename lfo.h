@@ -0,0 +1,48 @@
+#ifndef LFO_H
+#define LFO_H
+
+#include <inttypes.h>
+
+/**
+	\file lfo.h
+	\author Jacek Wieczorek
+
+	\brief Control-rate LFOs
+
+	The LFO waveform is evaluated only once every control_period samples. The samples in between are
+	linear ramps towards the next control point, so rendering costs one add per sample and there are no
+	libm calls in the audio path.
+*/
+
+//! LFO waveform shapes
+enum lfo_shape
+{
+	LFO_SINE,
+	LFO_TRIANGLE,
+	LFO_SAW,
+	LFO_SQUARE,
+	LFO_SAMPLE_HOLD,
+	LFO_SHAPE_COUNT
+};
+
+//! A single LFO
+struct lfo
+{
+	enum lfo_shape shape;
+	uint32_t phase;              //!< DDS phase accumulator
+	uint32_t phase_step;         //!< Phase increment per control period
+	uint32_t random;             //!< Random generator state for sample & hold
+	float held;                  //!< Value held by sample & hold
+	float value;                 //!< Current output value
+	float target;                //!< Next control point
+	float ramp_step;             //!< Output increment per sample
+	unsigned int control_period; //!< Number of samples between control points
+	unsigned int countdown;      //!< Samples left until the next control point
+};
+
+extern const char *lfo_shape_names[LFO_SHAPE_COUNT];
+
+void lfo_init( struct lfo *lfo, enum lfo_shape shape, float frequency, unsigned int sampling_freq, unsigned int control_period );
+void lfo_render( struct lfo *lfo, float *out, unsigned int n );
+
+#endif
@@ -0,0 +1,107 @@
+#include <inttypes.h>
+#include <math.h>
+#include "ppg_ref.h"
+
+//! Returns a sample of a full (mirrored and inverted) waveform cycle of 128 samples
+static double ref_waveform_sample( const uint8_t *src, unsigned int index )
+{
+	if ( index < 64 )
+		return ( src[index] - 128 ) / 128.0;
+	else
+		return -( src[127 - index] - 128 ) / 128.0;
+}
+
+//! Returns a pointer to index-th wavetable definition in data in the ROM format
+const uint8_t *ref_find_wavetable( const uint8_t *data, unsigned int index )
+{
+	for ( unsigned int i = 0; i < index; i++ )
+	{
+		unsigned int pos;
+		data++;
+		do
+		{
+			data++;
+			pos = *data++;
+		}
+		while ( pos < REF_WAVETABLE_SIZE - 1 );
+	}
+
+	return data;
+}
+
+/**
+	Loads a wavetable definition (in the ROM format) using given 64-sample waveforms.
+	Returns non-zero if slot 0 doesn't hold a key-wave (there would be nothing to morph from).
+*/
+int ref_load_wavetable( struct ref_wavetable *wt, const uint8_t *data, const uint8_t *waveforms )
+{
+	unsigned int pos;
+
+	// Key-waves (the first byte is ignored)
+	int key[REF_WAVETABLE_SIZE];
+	for ( unsigned int i = 0; i < REF_WAVETABLE_SIZE; i++ )
+		key[i] = -1;
+
+	data++;
+	do
+	{
+		unsigned int waveform = *data++;
+		pos = *data++;
+		if ( pos < REF_WAVETABLE_SIZE ) key[pos] = waveform;
+	}
+	while ( pos < REF_WAVETABLE_SIZE - 1 );
+
+	// Every slot needs a key-wave at or to the left of it
+	if ( key[0] < 0 ) return -1;
+
+	// Exact factors between the closest key-waves
+	for ( unsigned int i = 0; i < REF_WAVETABLE_SIZE; i++ )
+	{
+		int l = i, r = i + 1;
+		while ( l > 0 && key[l] < 0 ) l--;
+		while ( r < REF_WAVETABLE_SIZE && key[r] < 0 ) r++;
+		if ( r == REF_WAVETABLE_SIZE ) r = l;
+
+		wt->wave_l[i] = waveforms + key[l] * 64;
+		wt->wave_r[i] = waveforms + key[r] * 64;
+		wt->factor[i] = r != l ? (double)( i - l ) / ( r - l ) : 0.0;
+	}
+
+	return 0;
+}
+
+//! Returns reference sample for given slot and 32-bit phase
+double ref_sample( const struct ref_wavetable *wt, unsigned int slot, uint32_t phase )
+{
+	unsigned int index = phase >> 25;
+	double t = wt->factor[slot];
+	return ( 1.0 - t ) * ref_waveform_sample( wt->wave_l[slot], index ) + t * ref_waveform_sample( wt->wave_r[slot], index );
+}
+
+//! Generates the test sweep - per-sample phase and slot
+void ref_sweep( uint32_t *phase, uint8_t *slot, unsigned int n )
+{
+	for ( unsigned int i = 0; i < n; i++ )
+	{
+		phase[i] = i * REF_SWEEP_PHASE_STEP;
+		slot[i] = (uint64_t) i * REF_WAVETABLE_SIZE / n;
+	}
+}
+
+//! Computes SNR and maximum error of engine output (full scale is 1.0) against the reference
+void ref_measure( const struct ref_wavetable *wt, const uint32_t *phase, const uint8_t *slot, const float *out, unsigned int n, struct ref_error *err )
+{
+	double signal = 0, noise = 0, max_error = 0;
+
+	for ( unsigned int i = 0; i < n; i++ )
+	{
+		double ref = ref_sample( wt, slot[i], phase[i] );
+		double e = out[i] - ref;
+		signal += ref * ref;
+		noise += e * e;
+		if ( fabs( e ) > max_error ) max_error = fabs( e );
+	}
+
+	err->snr_db = noise > 0 ? 10 * log10( signal / noise ) : INFINITY;
+	err->max_error = max_error;
+}
@@ -0,0 +1,47 @@
+#ifndef PPG_REF_H
+#define PPG_REF_H
+
+#include <inttypes.h>
+
+/**
+	\file ppg_ref.h
+	\author Jacek Wieczorek
+
+	\brief Double precision reference for engine accuracy measurements
+
+	The reference reads waveforms straight from the ROM data (or a bank) and morphs between key-waves with exact
+	factors in double precision. Engines render the same sweep (see ref_sweep()) and ref_measure()
+	compares their output with it. Mipmaps are not involved - this measures numerical accuracy only.
+*/
+
+//! Number of slots in a wavetable
+#define REF_WAVETABLE_SIZE 61
+
+//! Length of the test sweep - the slot goes from 0 to REF_WAVETABLE_SIZE - 1 over it
+#define REF_SWEEP_LENGTH ( REF_WAVETABLE_SIZE * 1024 )
+
+//! Phase step of the test sweep (about 142 Hz at 20 kHz, not a divisor of the cycle)
+#define REF_SWEEP_PHASE_STEP 0x01234567u
+
+//! A wavetable with exact morphing factors
+struct ref_wavetable
+{
+	const uint8_t *wave_l[REF_WAVETABLE_SIZE];
+	const uint8_t *wave_r[REF_WAVETABLE_SIZE];
+	double factor[REF_WAVETABLE_SIZE];
+};
+
+//! Error of an engine's output relative to the reference
+struct ref_error
+{
+	double snr_db;
+	double max_error;
+};
+
+const uint8_t *ref_find_wavetable( const uint8_t *data, unsigned int index );
+int ref_load_wavetable( struct ref_wavetable *wt, const uint8_t *data, const uint8_t *waveforms );
+double ref_sample( const struct ref_wavetable *wt, unsigned int slot, uint32_t phase );
+void ref_sweep( uint32_t *phase, uint8_t *slot, unsigned int n );
+void ref_measure( const struct ref_wavetable *wt, const uint32_t *phase, const uint8_t *slot, const float *out, unsigned int n, struct ref_error *err );
+
+#endif
@@ -0,0 +1,20 @@
+#!/bin/bash
+cd "$(dirname "$0")"
+
+# Renders the same sweep through all engines on every wavetable and prints a table
+# of their error against the double precision reference (see ppg_ref.c) and speed.
+# Run 'make quality' to build optimized binaries and run it.
+
+for n in {0..28}; do
+	echo "wavetable $n"
+	{
+		for k in scalar sse2 avx2; do
+			# Kernels the CPU can't run get an explicit row (the reason goes to stderr)
+			./ppg_aplay_bench -q -m -k $k -w $n || echo "float_$k,$n,,unsupported,,"
+		done
+		./avr_aplay/avr_ppg_aplay_bench -q -m -w $n
+	} | awk -F, '
+		BEGIN { printf "  %-14s %10s %10s %14s\n", "engine", "snr_db", "max_error", "ns_per_sample" }
+		{ printf "  %-14s %10s %10s %14s\n", $1, $4, $5, $6 }'
+	echo
+done;